@@ -0,0 +1,96 @@
+# Copyright (C) 2024 Intel Corporation
+# Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+# See LICENSE.TXT
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+import os
+import json
+from utils.utils import run
+from .base import Benchmark, Suite
+from .result import Result
+from .options import options
+
+# Each entry is one value of UR_ENABLE_LAYERS.
+layer_combinations = [
+    [],
+    ["UR_LAYER_PARAMETER_VALIDATION"],
+    ["UR_LAYER_FULL_VALIDATION"],
+    ["UR_LAYER_LEAK_CHECKING"],
+]
+
+class ApiOverheadBench(Suite):
+    def __init__(self, directory):
+        self.directory = directory
+
+    def benchmarks(self) -> list[Benchmark]:
+        if options.ur is None:
+            return []
+
+        return [
+            ApiOverhead(self, adapter, layers)
+            for adapter in ['mock', 'native_cpu']
+            for layers in layer_combinations
+        ]
+
+class ApiOverhead(Benchmark):
+    def __init__(self, bench, adapter, layers):
+        self.bench = bench
+        self.adapter = adapter
+        self.layers = layers
+        super().__init__(bench.directory)
+
+    def name(self):
+        layers = ",".join(self.layers) if self.layers else "no layers"
+        return f"ur_api_overhead_benchmark {self.adapter} {layers}"
+
+    def setup(self):
+        self.benchmark_bin = os.path.join(options.ur, 'bin', 'ur_api_overhead_benchmark')
+        if not os.path.isfile(self.benchmark_bin):
+            raise FileNotFoundError(f"could not find {self.benchmark_bin}, build UR with -DUR_BUILD_BENCHMARKS=ON")
+
+    def adapter_env(self) -> dict:
+        if self.adapter == 'mock':
+            return {}
+        for libs_dir_name in ['lib', 'lib64']:
+            adapter_path = os.path.join(options.ur, libs_dir_name, f"libur_adapter_{self.adapter}.so")
+            if os.path.isfile(adapter_path):
+                return {'UR_ADAPTERS_FORCE_LOAD': adapter_path}
+        raise FileNotFoundError(f"could not find the {self.adapter} adapter in {options.ur}")
+
+    def run(self, env_vars) -> list[Result]:
+        command = [
+            self.benchmark_bin,
+            "--benchmark_format=json",
+        ]
+        if self.adapter == 'mock':
+            command += ["--mock"]
+
+        env_vars = {**env_vars, **self.adapter_env()}
+        if self.layers:
+            env_vars['UR_ENABLE_LAYERS'] = ",".join(self.layers)
+
+        result = run(command, env_vars=env_vars, cwd=options.benchmark_cwd).stdout.decode()
+
+        ret = []
+        for label, value, unit in self.parse_output(result):
+            ret.append(Result(label=f"{self.name()} {label}", value=value, command=command, env=env_vars, stdout=result, unit=unit))
+        return ret
+
+    def parse_output(self, output):
+        try:
+            data = json.loads(output)
+        except json.JSONDecodeError as e:
+            raise ValueError(f"Error parsing output: {e}")
+
+        results = []
+        for bench in data.get("benchmarks", []):
+            # benchmarks skipped on this adapter, e.g. a launch without a kernel
+            if bench.get("error_occurred", False):
+                continue
+            results.append((bench["name"], float(bench["cpu_time"]), bench["time_unit"]))
+        if len(results) == 0:
+            raise ValueError("Benchmark output does not contain data.")
+        return results
+
+    def teardown(self):
+        return
@@ -0,0 +1,64 @@
+# Copyright (C) 2024 Intel Corporation
+# Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+# See LICENSE.TXT
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+import os
+import json
+from utils.utils import run
+from .base import Benchmark, Suite
+from .result import Result
+from .options import options
+
+class PrintBench(Suite):
+    def __init__(self, directory):
+        self.directory = directory
+
+    def benchmarks(self) -> list[Benchmark]:
+        if options.ur is None:
+            return []
+
+        return [Print(self)]
+
+class Print(Benchmark):
+    def __init__(self, bench):
+        self.bench = bench
+        super().__init__(bench.directory)
+
+    def name(self):
+        return "ur_print_benchmark"
+
+    def setup(self):
+        self.benchmark_bin = os.path.join(options.ur, 'bin', 'ur_print_benchmark')
+        if not os.path.isfile(self.benchmark_bin):
+            raise FileNotFoundError(f"could not find {self.benchmark_bin}, build UR with -DUR_BUILD_BENCHMARKS=ON")
+
+    def run(self, env_vars) -> list[Result]:
+        command = [
+            self.benchmark_bin,
+            "--benchmark_format=json",
+        ]
+
+        result = run(command, env_vars=env_vars, cwd=options.benchmark_cwd).stdout.decode()
+
+        ret = []
+        for label, value, unit in self.parse_output(result):
+            ret.append(Result(label=f"{self.name()} {label}", value=value, command=command, env=env_vars, stdout=result, unit=unit))
+        return ret
+
+    def parse_output(self, output):
+        try:
+            data = json.loads(output)
+        except json.JSONDecodeError as e:
+            raise ValueError(f"Error parsing output: {e}")
+
+        results = [
+            (bench["name"], float(bench["cpu_time"]), bench["time_unit"])
+            for bench in data.get("benchmarks", [])
+        ]
+        if len(results) == 0:
+            raise ValueError("Benchmark output does not contain data.")
+        return results
+
+    def teardown(self):
+        return
@@ -0,0 +1,86 @@
+# Copyright (C) 2024 Intel Corporation
+# Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+# See LICENSE.TXT
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+import os
+import csv
+import io
+from utils.utils import run
+from .base import Benchmark, Suite
+from .result import Result
+from .options import options
+
+class ScalingBench(Suite):
+    def __init__(self, directory):
+        self.directory = directory
+
+    def benchmarks(self) -> list[Benchmark]:
+        if options.ur is None:
+            return []
+
+        return [
+            Scaling(self, adapter, mode)
+            for adapter in ['mock', 'native_cpu']
+            for mode in ['shared', 'per-thread']
+        ]
+
+class Scaling(Benchmark):
+    def __init__(self, bench, adapter, mode):
+        self.bench = bench
+        self.adapter = adapter
+        self.mode = mode
+        super().__init__(bench.directory)
+
+    def name(self):
+        return f"ur_scaling_benchmark {self.adapter} {self.mode} queue"
+
+    def lower_is_better(self):
+        return False
+
+    def setup(self):
+        self.benchmark_bin = os.path.join(options.ur, 'bin', 'ur_scaling_benchmark')
+        if not os.path.isfile(self.benchmark_bin):
+            raise FileNotFoundError(f"could not find {self.benchmark_bin}, build UR with -DUR_BUILD_BENCHMARKS=ON")
+
+    def adapter_env(self) -> dict:
+        if self.adapter == 'mock':
+            return {}
+        for libs_dir_name in ['lib', 'lib64']:
+            adapter_path = os.path.join(options.ur, libs_dir_name, f"libur_adapter_{self.adapter}.so")
+            if os.path.isfile(adapter_path):
+                return {'UR_ADAPTERS_FORCE_LOAD': adapter_path}
+        raise FileNotFoundError(f"could not find the {self.adapter} adapter in {options.ur}")
+
+    def run(self, env_vars) -> list[Result]:
+        command = [
+            self.benchmark_bin,
+            f"--mode={self.mode}",
+        ]
+        if self.adapter == 'mock':
+            command += ["--mock"]
+        else:
+            command += ["--device-type=cpu"]
+
+        env_vars = {**env_vars, **self.adapter_env()}
+        result = run(command, env_vars=env_vars, cwd=options.benchmark_cwd).stdout.decode()
+
+        ret = []
+        for label, value, unit in self.parse_output(result):
+            ret.append(Result(label=f"{self.name()} {label}", value=value, command=command, env=env_vars, stdout=result, unit=unit))
+        return ret
+
+    def parse_output(self, output):
+        reader = csv.DictReader(io.StringIO(output))
+        results = []
+        try:
+            for row in reader:
+                results.append((f"{row['threads']} threads", float(row['throughput']), row['unit']))
+        except (KeyError, ValueError) as e:
+            raise ValueError(f"Error parsing output: {e}")
+        if len(results) == 0:
+            raise ValueError("Benchmark output does not contain data.")
+        return results
+
+    def teardown(self):
+        return
@@ -0,0 +1,88 @@
+# Copyright (C) 2024 Intel Corporation
+# Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+# See LICENSE.TXT
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+import os
+import csv
+import io
+from utils.utils import run
+from .base import Benchmark, Suite
+from .result import Result
+from .options import options
+
+class StartupBench(Suite):
+    def __init__(self, directory):
+        self.directory = directory
+
+    def benchmarks(self) -> list[Benchmark]:
+        if options.ur is None:
+            return []
+
+        return [
+            Startup(self, 'mock'),
+            Startup(self, 'native_cpu'),
+            Startup(self, 'opencl', device_type='cpu'),
+        ]
+
+class Startup(Benchmark):
+    def __init__(self, bench, adapter, device_type='all'):
+        self.bench = bench
+        self.adapter = adapter
+        self.device_type = device_type
+        super().__init__(bench.directory)
+
+    def name(self):
+        return f"ur_startup_benchmark {self.adapter} {self.device_type}"
+
+    def setup(self):
+        self.benchmark_bin = os.path.join(options.ur, 'bin', 'ur_startup_benchmark')
+        if not os.path.isfile(self.benchmark_bin):
+            raise FileNotFoundError(f"could not find {self.benchmark_bin}, build UR with -DUR_BUILD_BENCHMARKS=ON")
+
+    def adapter_env(self) -> dict:
+        if self.adapter == 'mock':
+            return {}
+        for libs_dir_name in ['lib', 'lib64']:
+            adapter_path = os.path.join(options.ur, libs_dir_name, f"libur_adapter_{self.adapter}.so")
+            if os.path.isfile(adapter_path):
+                return {'UR_ADAPTERS_FORCE_LOAD': adapter_path}
+        raise FileNotFoundError(f"could not find the {self.adapter} adapter in {options.ur}")
+
+    def run(self, env_vars) -> list[Result]:
+        command = [
+            self.benchmark_bin,
+            "--processes=10",
+            f"--device-type={self.device_type}",
+        ]
+        if self.adapter == 'mock':
+            command += ["--mock"]
+
+        env_vars = {**env_vars, **self.adapter_env()}
+        # each sample is a new process, so startup cost is not amortized
+        result = run(command, env_vars=env_vars, cwd=options.benchmark_cwd).stdout.decode()
+
+        ret = []
+        for phase, median, stddev, unit in self.parse_output(result):
+            ret.append(Result(label=f"{self.name()} {phase}", value=median, stddev=stddev, command=command, env=env_vars, stdout=result, unit=unit))
+        return ret
+
+    def parse_output(self, output):
+        reader = csv.reader(io.StringIO(output))
+        next(reader, None)
+        results = []
+        for data_row in reader:
+            try:
+                phase = data_row[0]
+                median = float(data_row[2])
+                stddev = float(data_row[3])
+                unit = "μs" if data_row[7] == "us" else data_row[7]
+                results.append((phase, median, stddev, unit))
+            except (ValueError, IndexError) as e:
+                raise ValueError(f"Error parsing output: {e}")
+        if len(results) == 0:
+            raise ValueError("Benchmark output does not contain data.")
+        return results
+
+    def teardown(self):
+        return
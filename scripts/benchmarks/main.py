@@ -9,6 +9,11 @@ from benches.compute import *
 from benches.velocity import VelocityBench
 from benches.syclbench import *
 from benches.llamacpp import *
+from benches.startup import StartupBench
+from benches.api_overhead import ApiOverheadBench
+from benches.scaling import ScalingBench
+from benches.kernel_throughput import KernelThroughputBench
+from benches.printer import PrintBench
 from benches.test import TestSuite
 from benches.options import Compare, options
 from output_markdown import generate_markdown
@@ -120,6 +125,11 @@ def main(directory, additional_env_vars, save_name, compare_names, filter):
         VelocityBench(directory),
         SyclBench(directory),
         LlamaCppBench(directory),
+        StartupBench(directory),
+        ApiOverheadBench(directory),
+        ScalingBench(directory),
+        KernelThroughputBench(directory),
+        PrintBench(directory),
         #TestSuite()
     ] if not options.dry_run else []
 
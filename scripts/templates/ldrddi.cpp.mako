@@ -43,18 +43,33 @@ namespace ur_loader
         [[maybe_unused]] auto context = getContext();
         %if re.match(r"\w+AdapterGet$", th.make_func_name(n, tags, obj)):
         
-        size_t adapterIndex = 0;
-        if( nullptr != ${obj['params'][1]['name']} && ${obj['params'][0]['name']} !=0)
+        // Adapters which failed to initialize are not reported, neither by the
+        // count nor by the handles.
+        context->initAdapters();
+
+        uint32_t numAdapters = 0;
+        ${x}_result_t initResult = ${X}_RESULT_SUCCESS;
+        for( auto& platform : context->platforms )
         {
-            for( auto& platform : context->platforms )
+            if( platform.initStatus != ${X}_RESULT_SUCCESS )
+            {
+                if( initResult == ${X}_RESULT_SUCCESS )
+                    initResult = platform.initStatus;
+                continue;
+            }
+            if( nullptr != ${obj['params'][1]['name']} && numAdapters < ${obj['params'][0]['name']} )
             {
-                if(platform.initStatus != ${X}_RESULT_SUCCESS)
-                    continue;
-                platform.dditable.${n}.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}( 1, &${obj['params'][1]['name']}[adapterIndex], nullptr );
+                auto hAdapter = context->takeInitAdapter(platform);
+                if( nullptr == hAdapter )
+                {
+                    result = platform.dditable.${n}.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}( 1, &hAdapter, nullptr );
+                    if( result != ${X}_RESULT_SUCCESS )
+                        break;
+                }
                 try
                 {
-                    ${obj['params'][1]['name']}[adapterIndex] = reinterpret_cast<${n}_adapter_handle_t>(context->factories.${n}_adapter_factory.getInstance(
-                        ${obj['params'][1]['name']}[adapterIndex], &platform.dditable
+                    ${obj['params'][1]['name']}[numAdapters] = reinterpret_cast<${n}_adapter_handle_t>(context->factories.${n}_adapter_factory.getInstance(
+                        hAdapter, &platform.dditable
                     ));
                 }
                 catch( std::bad_alloc &)
@@ -62,16 +77,18 @@ namespace ur_loader
                     result = ${X}_RESULT_ERROR_OUT_OF_HOST_MEMORY;
                     break;
                 }
-                adapterIndex++;
-                if (adapterIndex == NumEntries) {
-                    break;
-                }
             }
+            numAdapters++;
+        }
+
+        if( nullptr != ${obj['params'][1]['name']} && ${obj['params'][0]['name']} != 0 && numAdapters == 0 && result == ${X}_RESULT_SUCCESS )
+        {
+            result = initResult;
         }
 
         if( ${obj['params'][2]['name']} != nullptr )
         {
-            *${obj['params'][2]['name']} = static_cast<uint32_t>(context->platforms.size());
+            *${obj['params'][2]['name']} = numAdapters;
         }
 
         %elif re.match(r"\w+PlatformGet$", th.make_func_name(n, tags, obj)):
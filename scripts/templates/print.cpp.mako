@@ -22,32 +22,21 @@ from templates import print_helper as tph
 #include "${n}_print.h"
 #include "${n}_print.hpp"
 
-#include <algorithm>
-#include <sstream>
-#include <string.h>
-
-<%def name="ss_copy(item_name)">\
-    std::stringstream ss;
-    ss << ${item_name};
-    return str_copy(&ss, buffer, buff_size, out_size);
+<%def name="writer_copy(item_name)">\
+    ${x}::writer::buffer_t buf(buffer, buff_size);
+    ${x}::writer::print(buf, ${item_name});
+    return buf_copy(buf, buffer, out_size);
 </%def>
 
-${x}_result_t str_copy(std::stringstream *ss, char *buff, const size_t buff_size, size_t *out_size) {
-    size_t c_str_size = strlen(ss->str().c_str()) + 1;
+// The output is formatted straight into the caller's buffer, a call without
+// a buffer only counts the bytes it needs.
+${x}_result_t buf_copy(${x}::writer::buffer_t &buf, char *buff, size_t *out_size) {
     if (out_size) {
-        *out_size = c_str_size;
+        *out_size = buf.size() + 1;
     }
 
-    if (buff) {
-        if (buff_size < c_str_size) {
-            return ${X}_RESULT_ERROR_INVALID_SIZE;
-        }
-
-#if defined(_WIN32)
-        strncpy_s(buff, buff_size, ss->str().c_str(), c_str_size);
-#else
-        strncpy(buff, ss->str().c_str(), std::min(buff_size, c_str_size));
-#endif
+    if (buff && !buf.terminate()) {
+        return ${X}_RESULT_ERROR_INVALID_SIZE;
     }
     return ${X}_RESULT_SUCCESS;
 }
@@ -57,16 +46,16 @@ ${x}_result_t str_copy(std::stringstream *ss, char *buff, const size_t buff_size
 %>
 %for func in api_types_funcs:
 ${x}_result_t ${func.c_name}(${func.c_args}) {
-    ${ss_copy(func.print_arg.name)}
+    ${writer_copy(func.print_arg.name)}
 }
 
 %endfor
 
 ${x}_result_t ${x}PrintFunctionParams(enum ${x}_function_t function, const void *params, char *buffer, const size_t buff_size, size_t *out_size) {
-    std::stringstream ss;
-    ${x}_result_t result = ${x}::extras::printFunctionParams(ss, function, params);
+    ${x}::writer::buffer_t buf(buffer, buff_size);
+    ${x}_result_t result = ${x}::writer::printFunctionParams(buf, function, params);
     if (result != ${X}_RESULT_SUCCESS) {
         return result;
     }
-    return str_copy(&ss, buffer, buff_size, out_size);
+    return buf_copy(buf, buffer, out_size);
 }
@@ -23,30 +23,35 @@ from templates import helper as th
 #define ${X}_PRINT_HPP 1
 
 #include "${x}_api.h"
+#include <cstdio>
+#include <cstring>
 #include <ostream>
-#include <bitset>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
 ## Mako helper functions ######################################################
 <%def name="member(iname, itype, loop)">
+<% value = capture(caller.body).strip() %>
     %if iname == "pNext":
-        ${x}::details::printStruct(os, ${caller.body()});
+        printStruct(buf, ${value});
     %elif th.type_traits.is_flags(itype):
-        ${x}::details::printFlag<${th.type_traits.get_flag_type(itype)}>(os, ${caller.body()});
+        printFlag<${th.type_traits.get_flag_type(itype)}>(buf, ${value});
     %elif not loop and th.type_traits.is_pointer(itype):
-        ${x}::details::printPtr(os, ${caller.body()});
+        printPtr(buf, ${value});
     %elif loop and th.type_traits.is_pointer_to_pointer(itype):
-        ${x}::details::printPtr(os, ${caller.body()});
+        printPtr(buf, ${value});
     %elif th.type_traits.is_native_handle(itype):
-        ${x}::details::printPtr(os, reinterpret_cast<void*>(${caller.body()}));
+        printPtr(buf, reinterpret_cast<void *>(${value}));
     %elif th.type_traits.is_handle(itype):
-        ${x}::details::printPtr(os, ${caller.body()});
+        printPtr(buf, ${value});
     %elif iname and iname.startswith("pfn"):
-        os << reinterpret_cast<void*>(${caller.body()});
+        writePtr(buf, reinterpret_cast<void *>(${value}));
     %elif "int8_t" in itype:
         ## Cast to int so bytes are printed as numbers
-        os << static_cast<int>(${caller.body()});
+        print(buf, static_cast<int>(${value}));
     %else:
-        os << ${caller.body()};
+        print(buf, ${value});
     %endif
 </%def>
 
@@ -74,50 +79,203 @@ def findMemberType(_item):
             underlying_type = params_dict[typename]
     %>
     %if n != 0:
-        os << ", ";
+        buf.write(", ");
     %endif
 ## can't iterate over 'void *'...
     %if th.param_traits.is_range(item) and "void*" not in itype:
-        os << ".${iname} = ";
-        ${x}::details::printPtr(os, reinterpret_cast<const void*>(${deref}(params${access}${pname})));
+        buf.write(".${iname} = ");
+        printPtr(buf, reinterpret_cast<const void *>(${deref}(params${access}${pname})));
         if (${deref}(params${access}${pname}) != NULL) {
-        os << " {";
-        for (size_t i = ${th.param_traits.range_start(item)}; i < ${deref}params${access}${prefix + th.param_traits.range_end(item)}; ++i) {
-            if (i != 0) {
-                os << ", ";
+            buf.write(" {");
+            for (size_t i = ${th.param_traits.range_start(item)}; i < ${deref}params${access}${prefix + th.param_traits.range_end(item)}; ++i) {
+                if (i != 0) {
+                    buf.write(", ");
+                }
+                <%call expr="member(iname, itype, True)">
+                    (${deref}(params${access}${pname}))[i]
+                </%call>
             }
-            <%call expr="member(iname, itype, True)">
-                (${deref}(params${access}${pname}))[i]
-            </%call>
-        }
-        os << "}";
+            buf.put('}');
         }
     %elif findMemberType(item) is not None and findMemberType(item)['type'] == "union":
-        os << ".${iname} = ";
-        ${x}::details::printUnion(os, ${deref}(params${access}${item['name']}), params${access}${th.param_traits.tagged_member(item)});
+        buf.write(".${iname} = ");
+        printUnion(buf, ${deref}(params${access}${item['name']}), params${access}${th.param_traits.tagged_member(item)});
     %elif th.type_traits.is_array(item['type']):
-        os << ".${iname} = {";
-        for(auto i = 0; i < ${th.type_traits.get_array_length(item['type'])}; i++){
-            if(i != 0){
-                os << ", ";
+        buf.write(".${iname} = {");
+        for (auto i = 0; i < ${th.type_traits.get_array_length(item['type'])}; i++) {
+            if (i != 0) {
+                buf.write(", ");
             }
             <%call expr="member(iname, itype, True)">
                 ${deref}(params${access}${item['name']}[i])
             </%call>
         }
-        os << "}";
+        buf.put('}');
     %elif typename is not None:
-        os << ".${iname} = ";
-        ${x}::details::printTagged(os, ${deref}(params${access}${pname}), ${deref}(params${access}${prefix}${typename}), ${deref}(params${access}${prefix}${typename_size}));
+        buf.write(".${iname} = ");
+        printTagged(buf, ${deref}(params${access}${pname}), ${deref}(params${access}${prefix}${typename}), ${deref}(params${access}${prefix}${typename_size}));
     %else:
-        os << ".${iname} = ";
+        buf.write(".${iname} = ");
         <%call expr="member(iname, itype, False)">
             ${deref}(params${access}${pname})
         </%call>
     %endif
 </%def>
 
-## API functions declarations #################################################
+## Writer ######################################################################
+namespace ${x}::writer {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Output of the allocation-free printer
+///
+/// @details Output goes to a caller-supplied buffer. When it is full, the
+/// optional grow callback is asked for a larger one, otherwise the rest of the
+/// output is dropped. size() always counts the complete output, so a single
+/// pass is enough to learn how much space it needs.
+class buffer_t {
+  public:
+    /// @brief Returns a buffer of at least `capacity` bytes starting with the
+    /// `size` bytes already written to `data`, or nullptr if it cannot grow
+    using grow_fn_t = char *(*)(void *userData, char *data, size_t size, size_t capacity);
+
+    buffer_t(char *data, size_t capacity, grow_fn_t grow = nullptr, void *userData = nullptr)
+        : data_(data), capacity_(data ? capacity : 0), grow_(grow), userData_(userData) {}
+
+    void put(char c) {
+        if (size_ < capacity_ || reserve(size_ + 1)) {
+            data_[size_] = c;
+        }
+        size_++;
+    }
+
+    void write(const char *str, size_t len) {
+        if (size_ + len <= capacity_ || reserve(size_ + len)) {
+            memcpy(data_ + size_, str, len);
+        } else if (size_ < capacity_) {
+            memcpy(data_ + size_, str, capacity_ - size_);
+        }
+        size_ += len;
+    }
+
+    void write(std::string_view str) { write(str.data(), str.size()); }
+
+    /// @brief Null-terminates the output
+    /// @returns false if the output and its terminator do not fit
+    bool terminate() {
+        if (size_ < capacity_ || reserve(size_ + 1)) {
+            data_[size_] = '\0';
+            return true;
+        }
+        return false;
+    }
+
+    void clear() { size_ = 0; }
+    const char *data() const { return data_; }
+    size_t size() const { return size_; }
+    bool truncated() const { return size_ > capacity_; }
+
+    /// @brief Returns the output kept in the buffer
+    std::string_view str() const { return {data_, truncated() ? capacity_ : size_}; }
+
+  private:
+    bool reserve(size_t required) {
+        // Once output has been dropped the buffer must not grow again.
+        if (!grow_ || size_ > capacity_) {
+            return false;
+        }
+        size_t capacity = capacity_ * 2 > required ? capacity_ * 2 : required;
+        char *data = grow_(userData_, data_, size_, capacity);
+        if (!data) {
+            grow_ = nullptr;
+            return false;
+        }
+        data_ = data;
+        capacity_ = capacity;
+        return true;
+    }
+
+    char *data_;
+    size_t capacity_;
+    size_t size_ = 0;
+    grow_fn_t grow_;
+    void *userData_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Grow callback for a buffer_t backed by the std::string in userData
+inline char *growString(void *userData, char *, size_t, size_t capacity) {
+    auto str = static_cast<std::string *>(userData);
+    str->resize(capacity);
+    return str->data();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Returns a buffer_t writing to, and growing, the given std::string
+///
+/// @details The string is used as storage only, its size is not trimmed to
+/// the output. Reusing the same string keeps its capacity across calls.
+inline buffer_t stringBuffer(std::string &str) {
+    return buffer_t(str.data(), str.size(), growString, &str);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Write an unsigned integer in decimal
+inline void writeUnsigned(buffer_t &buf, uint64_t value) {
+    char digits[20];
+    size_t pos = sizeof(digits);
+    do {
+        digits[--pos] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    buf.write(digits + pos, sizeof(digits) - pos);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Write a signed integer in decimal
+inline void writeSigned(buffer_t &buf, int64_t value) {
+    if (value < 0) {
+        buf.put('-');
+        writeUnsigned(buf, 0 - static_cast<uint64_t>(value));
+    } else {
+        writeUnsigned(buf, static_cast<uint64_t>(value));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Write an unsigned integer in hexadecimal, prefixed with 0x
+inline void writeHex(buffer_t &buf, uint64_t value) {
+    constexpr char hexDigits[] = "0123456789abcdef";
+    char digits[18];
+    size_t pos = sizeof(digits);
+    do {
+        digits[--pos] = hexDigits[value & 0xf];
+        value >>= 4;
+    } while (value != 0);
+    digits[--pos] = 'x';
+    digits[--pos] = '0';
+    buf.write(digits + pos, sizeof(digits) - pos);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Write a pointer value, or nullptr
+inline void writePtr(buffer_t &buf, const void *ptr) {
+    if (ptr == nullptr) {
+        buf.write("nullptr");
+    } else {
+        writeHex(buf, reinterpret_cast<uintptr_t>(ptr));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Write all 32 bits of a value, most significant first
+inline void writeBits(buffer_t &buf, uint32_t value) {
+    char bits[32];
+    for (size_t i = 0; i < sizeof(bits); i++) {
+        bits[i] = (value >> (31 - i)) & 1 ? '1' : '0';
+    }
+    buf.write(bits, sizeof(bits));
+}
+} // namespace ${x}::writer
+
 namespace ${x}::details {
 template <typename T> struct is_handle : std::false_type {};
 %for spec in specs:
@@ -129,45 +287,147 @@ template <> struct is_handle<${th.make_type_name(n, tags, obj)}> : std::true_typ
 %endfor
 template <typename T>
 inline constexpr bool is_handle_v = is_handle<T>::value;
-template <typename T> inline ${x}_result_t printPtr(std::ostream &os, const T *ptr);
-template <typename T> inline ${x}_result_t printFlag(std::ostream &os, uint32_t flag);
-template <typename T> inline ${x}_result_t printTagged(std::ostream &os, const void *ptr, T value, size_t size);
+} // namespace ${x}::details
 
+namespace ${x}::writer {
 %for spec in specs:
 %for obj in spec['objects']:
-## ENUM #######################################################################
-%if re.match(r"enum", obj['type']):
-    %if obj.get('typed_etors', False) is True:
-    template <> inline ${x}_result_t printTagged(std::ostream &os, const void *ptr, ${th.make_enum_name(n, tags, obj)} value, size_t size);
-    %elif "structure_type" in obj['name']:
-    inline ${x}_result_t printStruct(std::ostream &os, const void *ptr);
-    %endif
+## API versions have aliases and are printed as numbers instead
+%if re.match(r"enum", obj['type']) and "api_version" not in obj['name']:
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Name of a ${th.make_enum_name(n, tags, obj)} value, or an empty string if it is unknown
+constexpr std::string_view toString(enum ${th.make_enum_name(n, tags, obj)} value) {
+    switch (value) {
+    %for item in obj['etors']:
+    case ${th.make_etor_name(n, tags, obj['name'], item['name'])}:
+        return "${th.make_etor_name(n, tags, obj['name'], item['name'])}";
+    %endfor
+    default:
+        return {};
+    }
+}
 %endif
+%endfor # obj in spec['objects']
+%endfor
 
-## UNION ######################################################################
-%if re.match(r"union", obj['type']) and obj['name']:
-    <% tag = [_obj for _s in specs for _obj in _s['objects'] if _obj['name'] == obj['tag']][0] %>
-    inline ${x}_result_t printUnion(
-        std::ostream &os,
-        const ${obj['type']} ${th.make_type_name(n, tags, obj)} params,
-        const ${tag['type']} ${th.make_type_name(n, tags, tag)} tag
-    );
-%endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print an enum value by name
+template <typename T, std::enable_if_t<std::is_enum_v<T>, int> = 0>
+inline void print(buffer_t &buf, T value) {
+    auto name = toString(value);
+    buf.write(name.empty() ? std::string_view("unknown enumerator") : name);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print an API version as major.minor
+inline void print(buffer_t &buf, enum ${x}_api_version_t value) {
+    writeUnsigned(buf, ${X}_MAJOR_VERSION(value));
+    buf.put('.');
+    writeUnsigned(buf, ${X}_MINOR_VERSION(value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print an integer in decimal, a character as itself and a
+/// ${x}_bool_t as true or false
+template <typename T>
+inline std::enable_if_t<std::is_integral_v<T>> print(buffer_t &buf, T value) {
+    if constexpr (std::is_same_v<T, char>) {
+        buf.put(value);
+    } else if constexpr (std::is_same_v<T, ${x}_bool_t>) {
+        buf.write(value ? "true" : "false");
+    } else if constexpr (std::is_signed_v<T>) {
+        writeSigned(buf, value);
+    } else {
+        writeUnsigned(buf, value);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print a floating-point value like the default iostream format
+inline void print(buffer_t &buf, double value) {
+    char digits[32];
+    int len = std::snprintf(digits, sizeof(digits), "%g", value);
+    if (len > 0) {
+        buf.write(digits, static_cast<size_t>(len));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print the value of a pointer which is not followed
+inline void print(buffer_t &buf, const void *ptr) { writePtr(buf, ptr); }
+
+namespace details {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print the set bits of a flag value, in the order of `values`
+template <typename T, size_t N>
+inline void printFlagValues(buffer_t &buf, uint32_t flag, const T (&values)[N]) {
+    uint32_t val = flag;
+    bool first = true;
+    for (T value : values) {
+        // Toggle the bits to avoid printing overlapping values.
+        if ((val & value) == static_cast<uint32_t>(value)) {
+            val ^= static_cast<uint32_t>(value);
+            if (!first) {
+                buf.write(" | ");
+            } else {
+                first = false;
+            }
+            buf.write(toString(value));
+        }
+    }
+    if (val != 0) {
+        if (!first) {
+            buf.write(" | ");
+        }
+        buf.write("unknown bit flags ");
+        writeBits(buf, val);
+    } else if (first) {
+        buf.put('0');
+    }
+}
+} // namespace details
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print a flags value as the names of its set bits
+template <typename T>
+inline void printFlag(buffer_t &buf, uint32_t flag);
 
-## FLAG #######################################################################
-%if th.type_traits.is_flags(obj['name']):
-    template<> inline ${x}_result_t printFlag<${th.make_enum_name(n, tags, obj)}>(std::ostream &os, uint32_t flag);
+%for spec in specs:
+%for obj in spec['objects']:
+%if re.match(r"enum", obj['type']) and th.type_traits.is_flags(obj['name']):
+template <>
+inline void printFlag<${th.make_enum_name(n, tags, obj)}>(buffer_t &buf, uint32_t flag) {
+    static constexpr ${th.make_enum_name(n, tags, obj)} values[] = {
+    %for item in obj['etors']:
+        ${th.make_etor_name(n, tags, obj['name'], item['name'])},
+    %endfor
+    };
+    details::printFlagValues(buf, flag, values);
+}
 %endif
 %endfor # obj in spec['objects']
 %endfor
-} // namespace ${x}::details
+
+## API functions declarations #################################################
+template <typename T> inline ${x}_result_t printPtr(buffer_t &buf, const T *ptr);
+template <typename T> inline ${x}_result_t printTagged(buffer_t &buf, const void *ptr, T value, size_t size);
 
 %for spec in specs:
 %for obj in spec['objects']:
+## ENUM #######################################################################
 %if re.match(r"enum", obj['type']):
-    inline std::ostream &operator<<(std::ostream &os, enum ${th.make_enum_name(n, tags, obj)} value);
+    %if obj.get('typed_etors', False) is True:
+    template <> inline ${x}_result_t printTagged(buffer_t &buf, const void *ptr, ${th.make_enum_name(n, tags, obj)} value, size_t size);
+    %elif "structure_type" in obj['name']:
+    inline ${x}_result_t printStruct(buffer_t &buf, const void *ptr);
+    %endif
+## UNION ######################################################################
+%elif re.match(r"union", obj['type']) and obj['name']:
+    <% tag = findUnionTag(obj) %>
+    inline ${x}_result_t printUnion(buffer_t &buf, const ${obj['type']} ${th.make_type_name(n, tags, obj)} params, const ${tag['type']} ${th.make_type_name(n, tags, tag)} tag);
+## STRUCT #####################################################################
 %elif re.match(r"struct", obj['type']):
-    inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const ${obj['type']} ${th.make_type_name(n, tags, obj)} params);
+    inline void print(buffer_t &buf, const ${obj['type']} ${th.make_type_name(n, tags, obj)} params);
 %endif
 %endfor # obj in spec['objects']
 %endfor
@@ -177,40 +437,13 @@ template <typename T> inline ${x}_result_t printTagged(std::ostream &os, const v
 %for obj in spec['objects']:
 ## ENUM #######################################################################
 %if re.match(r"enum", obj['type']):
-    ///////////////////////////////////////////////////////////////////////////////
-    /// @brief Print operator for the ${th.make_enum_name(n, tags, obj)} type
-    /// @returns
-    ///     std::ostream &
-    %if "api_version" in obj['name']:
-    inline std::ostream &operator<<(std::ostream &os, enum ${th.make_enum_name(n, tags, obj)} value) {
-        os << UR_MAJOR_VERSION(value) << "." << UR_MINOR_VERSION(value);
-        return os;
-    }
-    %else:
-    inline std::ostream &operator<<(std::ostream &os, enum ${th.make_enum_name(n, tags, obj)} value) {
-        switch (value) {
-            %for n, item in enumerate(obj['etors']):
-                <%
-                ename = th.make_etor_name(n, tags, obj['name'], item['name'])
-                %>case ${ename}:
-                    os << "${ename}";
-                    break;
-            %endfor
-                default:
-                    os << "unknown enumerator";
-                    break;
-        }
-        return os;
-    }
-    %endif
     %if obj.get('typed_etors', False) is True:
-    namespace ${x}::details {
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Print ${th.make_enum_name(n, tags, obj)} enum value
     template <>
-    inline ${x}_result_t printTagged(std::ostream &os, const void *ptr, ${th.make_enum_name(n, tags, obj)} value, size_t size) {
+    inline ${x}_result_t printTagged(buffer_t &buf, const void *ptr, ${th.make_enum_name(n, tags, obj)} value, size_t size) {
         if (ptr == NULL) {
-            return printPtr(os, ptr);
+            return printPtr(buf, ptr);
         }
 
         switch (value) {
@@ -227,19 +460,19 @@ template <typename T> inline ${x}_result_t printTagged(std::ostream &os, const v
                     const ${atype} *tptr = (const ${atype} *)ptr;
                     %endif
                         %if "char" in atype: ## print char* arrays as simple NULL-terminated strings
-                            printPtr(os, tptr);
+                            printPtr(buf, tptr);
                         %else:
-                            os << "{";
+                            buf.put('{');
                             size_t nelems = size / sizeof(${atype});
                             for (size_t i = 0; i < nelems; ++i) {
                                 if (i != 0) {
-                                    os << ", ";
+                                    buf.write(", ");
                                 }
                                 <%call expr="member(tptr, atype, True)">
                                     tptr[i]
                                 </%call>
                             }
-                            os << "}";
+                            buf.put('}');
                         %endif
                     %else:
                     %if 'void' in vtype:
@@ -248,32 +481,35 @@ template <typename T> inline ${x}_result_t printTagged(std::ostream &os, const v
                     const ${vtype} *tptr = (const ${vtype} *)ptr;
                     %endif
                     if (sizeof(${vtype}) > size) {
-                        os << "invalid size (is: " << size << ", expected: >=" << sizeof(${vtype}) << ")";
+                        buf.write("invalid size (is: ");
+                        writeUnsigned(buf, size);
+                        buf.write(", expected: >=");
+                        writeUnsigned(buf, sizeof(${vtype}));
+                        buf.put(')');
                         return ${X}_RESULT_ERROR_INVALID_SIZE;
                     }
-                    os << (const void *)(tptr) << " (";
+                    writePtr(buf, tptr);
+                    buf.write(" (");
                     <%call expr="member(tptr, vtype, False)">
                         *tptr
                     </%call>
-                    os << ")";
+                    buf.put(')');
                     %endif
                 } break;
             %endfor
                 default:
-                    os << "unknown enumerator";
+                    buf.write("unknown enumerator");
                     return ${X}_RESULT_ERROR_INVALID_ENUMERATION;
         }
         return ${X}_RESULT_SUCCESS;
     }
-    } // namespace ${x}::details
 
     %elif "structure_type" in obj['name']:
-    namespace ${x}::details {
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Print ${th.make_enum_name(n, tags, obj)} struct
-    inline ${x}_result_t printStruct(std::ostream &os, const void *ptr) {
+    inline ${x}_result_t printStruct(buffer_t &buf, const void *ptr) {
         if (ptr == NULL) {
-            return printPtr(os, ptr);
+            return printPtr(buf, ptr);
         }
 
         ## structure type enum value must be first
@@ -285,64 +521,23 @@ template <typename T> inline ${x}_result_t printTagged(std::ostream &os, const v
                 %>
                 case ${ename}: {
                     const ${th.subt(n, tags, item['desc'])} *pstruct = (const ${th.subt(n, tags, item['desc'])} *)ptr;
-                    printPtr(os, pstruct);
+                    printPtr(buf, pstruct);
                 } break;
             %endfor
                 default:
-                    os << "unknown enumerator";
+                    buf.write("unknown enumerator");
                     return ${X}_RESULT_ERROR_INVALID_ENUMERATION;
         }
         return ${X}_RESULT_SUCCESS;
     }
-    } // namespace ${x}::details
-    %endif
-    %if th.type_traits.is_flags(obj['name']):
 
-    namespace ${x}::details {
-    ///////////////////////////////////////////////////////////////////////////////
-    /// @brief Print ${th.make_enum_name(n, tags, obj)} flag
-    template<>
-    inline ${x}_result_t printFlag<${th.make_enum_name(n, tags, obj)}>(std::ostream &os, uint32_t flag) {
-        uint32_t val = flag;
-        bool first = true;
-        %for n, item in enumerate(obj['etors']):
-            <%
-            ename = th.make_etor_name(n, tags, obj['name'], item['name'])
-            %>
-            if ((val & ${ename}) == (uint32_t)${ename}) {
-                ## toggle the bits to avoid printing overlapping values
-                ## instead of e.g., FLAG_FOO | FLAG_BAR | FLAG_ALL, this will just
-                ## print FLAG_FOO | FLAG_BAR (or just FLAG_ALL, depending on order).
-                val ^= (uint32_t)${ename};
-                if (!first) {
-                    os << " | ";
-                } else {
-                    first = false;
-                }
-                os << ${ename};
-            }
-        %endfor
-        if (val != 0) {
-            std::bitset<32> bits(val);
-            if (!first) {
-                os << " | ";
-            }
-            os << "unknown bit flags " << bits;
-        } else if (first) {
-            os << "0";
-        }
-        return ${X}_RESULT_SUCCESS;
-    }
-    } // namespace ${x}::details
     %endif
 ## STRUCT #####################################################################
 %elif re.match(r"struct", obj['type']):
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ${th.make_type_name(n, tags, obj)} type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, const ${obj['type']} ${th.make_type_name(n, tags, obj)} params) {
-    os << "(${obj['type']} ${th.make_type_name(n, tags, obj)}){";
+/// @brief Print a ${th.make_type_name(n, tags, obj)} value
+inline void print(buffer_t &buf, const ${obj['type']} ${th.make_type_name(n, tags, obj)} params) {
+    buf.write("(${obj['type']} ${th.make_type_name(n, tags, obj)}){");
     <%
         mlist = obj['members']
         params_dict = dict()
@@ -354,21 +549,16 @@ inline std::ostream &operator<<(std::ostream &os, const ${obj['type']} ${th.make
     %for n, item in enumerate(mlist):
         ${line(item, n, False, params_dict)}
     %endfor
-    os << "}";
-    return os;
+    buf.put('}');
 }
+
 ## UNION ######################################################################
 %elif re.match(r"union", obj['type']) and obj['name']:
-namespace ${x}::details {
 <% tag = findUnionTag(obj) %>
-    ///////////////////////////////////////////////////////////////////////////////
-    // @brief Print ${th.make_type_name(n, tags, obj)} union
-    inline ${x}_result_t printUnion(
-    std::ostream &os,
-    const ${obj['type']} ${th.make_type_name(n, tags, obj)} params,
-    const ${tag['type']} ${th.make_type_name(n, tags, tag)} tag
-){
-    os << "(${obj['type']} ${th.make_type_name(n, tags, obj)}){";
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print a ${th.make_type_name(n, tags, obj)} value, whose member is selected by tag
+inline ${x}_result_t printUnion(buffer_t &buf, const ${obj['type']} ${th.make_type_name(n, tags, obj)} params, const ${tag['type']} ${th.make_type_name(n, tags, tag)} tag) {
+    buf.write("(${obj['type']} ${th.make_type_name(n, tags, obj)}){");
 <%
 params_dict = dict()
 for item in obj['members']:
@@ -376,32 +566,28 @@ for item in obj['members']:
     itype = th._get_type_name(n, tags, obj, item)
     params_dict[iname] = itype
 %>
-    switch(tag){
+    switch (tag) {
 %for mem in obj['members']:
     case ${th.subt(n, tags, mem['tag'])}:
         ${line(mem, 0, False, params_dict)}
         break;
 %endfor
     default:
-        os << "<unknown>";
+        buf.write("<unknown>");
         return ${X}_RESULT_ERROR_INVALID_ENUMERATION;
     }
-    os << "}";
+    buf.put('}');
     return ${X}_RESULT_SUCCESS;
 }
-} // namespace ${x}::details
+
 %endif
 %endfor # obj in spec['objects']
 %endfor
-
 %for tbl in th.get_pfncbtables(specs, meta, n, tags):
 %for obj in tbl['functions']:
-
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ${th.make_pfncb_param_type(n, tags, obj)} type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ${th.make_pfncb_param_type(n, tags, obj)} *params) {
+/// @brief Print the parameters of a ${th.make_func_name(n, tags, obj)} call
+inline void print([[maybe_unused]] buffer_t &buf, [[maybe_unused]] const struct ${th.make_pfncb_param_type(n, tags, obj)} *params) {
     <%
         params_dict = dict()
         for item in obj['params']:
@@ -412,9 +598,132 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     %for n, item in enumerate(obj['params']):
         ${line(item, n, True, params_dict)}
     %endfor
+}
+
+%endfor
+%endfor
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print function parameters into a buffer_t
+/// @returns
+///     - ::${X}_RESULT_SUCCESS
+///     - ::${X}_RESULT_ERROR_INVALID_ENUMERATION
+///     - ::${X}_RESULT_ERROR_INVALID_NULL_POINTER
+///         - `NULL == params`
+inline ${x}_result_t printFunctionParams(buffer_t &buf, ${x}_function_t function, const void *params) {
+    if (!params) {
+        return ${X}_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    switch (function) {
+    %for tbl in th.get_pfncbtables(specs, meta, n, tags):
+    %for obj in tbl['functions']:
+    case ${th.make_func_etor(n, tags, obj)}: {
+        print(buf, (const struct ${th.make_pfncb_param_type(n, tags, obj)} *)params);
+    } break;
+    %endfor
+    %endfor
+    default:
+        return ${X}_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    return ${X}_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print a pointer value followed by the value it points to, if any
+template <typename T>
+inline ${x}_result_t printPtr(buffer_t &buf, const T *ptr) {
+    if (ptr == nullptr) {
+        buf.write("nullptr");
+    } else if constexpr (std::is_pointer_v<T>) {
+        writePtr(buf, ptr);
+        buf.write(" (");
+        printPtr(buf, *ptr);
+        buf.put(')');
+    } else if constexpr (std::is_void_v<T> || ${x}::details::is_handle_v<T *>) {
+        writePtr(buf, ptr);
+    } else if constexpr (std::is_same_v<std::remove_cv_t<T>, char>) {
+        writePtr(buf, ptr);
+        buf.write(" (");
+        buf.write(ptr);
+        buf.put(')');
+    } else {
+        writePtr(buf, ptr);
+        buf.write(" (");
+        print(buf, *ptr);
+        buf.put(')');
+    }
+
+    return ${X}_RESULT_SUCCESS;
+}
+
+namespace details {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Run a printer on a buffer_t and write its output to the stream
+template <typename F>
+inline std::invoke_result_t<F, buffer_t &> printToStream(std::ostream &os, F &&printer) {
+    std::string storage;
+    auto buf = stringBuffer(storage);
+    if constexpr (std::is_void_v<std::invoke_result_t<F, buffer_t &>>) {
+        printer(buf);
+        os << buf.str();
+    } else {
+        auto result = printer(buf);
+        os << buf.str();
+        return result;
+    }
+}
+} // namespace details
+} // namespace ${x}::writer
+
+## Stream printers #############################################################
+%for spec in specs:
+%for obj in spec['objects']:
+## ENUM #######################################################################
+%if re.match(r"enum", obj['type']):
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ${th.make_enum_name(n, tags, obj)} type
+/// @returns
+///     std::ostream &
+%if "api_version" in obj['name']:
+inline std::ostream &operator<<(std::ostream &os, enum ${th.make_enum_name(n, tags, obj)} value) {
+    os << UR_MAJOR_VERSION(value) << "." << UR_MINOR_VERSION(value);
+    return os;
+}
+%else:
+inline std::ostream &operator<<(std::ostream &os, enum ${th.make_enum_name(n, tags, obj)} value) {
+    auto name = ${x}::writer::toString(value);
+    if (name.empty()) {
+        os << "unknown enumerator";
+    } else {
+        os << name;
+    }
     return os;
 }
+%endif
+## STRUCT #####################################################################
+%elif re.match(r"struct", obj['type']):
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ${th.make_type_name(n, tags, obj)} type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, const ${obj['type']} ${th.make_type_name(n, tags, obj)} params) {
+    ${x}::writer::details::printToStream(os, [&](${x}::writer::buffer_t &buf) { ${x}::writer::print(buf, params); });
+    return os;
+}
+%endif
+%endfor # obj in spec['objects']
+%endfor
 
+%for tbl in th.get_pfncbtables(specs, meta, n, tags):
+%for obj in tbl['functions']:
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ${th.make_pfncb_param_type(n, tags, obj)} type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ${th.make_pfncb_param_type(n, tags, obj)} *params) {
+    ${x}::writer::details::printToStream(os, [&](${x}::writer::buffer_t &buf) { ${x}::writer::print(buf, params); });
+    return os;
+}
 %endfor
 %endfor
 
@@ -427,26 +736,33 @@ namespace ${x}::details {
 ///////////////////////////////////////////////////////////////////////////////
 // @brief Print pointer value
 template <typename T> inline ${x}_result_t printPtr(std::ostream &os, const T *ptr) {
-    if (ptr == nullptr) {
-        os << "nullptr";
-    } else if constexpr (std::is_pointer_v<T>) {
-        os << (const void *)(ptr) << " (";
-        printPtr(os, *ptr);
-        os << ")";
-    } else if constexpr (std::is_void_v<T> || is_handle_v<T *>) {
-        os << (const void *)ptr;
-    } else if constexpr (std::is_same_v<std::remove_cv_t< T >, char>) {
-        os << (const void *)(ptr) << " (";
-        os << ptr;
-        os << ")";
-    } else {
-        os << (const void *)(ptr) << " (";
-        os << *ptr;
-        os << ")";
-    }
+    return ${x}::writer::details::printToStream(os, [&](${x}::writer::buffer_t &buf) { return ${x}::writer::printPtr(buf, ptr); });
+}
 
+///////////////////////////////////////////////////////////////////////////////
+// @brief Print flag value
+template <typename T> inline ${x}_result_t printFlag(std::ostream &os, uint32_t flag) {
+    ${x}::writer::details::printToStream(os, [&](${x}::writer::buffer_t &buf) { ${x}::writer::printFlag<T>(buf, flag); });
     return ${X}_RESULT_SUCCESS;
 }
+
+///////////////////////////////////////////////////////////////////////////////
+// @brief Print the value pointed to by ptr, whose type is selected by value
+template <typename T> inline ${x}_result_t printTagged(std::ostream &os, const void *ptr, T value, size_t size) {
+    return ${x}::writer::details::printToStream(os, [&](${x}::writer::buffer_t &buf) { return ${x}::writer::printTagged(buf, ptr, value, size); });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// @brief Print the struct pointed to by ptr, whose type is its first member
+inline ${x}_result_t printStruct(std::ostream &os, const void *ptr) {
+    return ${x}::writer::details::printToStream(os, [&](${x}::writer::buffer_t &buf) { return ${x}::writer::printStruct(buf, ptr); });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// @brief Print a union value, whose member is selected by tag
+template <typename T, typename Tag> inline ${x}_result_t printUnion(std::ostream &os, const T params, const Tag tag) {
+    return ${x}::writer::details::printToStream(os, [&](${x}::writer::buffer_t &buf) { return ${x}::writer::printUnion(buf, params, tag); });
+}
 } // namespace ${x}::details
 
 namespace ${x}::extras {
@@ -457,22 +773,8 @@ namespace ${x}::extras {
 ///     - ::${X}_RESULT_ERROR_INVALID_ENUMERATION
 ///     - ::${X}_RESULT_ERROR_INVALID_NULL_POINTER
 ///         - `NULL == params`
-inline ${x}_result_t ${X}_APICALL printFunctionParams(std::ostream &os, ur_function_t function, const void *params) {
-    if (!params) {
-        return ${X}_RESULT_ERROR_INVALID_NULL_POINTER;
-    }
-
-    switch(function) {
-    %for tbl in th.get_pfncbtables(specs, meta, n, tags):
-    %for obj in tbl['functions']:
-        case ${th.make_func_etor(n, tags, obj)}: {
-            os << (const struct ${th.make_pfncb_param_type(n, tags, obj)} *)params;
-        } break;
-    %endfor
-    %endfor
-        default: return ${X}_RESULT_ERROR_INVALID_ENUMERATION;
-    }
-    return ${X}_RESULT_SUCCESS;
+inline ${x}_result_t ${X}_APICALL printFunctionParams(std::ostream &os, ${x}_function_t function, const void *params) {
+    return ${x}::writer::details::printToStream(os, [&](${x}::writer::buffer_t &buf) { return ${x}::writer::printFunctionParams(buf, function, params); });
 }
 } // namespace ${x}::extras
 
@@ -22,12 +22,15 @@ from templates import helper as th
 #pragma once
 
 #include <ur_api.h>
+#include <ze_api.h>
 
 struct ur_queue_handle_t_ {
     virtual ~ur_queue_handle_t_();
 
     virtual void deferEventFree(ur_event_handle_t hEvent) = 0;
 
+    virtual ur_result_t enqueueCommandBuffer(ur_exp_command_buffer_handle_t, ur_event_handle_t *, uint32_t, const ur_event_handle_t *) = 0;
+
     %for obj in th.get_queue_related_functions(specs, n, tags):
     virtual ${x}_result_t ${th.transform_queue_related_function_name(n, tags, obj, format=["type"])} = 0;
     %endfor
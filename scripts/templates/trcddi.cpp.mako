@@ -53,8 +53,8 @@ namespace ur_tracing_layer
         getContext()->notify_end(${th.make_func_etor(n, tags, obj)}, "${th.make_func_name(n, tags, obj)}", &params, &result, instance);
 
         if (logger.getLevel() <= logger::Level::INFO) {
-            std::ostringstream args_str;
-            ur::extras::printFunctionParams(args_str, ${th.make_func_etor(n, tags, obj)}, &params);
+            auto args_str = ${x}::writer::stringBuffer(getArgsStorage());
+            ${x}::writer::printFunctionParams(args_str, ${th.make_func_etor(n, tags, obj)}, &params);
             logger.info("   <--- ${th.make_func_name(n, tags, obj)}({}) -> {};\n", args_str.str(), result);
         }
 
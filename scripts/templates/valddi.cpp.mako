@@ -53,7 +53,7 @@ namespace ur_validation_layer
             return ${X}_RESULT_ERROR_UNINITIALIZED;
         }
 
-        if( getContext()->enableParameterValidation )
+        if( getContext()->enableParameterChecks )
         {
             %for key, values in sorted_param_checks:
             %for val in values:
@@ -70,18 +70,20 @@ namespace ur_validation_layer
 
             %endfor
             %endfor
-            %if func_name in th.get_event_wait_list_functions(specs, n, tags):
-            if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-                for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                    if (phEventWaitList[i] == NULL) {
-                        return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                    }
+        }
+
+        %if func_name in th.get_event_wait_list_functions(specs, n, tags):
+        if( getContext()->enableWaitListChecks && phEventWaitList != NULL && numEventsInWaitList > 0 )
+        {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
                 }
             }
-            %endif
-
         }
 
+        %endif
+
             %for tp in tracked_params:
             <%
                 tp_input_handle_funcs = next((hf for hf in handle_create_get_retain_release_funcs if th.subt(n, tags, tp['type']) == hf['handle'] and "[in]" in tp['desc']), {})
@@ -210,6 +212,8 @@ namespace ur_validation_layer
             return result;
         }
 
+        applyCheckOptions();
+
         %for tbl in th.get_pfntables(specs, meta, n, tags):
         if ( ${X}_RESULT_SUCCESS == result )
         {
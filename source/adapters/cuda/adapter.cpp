@@ -85,6 +85,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urAdapterRelease(ur_adapter_handle_t) {
     disableCUDATracing(adapter.TracingCtx);
     freeCUDATracingContext(adapter.TracingCtx);
     adapter.TracingCtx = nullptr;
+    urLockStatsReport();
   }
   return UR_RESULT_SUCCESS;
 }
@@ -67,8 +67,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urAdapterGet(
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urAdapterRelease(ur_adapter_handle_t) {
-  // No state to clean up so we don't need to check for 0 references
-  adapter.RefCount--;
+  if (--adapter.RefCount == 0) {
+    urLockStatsReport();
+  }
   return UR_RESULT_SUCCESS;
 }
 
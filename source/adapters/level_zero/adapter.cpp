@@ -309,18 +309,6 @@ ur_adapter_handle_t_::ur_adapter_handle_t_()
   }
 
   PlatformCache.Compute = [](Result<PlatformVec> &result) {
-    static std::once_flag ZeCallCountInitialized;
-    try {
-      std::call_once(ZeCallCountInitialized, []() {
-        if (UrL0LeaksDebug) {
-          ZeCallCount = new std::map<std::string, int>;
-        }
-      });
-    } catch (...) {
-      result = exceptionToResult(std::current_exception());
-      return;
-    }
-
     uint32_t UserForcedSysManInit = 0;
     // Check if the user has disabled the default L0 Env initialization.
     const int UrSysManEnvInitEnabled = [&UserForcedSysManInit] {
@@ -518,10 +506,15 @@ void globalAdapterOnDemandCleanup() {
 }
 
 ur_result_t adapterStateTeardown() {
+  urLockStatsReport();
+
+  if (UrL0CallStats)
+    printZeCallStats();
+
   // Print the balance of various create/destroy native calls.
   // The idea is to verify if the number of create(+) and destroy(-) calls are
   // matched.
-  if (ZeCallCount && (UrL0LeaksDebug) != 0) {
+  if (UrL0LeaksDebug != 0) {
     bool LeakFound = false;
     // clang-format off
     //
@@ -567,10 +560,10 @@ ur_result_t adapterStateTeardown() {
     std::cerr << "----------------------------------------------------------\n";
     std::stringstream ss;
     for (const auto &Row : CreateDestroySet) {
-      int diff = 0;
+      int64_t diff = 0;
       for (auto I = Row.begin(); I != Row.end();) {
         const char *ZeName = (*I).c_str();
-        const auto &ZeCount = (*ZeCallCount)[*I];
+        const auto ZeCount = static_cast<int64_t>(ZeCallStats.getCalls(*I));
 
         bool First = (I == Row.begin());
         bool Last = (++I == Row.end());
@@ -602,9 +595,6 @@ ur_result_t adapterStateTeardown() {
       ss.clear();
     }
 
-    ZeCallCount->clear();
-    delete ZeCallCount;
-    ZeCallCount = nullptr;
     if (LeakFound)
       return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
   }
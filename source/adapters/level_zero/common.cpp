@@ -13,6 +13,9 @@
 #include "usm.hpp"
 #include <level_zero/include/ze_intel_gpu.h>
 
+#include <iomanip>
+#include <sstream>
+
 ur_result_t ze2urResult(ze_result_t ZeResult) {
   if (ZeResult == ZE_RESULT_SUCCESS)
     return UR_RESULT_SUCCESS;
@@ -90,7 +93,7 @@ ZeUSMImportExtension ZeUSMImport;
 // TODO: remove the ifdef once
 // https://github.com/oneapi-src/unified-runtime/issues/1454 is implemented
 #ifndef UR_L0_CALL_COUNT_IN_TESTS
-std::map<std::string, int> *ZeCallCount = nullptr;
+ze_call_stats_t ZeCallStats;
 #endif
 
 inline void zeParseError(ze_result_t ZeError, const char *&ErrorString) {
@@ -142,13 +145,14 @@ inline void zeParseError(ze_result_t ZeError, const char *&ErrorString) {
   } // switch
 }
 
-ze_result_t ZeCall::doCall(ze_result_t ZeResult, const char *ZeName,
-                           const char *ZeArgs, bool TraceError) {
+ze_result_t ZeCall::doCall(ze_result_t ZeResult, ze_call_id_t ZeCallId,
+                           const char *ZeName, const char *ZeArgs,
+                           bool TraceError) {
   logger::debug("ZE ---> {}{}", ZeName, ZeArgs);
 
   if (ZeResult == ZE_RESULT_SUCCESS) {
-    if (UrL0LeaksDebug) {
-      ++(*ZeCallCount)[ZeName];
+    if (UrL0CallStats || UrL0LeaksDebug) {
+      ZeCallStats.countCall(ZeCallId);
     }
     return ZE_RESULT_SUCCESS;
   }
@@ -161,6 +165,46 @@ ze_result_t ZeCall::doCall(ze_result_t ZeResult, const char *ZeName,
   return ZeResult;
 }
 
+// Right-aligns the call names and the latency buckets in one column.
+static std::string alignStatsLabel(const std::string &Label) {
+  std::stringstream Stream;
+  Stream << std::setw(45) << std::right << Label;
+  return Stream.str();
+}
+
+void printZeCallStats() {
+  // Like the lock statistics, printed whatever the log level, because they
+  // have been asked for with UR_L0_CALL_STATS.
+  logger::always("Level Zero calls");
+  logger::always("----------------------------------------------------------");
+  for (uint32_t Id = 0; Id < ze_call_id_count; Id++) {
+    auto ZeCallId = static_cast<ze_call_id_t>(Id);
+    auto Calls = ZeCallStats.getCalls(ZeCallId);
+    if (Calls == 0) {
+      continue;
+    }
+    logger::always("{} = {}", alignStatsLabel(ZeCallNames[Id]), Calls);
+
+    if (UrL0CallStats < UrL0CallStatsLatency) {
+      continue;
+    }
+    // Calls taking less than 2^(Bucket + 1) ns, including failed ones. The
+    // last bucket has the calls taking longer than that.
+    for (size_t Bucket = 0; Bucket < ze_call_stats_t::NumLatencyBuckets;
+         Bucket++) {
+      auto Count = ZeCallStats.getLatencyCount(ZeCallId, Bucket);
+      if (Count == 0) {
+        continue;
+      }
+      bool Last = (Bucket == ze_call_stats_t::NumLatencyBuckets - 1);
+      auto Bound = Last ? (uint64_t{1} << Bucket) : (uint64_t{2} << Bucket);
+      std::string Label =
+          (Last ? ">= " : "< ") + std::to_string(Bound) + " ns";
+      logger::always("{} = {}", alignStatsLabel(Label), Count);
+    }
+  }
+}
+
 // Specializations for various L0 structures
 template <> ze_structure_type_t getZeStructureType<ze_event_pool_desc_t>() {
   return ZE_STRUCTURE_TYPE_EVENT_POOL_DESC;
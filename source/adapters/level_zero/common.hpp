@@ -10,6 +10,7 @@
 #pragma once
 
 #include <cassert>
+#include <chrono>
 #include <list>
 #include <map>
 #include <mutex>
@@ -26,6 +27,7 @@
 #include <umf_pools/disjoint_pool_config_parser.hpp>
 
 #include "logger/ur_logger.hpp"
+#include "ze_call_stats.hpp"
 
 struct _ur_platform_handle_t;
 
@@ -221,6 +223,21 @@ const int UrL0LeaksDebug = [] {
   return std::atoi(UrRet);
 }();
 
+// Controls the accounting of Level Zero calls, which is printed at teardown.
+// The calls are also counted to check for leaks with UR_L0_LEAKS_DEBUG.
+enum {
+  UrL0CallStatsNone = 0,    // no accounting
+  UrL0CallStatsCount = 1,   // number of calls of each entry point
+  UrL0CallStatsLatency = 2, // also latency histograms of each entry point
+};
+
+const int UrL0CallStats = [] {
+  const char *UrRet = std::getenv("UR_L0_CALL_STATS");
+  if (!UrRet)
+    return 0;
+  return std::atoi(UrRet);
+}();
+
 // Enable for UR L0 Adapter to Init all L0 Drivers on the system with filtering
 // in place for only currently used Drivers.
 const int UrL0InitAllDrivers = [] {
@@ -294,10 +311,41 @@ public:
   }
 
   // The non-static version just calls static one.
-  ze_result_t doCall(ze_result_t ZeResult, const char *ZeName,
-                     const char *ZeArgs, bool TraceError = true);
+  ze_result_t doCall(ze_result_t ZeResult, ze_call_id_t ZeCallId,
+                     const char *ZeName, const char *ZeArgs,
+                     bool TraceError = true);
 };
 
+// Measures the latency of a Level Zero call, when latency accounting is
+// enabled. It must be created before the call is evaluated, e.g. as the
+// object of a member call, which is sequenced before the arguments.
+class ZeCallTimer {
+public:
+  ZeCallTimer(ze_call_id_t ZeCallId) : ZeCallId(ZeCallId) {
+    if (UrL0CallStats >= UrL0CallStatsLatency) {
+      Start = std::chrono::steady_clock::now();
+    }
+  }
+
+  ze_result_t stop(ze_result_t ZeResult) {
+    if (UrL0CallStats >= UrL0CallStatsLatency) {
+      auto Elapsed = std::chrono::steady_clock::now() - Start;
+      ZeCallStats.countLatency(
+          ZeCallId,
+          std::chrono::duration_cast<std::chrono::nanoseconds>(Elapsed)
+              .count());
+    }
+    return ZeResult;
+  }
+
+private:
+  ze_call_id_t ZeCallId;
+  std::chrono::steady_clock::time_point Start;
+};
+
+// Prints the accounting of the Level Zero calls.
+void printZeCallStats();
+
 // This function will ensure compatibility with both Linux and Windows for
 // setting environment variables.
 bool setEnvVar(const char *name, const char *value);
@@ -340,25 +388,32 @@ bool setEnvVar(const char *name, const char *value);
 // Map Level Zero runtime error code to UR error code.
 ur_result_t ze2urResult(ze_result_t ZeResult);
 
+// Call to Level-Zero RT, timed if latency accounting is enabled
+#define ZE_CALL_TIMED(ZeName, ZeArgs)                                          \
+  ZeCallTimer(ZE_CALL_ID(ZeName)).stop(ZeName ZeArgs)
+
 // Trace a call to Level-Zero RT
 #define ZE2UR_CALL(ZeName, ZeArgs)                                             \
   {                                                                            \
-    ze_result_t ZeResult = ZeName ZeArgs;                                      \
-    if (auto Result = ZeCall().doCall(ZeResult, #ZeName, #ZeArgs, true))       \
+    ze_result_t ZeResult = ZE_CALL_TIMED(ZeName, ZeArgs);                      \
+    if (auto Result = ZeCall().doCall(ZeResult, ZE_CALL_ID(ZeName), #ZeName,   \
+                                      #ZeArgs, true))                          \
       return ze2urResult(Result);                                              \
   }
 
 // Trace a call to Level-Zero RT, throw on error
 #define ZE2UR_CALL_THROWS(ZeName, ZeArgs)                                      \
   {                                                                            \
-    ze_result_t ZeResult = ZeName ZeArgs;                                      \
-    if (auto Result = ZeCall().doCall(ZeResult, #ZeName, #ZeArgs, true))       \
+    ze_result_t ZeResult = ZE_CALL_TIMED(ZeName, ZeArgs);                      \
+    if (auto Result = ZeCall().doCall(ZeResult, ZE_CALL_ID(ZeName), #ZeName,   \
+                                      #ZeArgs, true))                          \
       throw ze2urResult(Result);                                               \
   }
 
 // Perform traced call to L0 without checking for errors
 #define ZE_CALL_NOCHECK(ZeName, ZeArgs)                                        \
-  ZeCall().doCall(ZeName ZeArgs, #ZeName, #ZeArgs, false)
+  ZeCall().doCall(ZE_CALL_TIMED(ZeName, ZeArgs), ZE_CALL_ID(ZeName), #ZeName,  \
+                  #ZeArgs, false)
 
 // This wrapper around std::atomic is created to limit operations with reference
 // counter and to make allowed operations more transparent in terms of
@@ -423,7 +478,7 @@ struct _ur_object {
   // access to Obj3 in a scope use the following approach:
   //   std::shared_lock Obj3Lock(Obj3->Mutex, std::defer_lock);
   //   std::scoped_lock LockAll(Obj1->Mutex, Obj2->Mutex, Obj3Lock);
-  ur_shared_mutex Mutex;
+  ur_shared_mutex Mutex{"ur_object"};
 
   // Indicates if we own the native handle or it came from interop that
   // asked to not transfer the ownership to SYCL RT.
@@ -511,9 +566,6 @@ public:
 // Helper wrapper for working with USM import extension in Level Zero.
 extern ZeUSMImportExtension ZeUSMImport;
 
-// This will count the calls to Level-Zero
-extern std::map<std::string, int> *ZeCallCount;
-
 // Some opencl extensions we know are supported by all Level Zero devices.
 constexpr char ZE_SUPPORTED_EXTENSIONS[] =
     "cl_khr_il_program cl_khr_subgroups cl_intel_subgroups "
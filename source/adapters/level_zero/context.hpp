@@ -88,11 +88,11 @@ struct ur_context_handle_t_ : _ur_object {
   // Mutex for the immediate command list. Per the Level Zero spec memory copy
   // operations submitted to an immediate command list are not allowed to be
   // called from simultaneous threads.
-  ur_mutex ImmediateCommandListMutex;
+  ur_mutex ImmediateCommandListMutex{"context.ImmediateCommandList"};
 
   // Mutex Lock for the Command List Cache. This lock is used to control both
   // compute and copy command list caches.
-  ur_mutex ZeCommandListCacheMutex;
+  ur_mutex ZeCommandListCacheMutex{"context.ZeCommandListCache"};
 
   // If context contains one device or sub-devices of the same device, we want
   // to save this device.
@@ -185,7 +185,7 @@ struct ur_context_handle_t_ : _ur_object {
 
   // Mutex to control operations on event pool caches and the helper maps
   // holding the current pool usage counts.
-  ur_mutex ZeEventPoolCacheMutex;
+  ur_mutex ZeEventPoolCacheMutex{"context.ZeEventPoolCache"};
 
   // Initialize the PI context.
   ur_result_t initialize();
@@ -381,7 +381,7 @@ private:
   };
 
   // Mutex to control operations on event caches.
-  ur_mutex EventCacheMutex;
+  ur_mutex EventCacheMutex{"context.EventCache"};
 
   // Caches for events.
   using EventCache = std::list<ur_event_handle_t>;
@@ -486,6 +486,25 @@ ur_result_t urEventGetInfo(
           UR_CALL(UrQueue->executeOpenCommandList(
               OpenCommandList->second.isCopy(UrQueue)));
         }
+
+        // A single query of the fence of a regular command list, or of the
+        // barrier of a completion batch, tells the completion of all its
+        // events. Retire those of the event's command list first so that
+        // polling the status of many events does not query each one of them.
+        bool Completed;
+        std::optional<ur_command_list_ptr_t> CommandList;
+        {
+          std::shared_lock<ur_shared_mutex> EventLock(Event->Mutex);
+          Completed = Event->Completed;
+          CommandList = Event->CommandList;
+        }
+        if (!Completed && CommandList &&
+            *CommandList != UrQueue->CommandListMap.end() &&
+            (!UrQueue->UsingImmCmdLists ||
+             (UrQueue->useCompletionBatching() &&
+              !UrQueue->isInOrderQueue()))) {
+          UR_CALL(resetSignalledCommandList(UrQueue, *CommandList));
+        }
       }
     }
 
@@ -811,7 +830,10 @@ urEventWait(uint32_t NumEvents, ///< [in] number of events in the event list
     }
   }
   std::unordered_set<ur_queue_handle_t> Queues;
-  for (uint32_t I = 0; I < NumEvents; I++) {
+  // Wait for the events from the last one, which is usually submitted last.
+  // Once it completes, the cleanup below finds the events submitted before
+  // it completed as well, without waiting for each of them.
+  for (uint32_t I = NumEvents; I-- > 0;) {
     {
       ur_event_handle_t_ *Event =
           ur_cast<ur_event_handle_t_ *>(EventWaitList[I]);
@@ -852,8 +874,12 @@ urEventWait(uint32_t NumEvents, ///< [in] number of events in the event list
                                 false /*SetEventCompleted*/);
           // For the case when we have out-of-order queue or regular command
           // lists its more efficient to check fences so put the queue in the
-          // set to cleanup later.
-          Queues.insert(Q);
+          // set to cleanup later. When more events are left to wait for, do
+          // it once right away, which may find them completed.
+          if (Queues.insert(Q).second && I > 0) {
+            std::unique_lock<ur_shared_mutex> Lock(Q->Mutex);
+            UR_CALL(resetCommandLists(Q));
+          }
         }
       }
     }
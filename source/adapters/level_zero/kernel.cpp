@@ -15,17 +15,18 @@
 
 #include "helpers/kernel_helpers.hpp"
 
-ur_result_t getZeKernel(ze_device_handle_t hDevice, ur_kernel_handle_t hKernel,
+ur_result_t getZeKernel(ur_device_handle_t hDevice, ur_kernel_handle_t hKernel,
                         ze_kernel_handle_t *phZeKernel) {
-  if (hKernel->ZeKernelMap.empty()) {
+  if (hKernel->ZeKernelsByDevice.empty()) {
     *phZeKernel = hKernel->ZeKernel;
   } else {
-    auto It = hKernel->ZeKernelMap.find(hDevice);
-    if (It == hKernel->ZeKernelMap.end()) {
+    auto DeviceId = hDevice->Id.value();
+    if (DeviceId >= hKernel->ZeKernelsByDevice.size() ||
+        !hKernel->ZeKernelsByDevice[DeviceId]) {
       /* kernel and queue don't match */
       return UR_RESULT_ERROR_INVALID_QUEUE;
     }
-    *phZeKernel = It->second;
+    *phZeKernel = hKernel->ZeKernelsByDevice[DeviceId];
   }
 
   return UR_RESULT_SUCCESS;
@@ -47,7 +48,7 @@ ur_result_t urKernelGetSuggestedLocalWorkSize(
   std::copy(pGlobalWorkSize, pGlobalWorkSize + workDim, GlobalWorkSize3D);
 
   ze_kernel_handle_t ZeKernel{};
-  UR_CALL(getZeKernel(hQueue->Device->ZeDevice, hKernel, &ZeKernel));
+  UR_CALL(getZeKernel(hQueue->Device, hKernel, &ZeKernel));
 
   UR_CALL(getSuggestedLocalWorkSize(hQueue->Device, ZeKernel, GlobalWorkSize3D,
                                     LocalWorkSize));
@@ -90,7 +91,7 @@ ur_result_t urEnqueueKernelLaunch(
   UR_ASSERT(WorkDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
 
   ze_kernel_handle_t ZeKernel{};
-  UR_CALL(getZeKernel(Queue->Device->ZeDevice, Kernel, &ZeKernel));
+  UR_CALL(getZeKernel(Queue->Device, Kernel, &ZeKernel));
 
   // Lock automatically releases when this goes out of scope.
   std::scoped_lock<ur_shared_mutex, ur_shared_mutex, ur_shared_mutex> Lock(
@@ -235,19 +236,9 @@ ur_result_t urEnqueueCooperativeKernelLaunchExp(
   UR_ASSERT(WorkDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
   UR_ASSERT(WorkDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
 
-  auto ZeDevice = Queue->Device->ZeDevice;
-
   ze_kernel_handle_t ZeKernel{};
-  if (Kernel->ZeKernelMap.empty()) {
-    ZeKernel = Kernel->ZeKernel;
-  } else {
-    auto It = Kernel->ZeKernelMap.find(ZeDevice);
-    if (It == Kernel->ZeKernelMap.end()) {
-      /* kernel and queue don't match */
-      return UR_RESULT_ERROR_INVALID_QUEUE;
-    }
-    ZeKernel = It->second;
-  }
+  UR_CALL(getZeKernel(Queue->Device, Kernel, &ZeKernel));
+
   // Lock automatically releases when this goes out of scope.
   std::scoped_lock<ur_shared_mutex, ur_shared_mutex, ur_shared_mutex> Lock(
       Queue->Mutex, Kernel->Mutex, Kernel->Program->Mutex);
@@ -588,6 +579,10 @@ ur_result_t urKernelCreate(
     return UR_RESULT_ERROR_UNKNOWN;
   }
 
+  // Kernels created for each device, it may contain duplicated kernel entries
+  // for a root device and its sub-devices.
+  std::unordered_map<ze_device_handle_t, ze_kernel_handle_t> ZeKernelMap;
+
   for (auto &Dev : Program->AssociatedDevices) {
     auto ZeDevice = Dev->ZeDevice;
     // Program may be associated with all devices from the context but built
@@ -613,7 +608,7 @@ ur_result_t urKernelCreate(
     // Store the kernel in the ZeKernelMap so the correct
     // kernel can be retrieved later for a specific device
     // where a queue is being submitted.
-    (*RetKernel)->ZeKernelMap[ZeDevice] = ZeKernel;
+    ZeKernelMap[ZeDevice] = ZeKernel;
     (*RetKernel)->ZeKernels.push_back(ZeKernel);
 
     // If the device used to create the module's kernel is a root-device
@@ -624,14 +619,29 @@ ur_result_t urKernelCreate(
     std::vector<ze_device_handle_t> ZeSubDevices(SubDevicesCount);
     zeDeviceGetSubDevices(ZeDevice, &SubDevicesCount, ZeSubDevices.data());
     for (auto ZeSubDevice : ZeSubDevices) {
-      (*RetKernel)->ZeKernelMap[ZeSubDevice] = ZeKernel;
+      ZeKernelMap[ZeSubDevice] = ZeKernel;
     }
   }
   // There is no any successfully built executable for program.
-  if ((*RetKernel)->ZeKernelMap.empty())
+  if (ZeKernelMap.empty())
     return UR_RESULT_ERROR_INVALID_PROGRAM_EXECUTABLE;
 
-  (*RetKernel)->ZeKernel = (*RetKernel)->ZeKernelMap.begin()->second;
+  // Index the kernels by the Id of every UR device with a matching L0 device,
+  // e.g. the sub-sub-devices of a sub-device, so that launches don't need to
+  // look the kernel up in a map.
+  {
+    auto Platform = Program->Context->getPlatform();
+    std::shared_lock<ur_shared_mutex> Lock(Platform->URDevicesCacheMutex);
+    auto &ZeKernelsByDevice = (*RetKernel)->ZeKernelsByDevice;
+    ZeKernelsByDevice.assign(Platform->URDevicesCache.size(), nullptr);
+    for (auto &Device : Platform->URDevicesCache) {
+      auto It = ZeKernelMap.find(Device->ZeDevice);
+      if (It != ZeKernelMap.end())
+        ZeKernelsByDevice[Device->Id.value()] = It->second;
+    }
+  }
+
+  (*RetKernel)->ZeKernel = ZeKernelMap.begin()->second;
 
   UR_CALL((*RetKernel)->initialize());
 
@@ -669,13 +679,13 @@ ur_result_t urKernelSetArgValue(
 
   std::scoped_lock<ur_shared_mutex> Guard(Kernel->Mutex);
   ze_result_t ZeResult = ZE_RESULT_SUCCESS;
-  if (Kernel->ZeKernelMap.empty()) {
+  if (Kernel->ZeKernelsByDevice.empty()) {
     auto ZeKernel = Kernel->ZeKernel;
     ZeResult = ZE_CALL_NOCHECK(zeKernelSetArgumentValue,
                                (ZeKernel, ArgIndex, ArgSize, PArgValue));
   } else {
-    for (auto It : Kernel->ZeKernelMap) {
-      auto ZeKernel = It.second;
+    // Each kernel is set once, even if it is shared by sub-devices.
+    for (auto ZeKernel : Kernel->ZeKernels) {
       ZeResult = ZE_CALL_NOCHECK(zeKernelSetArgumentValue,
                                  (ZeKernel, ArgIndex, ArgSize, PArgValue));
     }
@@ -803,10 +813,9 @@ ur_result_t urKernelGetGroupInfo(
     // Set the Kernel to use as the ZeKernel initally for native handle support.
     // This makes the assumption that this device is the same device where this
     // kernel was created.
-    auto ZeKernelDevice = Kernel->ZeKernel;
-    auto It = Kernel->ZeKernelMap.find(Device->ZeDevice);
-    if (It != Kernel->ZeKernelMap.end()) {
-      ZeKernelDevice = Kernel->ZeKernelMap[Device->ZeDevice];
+    ze_kernel_handle_t ZeKernelDevice{};
+    if (getZeKernel(Device, Kernel, &ZeKernelDevice) != UR_RESULT_SUCCESS) {
+      ZeKernelDevice = Kernel->ZeKernel;
     }
     if (ZeKernelDevice) {
       auto ZeResult = ZE_CALL_NOCHECK(zeKernelGetProperties,
@@ -905,7 +914,7 @@ ur_result_t urKernelRelease(
         return ze2urResult(ZeResult);
     }
   }
-  Kernel->ZeKernelMap.clear();
+  Kernel->ZeKernelsByDevice.clear();
   if (IndirectAccessTrackingEnabled) {
     UR_CALL(ur::level_zero::urContextRelease(KernelProgram->Context));
   }
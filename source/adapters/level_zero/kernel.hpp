@@ -36,13 +36,14 @@ struct ur_kernel_handle_t_ : _ur_object {
   // Level Zero function handle.
   ze_kernel_handle_t ZeKernel;
 
-  // Map of L0 kernels created for all the devices for which a UR Program
-  // has been built. It may contain duplicated kernel entries for a root
-  // device and its sub-devices.
-  std::unordered_map<ze_device_handle_t, ze_kernel_handle_t> ZeKernelMap;
+  // L0 kernels created for all the devices for which a UR Program has been
+  // built, indexed by the Id of the device. It may contain duplicated kernel
+  // entries for a root device and its sub-devices, the entries of the other
+  // devices are null. It is empty for a kernel created from a native handle.
+  std::vector<ze_kernel_handle_t> ZeKernelsByDevice;
 
   // Vector of L0 kernels. Each entry is unique, so this is used for
-  // destroying the kernels instead of ZeKernelMap
+  // destroying the kernels instead of ZeKernelsByDevice
   std::vector<ze_kernel_handle_t> ZeKernels;
 
   // Counter to track the number of submissions of the kernel.
@@ -108,5 +109,5 @@ struct ur_kernel_handle_t_ : _ur_object {
   ZeCache<std::string> ZeKernelName;
 };
 
-ur_result_t getZeKernel(ze_device_handle_t hDevice, ur_kernel_handle_t hKernel,
+ur_result_t getZeKernel(ur_device_handle_t hDevice, ur_kernel_handle_t hKernel,
                         ze_kernel_handle_t *phZeKernel);
@@ -64,7 +64,7 @@ struct ur_platform_handle_t_ : public _ur_platform {
 
   // Cache UR devices for reuse
   std::vector<std::unique_ptr<ur_device_handle_t_>> URDevicesCache;
-  ur_shared_mutex URDevicesCacheMutex;
+  ur_shared_mutex URDevicesCacheMutex{"platform.URDevicesCache"};
   bool DeviceCachePopulated = false;
 
   // Check the device cache and load it if necessary.
@@ -89,7 +89,7 @@ struct ur_platform_handle_t_ : public _ur_platform {
   // TODO: should be deleted when memory isolation in the context is implemented
   // in the driver.
   std::list<ur_context_handle_t> Contexts;
-  ur_shared_mutex ContextsMutex;
+  ur_shared_mutex ContextsMutex{"platform.Contexts"};
 
   // Structure with function pointers for mutable command list extension.
   // Not all drivers may support it, so considering that the platform object is
@@ -106,11 +106,12 @@ struct ur_program_handle_t_ : _ur_object {
     return DeviceDataMap[ZeDevice].State;
   }
 
-  ze_module_handle_t getZeModuleHandle(ze_device_handle_t ZeDevice) {
-    if (DeviceDataMap.find(ZeDevice) == DeviceDataMap.end())
+  ze_module_handle_t getZeModuleHandle(ze_device_handle_t ZeDevice) const {
+    auto It = DeviceDataMap.find(ZeDevice);
+    if (It == DeviceDataMap.end())
       return InteropZeModule;
 
-    return DeviceDataMap[ZeDevice].ZeModule;
+    return It->second.ZeModule;
   }
 
   uint8_t *getCode(ze_device_handle_t ZeDevice = nullptr) {
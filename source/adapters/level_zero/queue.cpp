@@ -40,18 +40,25 @@ static const uint64_t CompletionEventsPerBatch = [] {
       .value_or(256);
 }();
 
+// Bounds of the number of events per batch, which adapts to how fast the
+// batches complete starting from CompletionEventsPerBatch.
+static const uint64_t CompletionEventsPerBatchMin =
+    std::max<uint64_t>(CompletionEventsPerBatch / 4, 1);
+static const uint64_t CompletionEventsPerBatchMax =
+    CompletionEventsPerBatch * 16;
+
 ur_completion_batch::ur_completion_batch()
-    : barrierEvent(nullptr), st(EMPTY), numEvents(0) {}
+    : barrierEvent(nullptr), st(EMPTY), numEvents(0), numQueries(0) {}
 
 ur_completion_batch::~ur_completion_batch() {
   if (barrierEvent)
     urEventReleaseInternal(barrierEvent);
 }
 
-bool ur_completion_batch::isFull() {
+bool ur_completion_batch::isFull(size_t eventsPerBatch) {
   assert(st == ACCUMULATING);
 
-  return numEvents >= CompletionEventsPerBatch;
+  return numEvents >= eventsPerBatch;
 }
 
 void ur_completion_batch::append() {
@@ -62,6 +69,7 @@ void ur_completion_batch::append() {
 ur_result_t ur_completion_batch::reset() {
   st = EMPTY;
   numEvents = 0;
+  numQueries = 0;
 
   // we reuse the UR event handle but reset the internal level-zero one
   if (barrierEvent)
@@ -77,6 +85,8 @@ void ur_completion_batch::use() {
 
 ur_completion_batch::state ur_completion_batch::getState() { return st; }
 
+size_t ur_completion_batch::getNumQueries() { return numQueries; }
+
 ur_completion_batch::state ur_completion_batch::queryState() {
   if (st == SEALED) {
     checkComplete();
@@ -91,6 +101,7 @@ bool ur_completion_batch::checkComplete() {
   if (st == COMPLETED)
     return true;
 
+  numQueries++;
   auto zeResult = ZE_CALL_NOCHECK(zeEventQueryStatus, (barrierEvent->ZeEvent));
   if (zeResult == ZE_RESULT_SUCCESS) {
     st = COMPLETED;
@@ -155,6 +166,13 @@ ur_result_t ur_completion_batches::cleanup(
   while (!sealed.empty()) {
     auto oldest_sealed = sealed.front();
     if (oldest_sealed->queryState() == ur_completion_batch::COMPLETED) {
+      // A batch that completed by the first time it was checked means that
+      // the device keeps up with the host, smaller batches then let the
+      // events be released sooner.
+      if (oldest_sealed->getNumQueries() <= 1) {
+        eventsPerBatch = std::max(eventsPerBatch - eventsPerBatch / 4,
+                                  CompletionEventsPerBatchMin);
+      }
       sealed.pop();
       moveCompletedEvents(oldest_sealed, events, EventListToCleanup);
       UR_CALL(oldest_sealed->reset());
@@ -183,7 +201,8 @@ ur_completion_batches::findFirstEmptyBatchOrCreate() {
   return std::nullopt;
 }
 
-ur_completion_batches::ur_completion_batches() {
+ur_completion_batches::ur_completion_batches()
+    : eventsPerBatch(CompletionEventsPerBatch) {
   // Batches are created lazily on-demand. Start with just one.
   active = batches.emplace(batches.begin());
   active->use();
@@ -195,9 +214,14 @@ ur_result_t ur_completion_batches::tryCleanup(
     std::vector<ur_event_handle_t> &EventListToCleanup) {
   cleanup(events, EventListToCleanup);
 
-  if (active->isFull()) {
+  if (active->isFull(eventsPerBatch)) {
     auto next_batch = findFirstEmptyBatchOrCreate();
     if (!next_batch) {
+      // All the batches are still in flight, the events are then checked one
+      // by one until one completes. Fewer and larger batches make this less
+      // likely.
+      eventsPerBatch =
+          std::min(eventsPerBatch * 2, CompletionEventsPerBatchMax);
       return UR_RESULT_ERROR_OUT_OF_RESOURCES; // EWOULDBLOCK
     }
 
@@ -347,6 +371,28 @@ ur_result_t resetCommandLists(ur_queue_handle_t Queue) {
   return UR_RESULT_SUCCESS;
 }
 
+/// @brief Reset one command list of the queue if it has been signalled, or
+/// cleanup its completed events if it is an immediate command list. Queue
+/// must be locked by the caller for modification.
+/// @param Queue Queue owning the command list.
+/// @param CommandList Command list to check.
+/// @return PI_SUCCESS if successful, PI error code otherwise.
+ur_result_t resetSignalledCommandList(ur_queue_handle_t Queue,
+                                     ur_command_list_ptr_t CommandList) {
+  std::vector<ur_event_handle_t> EventListToCleanup;
+  if (CommandList->second.ZeFence != nullptr) {
+    if (!CommandList->second.ZeFenceInUse)
+      return UR_RESULT_SUCCESS;
+    ze_result_t ZeResult =
+        ZE_CALL_NOCHECK(zeFenceQueryStatus, (CommandList->second.ZeFence));
+    if (ZeResult != ZE_RESULT_SUCCESS)
+      return UR_RESULT_SUCCESS;
+  }
+  UR_CALL(Queue->resetCommandList(CommandList, true, EventListToCleanup));
+  CleanupEventListFromResetCmdList(EventListToCleanup, true /*locked*/);
+  return UR_RESULT_SUCCESS;
+}
+
 namespace ur::level_zero {
 
 ur_result_t urQueueGetInfo(
@@ -58,12 +58,16 @@ struct ur_completion_batch {
   // underlying barrier event.
   state queryState();
 
+  // Returns how many times the barrier event was queried since the batch was
+  // sealed.
+  size_t getNumQueries();
+
   // Must be called on any completion batch prior to being used for events.
   void use();
 
   // Checks whether the batch is at capacity. This is a soft limit and can be
   // exceeded if necessary.
-  bool isFull();
+  bool isFull(size_t eventsPerBatch);
 
   // Appends an event to the batch.
   void append();
@@ -90,6 +94,9 @@ private:
 
   // Number of accumulated events.
   size_t numEvents;
+
+  // Number of queries of the barrier event.
+  size_t numQueries;
 };
 
 // A collection of event completion batches. Manages querying event status
@@ -147,6 +154,10 @@ private:
   ur_completion_batch_list batches;
   std::queue<ur_completion_batch_it> sealed;
   ur_completion_batch_it active;
+
+  // Number of events after which the active batch is sealed. Grows when all
+  // the batches are in flight and shrinks when batches complete quickly.
+  uint64_t eventsPerBatch;
 };
 
 ur_result_t resetCommandLists(ur_queue_handle_t Queue);
@@ -224,6 +235,9 @@ using ur_command_list_map_t =
 // The iterator pointing to a specific command-list in use.
 using ur_command_list_ptr_t = ur_command_list_map_t::iterator;
 
+ur_result_t resetSignalledCommandList(ur_queue_handle_t Queue,
+                                     ur_command_list_ptr_t CommandList);
+
 struct ur_queue_handle_t_ : _ur_object {
   ur_queue_handle_t_(std::vector<ze_command_queue_handle_t> &ComputeQueues,
                      std::vector<ze_command_queue_handle_t> &CopyQueues,
@@ -0,0 +1,1099 @@
+//===--------- command_buffer.cpp - Level Zero Adapter -------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "command_buffer.hpp"
+#include "context.hpp"
+#include "event.hpp"
+#include "kernel.hpp"
+#include "loader/ze_loader.h"
+#include "memory.hpp"
+#include "queue_api.hpp"
+
+#include "../common/latency_tracker.hpp"
+#include "../helpers/kernel_helpers.hpp"
+#include "../helpers/memory_helpers.hpp"
+#include "../platform.hpp"
+#include "../ur_interface_loader.hpp"
+
+#include <variant>
+
+ur_exp_command_buffer_handle_t_::ur_exp_command_buffer_handle_t_(
+    ur_context_handle_t hContext, ur_device_handle_t hDevice,
+    v2::raii::command_list_unique_handle commandList,
+    const ur_exp_command_buffer_desc_t *pDesc)
+    : hContext(hContext), hDevice(hDevice),
+      isUpdatable(pDesc && pDesc->isUpdatable),
+      isInOrder(pDesc && pDesc->isInOrder),
+      isProfilingEnabled(pDesc && pDesc->enableProfiling),
+      commandList(std::move(commandList)) {
+  hContext->retain();
+}
+
+ur_exp_command_buffer_handle_t_::~ur_exp_command_buffer_handle_t_() {
+  if (waitForLastSubmission() != UR_RESULT_SUCCESS) {
+    logger::error("Failed to wait for the last enqueue of a command-buffer");
+  }
+  setLastSubmission(nullptr, nullptr);
+
+  // Regular command lists are returned to the cache as they are.
+  ZE_CALL_NOCHECK(zeCommandListReset, (commandList.get()));
+
+  commands.clear();
+  for (auto hKernel : kernels) {
+    ur::level_zero::urKernelRelease(hKernel);
+  }
+  for (auto &memAccess : memAccesses) {
+    ur::level_zero::urMemRelease(memAccess.hMem);
+  }
+  commandList.reset();
+
+  hContext->release();
+}
+
+ur_result_t ur_exp_command_buffer_handle_t_::checkAppend(
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, ur_event_handle_t *phEvent) const {
+  if (isFinalized) {
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+  }
+
+  for (uint32_t i = 0; i < numSyncPointsInWaitList; i++) {
+    if (pSyncPointWaitList[i] >= numSyncPoints) {
+      return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+    }
+  }
+
+  // UR_DEVICE_INFO_COMMAND_BUFFER_EVENT_SUPPORT_EXP is not reported.
+  if (numEventsInWaitList > 0 || phEvent) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_exp_command_buffer_sync_point_t
+ur_exp_command_buffer_handle_t_::nextSyncPoint() {
+  return numSyncPoints++;
+}
+
+void ur_exp_command_buffer_handle_t_::retainKernel(ur_kernel_handle_t hKernel) {
+  ur::level_zero::urKernelRetain(hKernel);
+  kernels.push_back(hKernel);
+}
+
+void ur_exp_command_buffer_handle_t_::recordMemAccess(
+    ur_mem_handle_t hMem, ur_mem_handle_t_::device_access_mode_t access,
+    size_t offset, size_t size) {
+  for (auto &memAccess : memAccesses) {
+    if (memAccess.hMem == hMem && memAccess.access == access &&
+        memAccess.offset == offset && memAccess.size == size) {
+      return;
+    }
+  }
+
+  ur::level_zero::urMemRetain(hMem);
+  memAccesses.push_back({hMem, access, offset, size});
+}
+
+void ur_exp_command_buffer_handle_t_::prepareForSubmission(
+    const std::function<void(void *src, void *dst, size_t)> &migrate,
+    wait_list_view waitList) {
+  for (auto &memAccess : memAccesses) {
+    std::scoped_lock<ur_shared_mutex> lock(memAccess.hMem->getMutex());
+    memAccess.hMem->getDevicePtr(hDevice, memAccess.access, memAccess.offset,
+                                 memAccess.size, migrate, waitList);
+  }
+}
+
+ur_result_t ur_exp_command_buffer_handle_t_::waitForLastSubmission() {
+  if (lastSubmission) {
+    ZE2UR_CALL(zeEventHostSynchronize,
+               (lastSubmission->getZeEvent(), UINT64_MAX));
+    lastSubmission->markCompleted();
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+void ur_exp_command_buffer_handle_t_::setLastSubmission(
+    ur_queue_handle_t hQueue, ur_event_handle_t hEvent) {
+  if (lastSubmission) {
+    lastSubmission->release();
+    lastSubmissionQueue->queueRelease();
+  }
+  if (hQueue) {
+    hQueue->queueRetain();
+  }
+  lastSubmission = hEvent;
+  lastSubmissionQueue = hQueue;
+}
+
+ur_exp_command_buffer_command_handle_t_::
+    ur_exp_command_buffer_command_handle_t_(
+        ur_exp_command_buffer_handle_t hCommandBuffer, uint64_t commandId,
+        ur_kernel_handle_t hKernel, uint32_t workDim,
+        bool userDefinedLocalSize)
+    : hCommandBuffer(hCommandBuffer), commandId(commandId), hKernel(hKernel),
+      workDim(workDim), userDefinedLocalSize(userDefinedLocalSize) {}
+
+static ur_result_t
+appendGenericCopyUnlocked(ur_exp_command_buffer_handle_t hCommandBuffer,
+                          ur_mem_handle_t src, ur_mem_handle_t dst,
+                          size_t srcOffset, size_t dstOffset, size_t size) {
+  auto pSrc = ur_cast<char *>(
+      src->getDeviceAllocationPtr(hCommandBuffer->hDevice, srcOffset));
+  auto pDst = ur_cast<char *>(
+      dst->getDeviceAllocationPtr(hCommandBuffer->hDevice, dstOffset));
+
+  ZE2UR_CALL(zeCommandListAppendMemoryCopy,
+             (hCommandBuffer->getZeCommandList(), pDst, pSrc, size, nullptr,
+              0, nullptr));
+
+  return UR_RESULT_SUCCESS;
+}
+
+static ur_result_t appendRegionCopyUnlocked(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t src,
+    ur_mem_handle_t dst, ur_rect_offset_t srcOrigin, ur_rect_offset_t dstOrigin,
+    ur_rect_region_t region, size_t srcRowPitch, size_t srcSlicePitch,
+    size_t dstRowPitch, size_t dstSlicePitch) {
+  auto zeParams = ur2zeRegionParams(srcOrigin, dstOrigin, region, srcRowPitch,
+                                    dstRowPitch, srcSlicePitch, dstSlicePitch);
+
+  auto pSrc = ur_cast<char *>(
+      src->getDeviceAllocationPtr(hCommandBuffer->hDevice, 0));
+  auto pDst = ur_cast<char *>(
+      dst->getDeviceAllocationPtr(hCommandBuffer->hDevice, 0));
+
+  ZE2UR_CALL(zeCommandListAppendMemoryCopyRegion,
+             (hCommandBuffer->getZeCommandList(), pDst, &zeParams.dstRegion,
+              zeParams.dstPitch, zeParams.dstSlicePitch, pSrc,
+              &zeParams.srcRegion, zeParams.srcPitch, zeParams.srcSlicePitch,
+              nullptr, 0, nullptr));
+
+  return UR_RESULT_SUCCESS;
+}
+
+static ur_result_t
+appendGenericFillUnlocked(ur_exp_command_buffer_handle_t hCommandBuffer,
+                          ur_mem_handle_t dst, size_t offset,
+                          size_t patternSize, const void *pPattern,
+                          size_t size) {
+  auto pDst = ur_cast<char *>(
+      dst->getDeviceAllocationPtr(hCommandBuffer->hDevice, offset));
+
+  ZE2UR_CALL(zeCommandListAppendMemoryFill,
+             (hCommandBuffer->getZeCommandList(), pDst, pPattern, patternSize,
+              size, nullptr, 0, nullptr));
+
+  return UR_RESULT_SUCCESS;
+}
+
+// Completes an append, commands recorded into the in-order command list
+// are ordered after all the commands appended before them.
+static void finishAppend(ur_exp_command_buffer_handle_t hCommandBuffer,
+                         ur_exp_command_buffer_sync_point_t *pSyncPoint,
+                         ur_exp_command_buffer_command_handle_t *phCommand) {
+  auto syncPoint = hCommandBuffer->nextSyncPoint();
+  if (pSyncPoint) {
+    *pSyncPoint = syncPoint;
+  }
+  if (phCommand) {
+    *phCommand = nullptr;
+  }
+}
+
+namespace ur::level_zero {
+
+ur_result_t
+urCommandBufferCreateExp(ur_context_handle_t hContext,
+                         ur_device_handle_t hDevice,
+                         const ur_exp_command_buffer_desc_t *pCommandBufferDesc,
+                         ur_exp_command_buffer_handle_t *phCommandBuffer) try {
+  TRACK_SCOPE_LATENCY("urCommandBufferCreateExp");
+
+  bool isUpdatable = pCommandBufferDesc && pCommandBufferDesc->isUpdatable;
+  uint32_t ordinal =
+      hDevice->QueueGroup[ur_device_handle_t_::queue_group_info_t::Compute]
+          .ZeOrdinal;
+
+  v2::raii::command_list_unique_handle commandList;
+  ze_command_list_handle_t zeCommandListTranslated = nullptr;
+  if (isUpdatable) {
+    UR_ASSERT(hContext->getPlatform()->ZeMutableCmdListExt.Supported,
+              UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+
+    // Mutable command lists are not cached, their descriptor differs from
+    // that of the cached regular command lists.
+    ZeStruct<ze_mutable_command_list_exp_desc_t> zeMutableCommandListDesc;
+    zeMutableCommandListDesc.flags = 0;
+
+    ZeStruct<ze_command_list_desc_t> zeCommandListDesc;
+    zeCommandListDesc.commandQueueGroupOrdinal = ordinal;
+    zeCommandListDesc.flags = ZE_COMMAND_LIST_FLAG_IN_ORDER;
+    zeCommandListDesc.pNext = &zeMutableCommandListDesc;
+
+    ze_command_list_handle_t zeCommandList = nullptr;
+    ZE2UR_CALL(zeCommandListCreate,
+               (hContext->getZeHandle(), hDevice->ZeDevice, &zeCommandListDesc,
+                &zeCommandList));
+    commandList = v2::raii::command_list_unique_handle(
+        zeCommandList, [](ze_command_list_handle_t hZeCommandList) {
+          ZE_CALL_NOCHECK(zeCommandListDestroy, (hZeCommandList));
+        });
+
+    ZE2UR_CALL(zelLoaderTranslateHandle,
+               (ZEL_HANDLE_COMMAND_LIST, commandList.get(),
+                (void **)&zeCommandListTranslated));
+  } else {
+    commandList = hContext->commandListCache.getRegularCommandList(
+        hDevice->ZeDevice, true, ordinal, true);
+  }
+
+  *phCommandBuffer = new ur_exp_command_buffer_handle_t_(
+      hContext, hDevice, std::move(commandList), pCommandBufferDesc);
+  (*phCommandBuffer)->zeCommandListTranslated = zeCommandListTranslated;
+
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+ur_result_t
+urCommandBufferRetainExp(ur_exp_command_buffer_handle_t hCommandBuffer) try {
+  hCommandBuffer->RefCount.increment();
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+ur_result_t
+urCommandBufferReleaseExp(ur_exp_command_buffer_handle_t hCommandBuffer) try {
+  if (!hCommandBuffer->RefCount.decrementAndTest())
+    return UR_RESULT_SUCCESS;
+
+  delete hCommandBuffer;
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+ur_result_t
+urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t hCommandBuffer) try {
+  std::scoped_lock<ur_shared_mutex> lock(hCommandBuffer->Mutex);
+
+  UR_ASSERT(!hCommandBuffer->isFinalized, UR_RESULT_ERROR_INVALID_OPERATION);
+
+  ZE2UR_CALL(zeCommandListClose, (hCommandBuffer->getZeCommandList()));
+  hCommandBuffer->isFinalized = true;
+
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+ur_result_t urCommandBufferAppendKernelLaunchExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_kernel_handle_t hKernel,
+    uint32_t workDim, const size_t *pGlobalWorkOffset,
+    const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
+    uint32_t numKernelAlternatives, ur_kernel_handle_t *phKernelAlternatives,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) try {
+  TRACK_SCOPE_LATENCY("urCommandBufferAppendKernelLaunchExp");
+
+  std::ignore = phKernelAlternatives;
+  std::ignore = phEventWaitList;
+
+  UR_ASSERT(hKernel->getProgramHandle(), UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  UR_ASSERT(workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  // Command handles can only be obtained from updatable command-buffers
+  UR_ASSERT(!(phCommand && !hCommandBuffer->isUpdatable),
+            UR_RESULT_ERROR_INVALID_OPERATION);
+  // UR_DEVICE_COMMAND_BUFFER_UPDATE_CAPABILITY_FLAG_KERNEL_HANDLE is not
+  // reported.
+  UR_ASSERT(numKernelAlternatives == 0, UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+
+  ze_kernel_handle_t hZeKernel = hKernel->getZeHandle(hCommandBuffer->hDevice);
+
+  std::scoped_lock<ur_shared_mutex, ur_mutex> lock(
+      hCommandBuffer->Mutex, hKernel->getLaunchMutex(hCommandBuffer->hDevice));
+
+  UR_CALL(hCommandBuffer->checkAppend(numSyncPointsInWaitList,
+                                      pSyncPointWaitList, numEventsInWaitList,
+                                      phEvent));
+
+  ze_group_count_t zeThreadGroupDimensions{1, 1, 1};
+  uint32_t WG[3]{};
+  UR_CALL(calculateKernelWorkDimensions(
+      hZeKernel, hCommandBuffer->hDevice, zeThreadGroupDimensions, WG, workDim,
+      pGlobalWorkSize, pLocalWorkSize));
+
+  UR_CALL(hKernel->prepareForSubmission(
+      hCommandBuffer->hContext, hCommandBuffer->hDevice, pGlobalWorkOffset,
+      workDim, WG[0], WG[1], WG[2], nullptr, {}));
+
+  // The id has to be requested right before the command is appended.
+  uint64_t commandId = 0;
+  if (hCommandBuffer->isUpdatable) {
+    ZeStruct<ze_mutable_command_id_exp_desc_t> zeMutableCommandDesc;
+    zeMutableCommandDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS |
+                                 ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT |
+                                 ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_SIZE |
+                                 ZE_MUTABLE_COMMAND_EXP_FLAG_GLOBAL_OFFSET;
+
+    auto platform = hCommandBuffer->hContext->getPlatform();
+    ZE2UR_CALL(platform->ZeMutableCmdListExt.zexCommandListGetNextCommandIdExp,
+               (hCommandBuffer->zeCommandListTranslated, &zeMutableCommandDesc,
+                &commandId));
+  }
+
+  ZE2UR_CALL(zeCommandListAppendLaunchKernel,
+             (hCommandBuffer->getZeCommandList(), hZeKernel,
+              &zeThreadGroupDimensions, nullptr, 0, nullptr));
+
+  hCommandBuffer->retainKernel(hKernel);
+  for (auto [hMem, access] : hKernel->getMemArgs()) {
+    hCommandBuffer->recordMemAccess(hMem, access, 0, hMem->getSize());
+  }
+
+  finishAppend(hCommandBuffer, pSyncPoint, phCommand);
+  if (phCommand) {
+    hCommandBuffer->commands.push_back(
+        std::make_unique<ur_exp_command_buffer_command_handle_t_>(
+            hCommandBuffer, commandId, hKernel, workDim,
+            pLocalWorkSize != nullptr));
+    *phCommand = hCommandBuffer->commands.back().get();
+  }
+
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+ur_result_t urCommandBufferAppendUSMMemcpyExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, void *pDst, const void *pSrc,
+    size_t size, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) try {
+  TRACK_SCOPE_LATENCY("urCommandBufferAppendUSMMemcpyExp");
+
+  std::ignore = phEventWaitList;
+
+  std::scoped_lock<ur_shared_mutex> lock(hCommandBuffer->Mutex);
+
+  UR_CALL(hCommandBuffer->checkAppend(numSyncPointsInWaitList,
+                                      pSyncPointWaitList, numEventsInWaitList,
+                                      phEvent));
+
+  ZE2UR_CALL(zeCommandListAppendMemoryCopy,
+             (hCommandBuffer->getZeCommandList(), pDst, pSrc, size, nullptr, 0,
+              nullptr));
+
+  finishAppend(hCommandBuffer, pSyncPoint, phCommand);
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+ur_result_t urCommandBufferAppendUSMFillExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, void *pMemory,
+    const void *pPattern, size_t patternSize, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) try {
+  TRACK_SCOPE_LATENCY("urCommandBufferAppendUSMFillExp");
+
+  std::ignore = phEventWaitList;
+
+  std::scoped_lock<ur_shared_mutex> lock(hCommandBuffer->Mutex);
+
+  UR_CALL(hCommandBuffer->checkAppend(numSyncPointsInWaitList,
+                                      pSyncPointWaitList, numEventsInWaitList,
+                                      phEvent));
+
+  ur_usm_handle_t_ dstHandle(hCommandBuffer->hContext, size, pMemory);
+  UR_CALL(appendGenericFillUnlocked(hCommandBuffer, &dstHandle, 0, patternSize,
+                                    pPattern, size));
+
+  finishAppend(hCommandBuffer, pSyncPoint, phCommand);
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+ur_result_t urCommandBufferAppendMemBufferCopyExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hSrcMem,
+    ur_mem_handle_t hDstMem, size_t srcOffset, size_t dstOffset, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) try {
+  TRACK_SCOPE_LATENCY("urCommandBufferAppendMemBufferCopyExp");
+
+  std::ignore = phEventWaitList;
+
+  UR_ASSERT(srcOffset + size <= hSrcMem->getSize(),
+            UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(dstOffset + size <= hDstMem->getSize(),
+            UR_RESULT_ERROR_INVALID_SIZE);
+
+  std::scoped_lock<ur_shared_mutex, ur_shared_mutex, ur_shared_mutex> lock(
+      hCommandBuffer->Mutex, hSrcMem->getMutex(), hDstMem->getMutex());
+
+  UR_CALL(hCommandBuffer->checkAppend(numSyncPointsInWaitList,
+                                      pSyncPointWaitList, numEventsInWaitList,
+                                      phEvent));
+
+  UR_CALL(appendGenericCopyUnlocked(hCommandBuffer, hSrcMem, hDstMem, srcOffset,
+                                    dstOffset, size));
+  hCommandBuffer->recordMemAccess(
+      hSrcMem, ur_mem_handle_t_::device_access_mode_t::read_only, srcOffset,
+      size);
+  hCommandBuffer->recordMemAccess(
+      hDstMem, ur_mem_handle_t_::device_access_mode_t::write_only, dstOffset,
+      size);
+
+  finishAppend(hCommandBuffer, pSyncPoint, phCommand);
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+ur_result_t urCommandBufferAppendMemBufferWriteExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    size_t offset, size_t size, const void *pSrc,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) try {
+  TRACK_SCOPE_LATENCY("urCommandBufferAppendMemBufferWriteExp");
+
+  std::ignore = phEventWaitList;
+
+  UR_ASSERT(offset + size <= hBuffer->getSize(), UR_RESULT_ERROR_INVALID_SIZE);
+
+  std::scoped_lock<ur_shared_mutex, ur_shared_mutex> lock(
+      hCommandBuffer->Mutex, hBuffer->getMutex());
+
+  UR_CALL(hCommandBuffer->checkAppend(numSyncPointsInWaitList,
+                                      pSyncPointWaitList, numEventsInWaitList,
+                                      phEvent));
+
+  ur_usm_handle_t_ srcHandle(hCommandBuffer->hContext, size, pSrc);
+  UR_CALL(appendGenericCopyUnlocked(hCommandBuffer, &srcHandle, hBuffer, 0,
+                                    offset, size));
+  hCommandBuffer->recordMemAccess(
+      hBuffer, ur_mem_handle_t_::device_access_mode_t::write_only, offset,
+      size);
+
+  finishAppend(hCommandBuffer, pSyncPoint, phCommand);
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+ur_result_t urCommandBufferAppendMemBufferReadExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    size_t offset, size_t size, void *pDst, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) try {
+  TRACK_SCOPE_LATENCY("urCommandBufferAppendMemBufferReadExp");
+
+  std::ignore = phEventWaitList;
+
+  UR_ASSERT(offset + size <= hBuffer->getSize(), UR_RESULT_ERROR_INVALID_SIZE);
+
+  std::scoped_lock<ur_shared_mutex, ur_shared_mutex> lock(
+      hCommandBuffer->Mutex, hBuffer->getMutex());
+
+  UR_CALL(hCommandBuffer->checkAppend(numSyncPointsInWaitList,
+                                      pSyncPointWaitList, numEventsInWaitList,
+                                      phEvent));
+
+  ur_usm_handle_t_ dstHandle(hCommandBuffer->hContext, size, pDst);
+  UR_CALL(appendGenericCopyUnlocked(hCommandBuffer, hBuffer, &dstHandle,
+                                    offset, 0, size));
+  hCommandBuffer->recordMemAccess(
+      hBuffer, ur_mem_handle_t_::device_access_mode_t::read_only, offset, size);
+
+  finishAppend(hCommandBuffer, pSyncPoint, phCommand);
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+ur_result_t urCommandBufferAppendMemBufferCopyRectExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hSrcMem,
+    ur_mem_handle_t hDstMem, ur_rect_offset_t srcOrigin,
+    ur_rect_offset_t dstOrigin, ur_rect_region_t region, size_t srcRowPitch,
+    size_t srcSlicePitch, size_t dstRowPitch, size_t dstSlicePitch,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) try {
+  TRACK_SCOPE_LATENCY("urCommandBufferAppendMemBufferCopyRectExp");
+
+  std::ignore = phEventWaitList;
+
+  std::scoped_lock<ur_shared_mutex, ur_shared_mutex, ur_shared_mutex> lock(
+      hCommandBuffer->Mutex, hSrcMem->getMutex(), hDstMem->getMutex());
+
+  UR_CALL(hCommandBuffer->checkAppend(numSyncPointsInWaitList,
+                                      pSyncPointWaitList, numEventsInWaitList,
+                                      phEvent));
+
+  UR_CALL(appendRegionCopyUnlocked(hCommandBuffer, hSrcMem, hDstMem, srcOrigin,
+                                   dstOrigin, region, srcRowPitch,
+                                   srcSlicePitch, dstRowPitch, dstSlicePitch));
+  hCommandBuffer->recordMemAccess(
+      hSrcMem, ur_mem_handle_t_::device_access_mode_t::read_only, 0,
+      hSrcMem->getSize());
+  hCommandBuffer->recordMemAccess(
+      hDstMem, ur_mem_handle_t_::device_access_mode_t::write_only, 0,
+      hDstMem->getSize());
+
+  finishAppend(hCommandBuffer, pSyncPoint, phCommand);
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+ur_result_t urCommandBufferAppendMemBufferWriteRectExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    ur_rect_offset_t bufferOffset, ur_rect_offset_t hostOffset,
+    ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
+    size_t hostRowPitch, size_t hostSlicePitch, void *pSrc,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) try {
+  TRACK_SCOPE_LATENCY("urCommandBufferAppendMemBufferWriteRectExp");
+
+  std::ignore = phEventWaitList;
+
+  std::scoped_lock<ur_shared_mutex, ur_shared_mutex> lock(
+      hCommandBuffer->Mutex, hBuffer->getMutex());
+
+  UR_CALL(hCommandBuffer->checkAppend(numSyncPointsInWaitList,
+                                      pSyncPointWaitList, numEventsInWaitList,
+                                      phEvent));
+
+  ur_usm_handle_t_ srcHandle(hCommandBuffer->hContext, 0, pSrc);
+  UR_CALL(appendRegionCopyUnlocked(hCommandBuffer, &srcHandle, hBuffer,
+                                   hostOffset, bufferOffset, region,
+                                   hostRowPitch, hostSlicePitch, bufferRowPitch,
+                                   bufferSlicePitch));
+  hCommandBuffer->recordMemAccess(
+      hBuffer, ur_mem_handle_t_::device_access_mode_t::write_only, 0,
+      hBuffer->getSize());
+
+  finishAppend(hCommandBuffer, pSyncPoint, phCommand);
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+ur_result_t urCommandBufferAppendMemBufferReadRectExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    ur_rect_offset_t bufferOffset, ur_rect_offset_t hostOffset,
+    ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
+    size_t hostRowPitch, size_t hostSlicePitch, void *pDst,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) try {
+  TRACK_SCOPE_LATENCY("urCommandBufferAppendMemBufferReadRectExp");
+
+  std::ignore = phEventWaitList;
+
+  std::scoped_lock<ur_shared_mutex, ur_shared_mutex> lock(
+      hCommandBuffer->Mutex, hBuffer->getMutex());
+
+  UR_CALL(hCommandBuffer->checkAppend(numSyncPointsInWaitList,
+                                      pSyncPointWaitList, numEventsInWaitList,
+                                      phEvent));
+
+  ur_usm_handle_t_ dstHandle(hCommandBuffer->hContext, 0, pDst);
+  UR_CALL(appendRegionCopyUnlocked(hCommandBuffer, hBuffer, &dstHandle,
+                                   bufferOffset, hostOffset, region,
+                                   bufferRowPitch, bufferSlicePitch,
+                                   hostRowPitch, hostSlicePitch));
+  hCommandBuffer->recordMemAccess(
+      hBuffer, ur_mem_handle_t_::device_access_mode_t::read_only, 0,
+      hBuffer->getSize());
+
+  finishAppend(hCommandBuffer, pSyncPoint, phCommand);
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+ur_result_t urCommandBufferAppendMemBufferFillExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    const void *pPattern, size_t patternSize, size_t offset, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) try {
+  TRACK_SCOPE_LATENCY("urCommandBufferAppendMemBufferFillExp");
+
+  std::ignore = phEventWaitList;
+
+  UR_ASSERT(offset + size <= hBuffer->getSize(), UR_RESULT_ERROR_INVALID_SIZE);
+
+  std::scoped_lock<ur_shared_mutex, ur_shared_mutex> lock(
+      hCommandBuffer->Mutex, hBuffer->getMutex());
+
+  UR_CALL(hCommandBuffer->checkAppend(numSyncPointsInWaitList,
+                                      pSyncPointWaitList, numEventsInWaitList,
+                                      phEvent));
+
+  UR_CALL(appendGenericFillUnlocked(hCommandBuffer, hBuffer, offset,
+                                    patternSize, pPattern, size));
+  hCommandBuffer->recordMemAccess(
+      hBuffer, ur_mem_handle_t_::device_access_mode_t::write_only, offset,
+      size);
+
+  finishAppend(hCommandBuffer, pSyncPoint, phCommand);
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+ur_result_t urCommandBufferAppendUSMPrefetchExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, const void *pMemory,
+    size_t size, ur_usm_migration_flags_t flags,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) try {
+  TRACK_SCOPE_LATENCY("urCommandBufferAppendUSMPrefetchExp");
+
+  std::ignore = phEventWaitList;
+
+  // The default migration is the only one zeCommandListAppendMemoryPrefetch
+  // does, it takes no flags.
+  if (flags & ~UR_USM_MIGRATION_FLAG_DEFAULT) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
+  std::scoped_lock<ur_shared_mutex> lock(hCommandBuffer->Mutex);
+
+  UR_CALL(hCommandBuffer->checkAppend(numSyncPointsInWaitList,
+                                      pSyncPointWaitList, numEventsInWaitList,
+                                      phEvent));
+
+  ZE2UR_CALL(zeCommandListAppendMemoryPrefetch,
+             (hCommandBuffer->getZeCommandList(), pMemory, size));
+
+  finishAppend(hCommandBuffer, pSyncPoint, phCommand);
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+ur_result_t urCommandBufferAppendUSMAdviseExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, const void *pMemory,
+    size_t size, ur_usm_advice_flags_t advice, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) try {
+  TRACK_SCOPE_LATENCY("urCommandBufferAppendUSMAdviseExp");
+
+  std::ignore = phEventWaitList;
+
+  std::scoped_lock<ur_shared_mutex> lock(hCommandBuffer->Mutex);
+
+  UR_CALL(hCommandBuffer->checkAppend(numSyncPointsInWaitList,
+                                      pSyncPointWaitList, numEventsInWaitList,
+                                      phEvent));
+
+  auto zeAdvice = ur_cast<ze_memory_advice_t>(advice);
+  ZE2UR_CALL(zeCommandListAppendMemAdvise,
+             (hCommandBuffer->getZeCommandList(),
+              hCommandBuffer->hDevice->ZeDevice, pMemory, size, zeAdvice));
+
+  finishAppend(hCommandBuffer, pSyncPoint, phCommand);
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+ur_result_t urCommandBufferEnqueueExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_queue_handle_t hQueue,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) try {
+  TRACK_SCOPE_LATENCY("urCommandBufferEnqueueExp");
+
+  std::scoped_lock<ur_shared_mutex> lock(hCommandBuffer->Mutex);
+
+  UR_ASSERT(hCommandBuffer->isFinalized, UR_RESULT_ERROR_INVALID_OPERATION);
+
+  // A command list must not be executing twice at the same time, so every
+  // enqueue also waits for the previous one. The queue drops that event from
+  // the wait list if the previous enqueue was to the same in-order queue.
+  std::vector<ur_event_handle_t> waitList(phEventWaitList,
+                                          phEventWaitList +
+                                              numEventsInWaitList);
+  if (auto hLastSubmission = hCommandBuffer->getLastSubmission()) {
+    waitList.push_back(hLastSubmission);
+  }
+
+  ur_event_handle_t hEvent = nullptr;
+  UR_CALL(hQueue->enqueueCommandBuffer(
+      hCommandBuffer, &hEvent, static_cast<uint32_t>(waitList.size()),
+      waitList.data()));
+
+  if (phEvent) {
+    hEvent->retain();
+    *phEvent = hEvent;
+  }
+  hCommandBuffer->setLastSubmission(hQueue, hEvent);
+
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+ur_result_t urCommandBufferRetainCommandExp(
+    ur_exp_command_buffer_command_handle_t hCommand) try {
+  hCommand->RefCount.increment();
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+ur_result_t urCommandBufferReleaseCommandExp(
+    ur_exp_command_buffer_command_handle_t hCommand) try {
+  // The command-buffer owns its commands and destroys them with itself.
+  hCommand->RefCount.decrementAndTest();
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+/**
+ * Validates contents of the update command description.
+ * @param[in] hCommand The command which is being updated.
+ * @param[in] pUpdateKernelLaunch The update command description.
+ * @return UR_RESULT_SUCCESS or an error code on failure
+ */
+static ur_result_t validateCommandDesc(
+    ur_exp_command_buffer_command_handle_t hCommand,
+    const ur_exp_command_buffer_update_kernel_launch_desc_t
+        *pUpdateKernelLaunch) {
+  auto hCommandBuffer = hCommand->hCommandBuffer;
+  auto supportedFeatures =
+      hCommandBuffer->hDevice->ZeDeviceMutableCmdListsProperties
+          ->mutableCommandFlags;
+  logger::debug("Mutable features supported by device {}", supportedFeatures);
+
+  // Kernel alternatives are not supported, the kernel cannot change.
+  if (pUpdateKernelLaunch->hNewKernel &&
+      pUpdateKernelLaunch->hNewKernel != hCommand->hKernel) {
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+
+  if (pUpdateKernelLaunch->newWorkDim != hCommand->workDim &&
+      (!pUpdateKernelLaunch->pNewGlobalWorkOffset ||
+       !pUpdateKernelLaunch->pNewGlobalWorkSize)) {
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+
+  size_t *pNewGlobalWorkOffset = pUpdateKernelLaunch->pNewGlobalWorkOffset;
+  UR_ASSERT(!pNewGlobalWorkOffset ||
+                (supportedFeatures & ZE_MUTABLE_COMMAND_EXP_FLAG_GLOBAL_OFFSET),
+            UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+  if (pNewGlobalWorkOffset && !hCommandBuffer->hContext->getPlatform()
+                                   ->ZeDriverGlobalOffsetExtensionFound) {
+    logger::error("No global offset extension found on this driver");
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+
+  size_t *pNewLocalWorkSize = pUpdateKernelLaunch->pNewLocalWorkSize;
+  UR_ASSERT(!pNewLocalWorkSize ||
+                (supportedFeatures & ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_SIZE),
+            UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+
+  size_t *pNewGlobalWorkSize = pUpdateKernelLaunch->pNewGlobalWorkSize;
+  UR_ASSERT(!pNewGlobalWorkSize ||
+                (supportedFeatures & ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT),
+            UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+  UR_ASSERT(!(pNewGlobalWorkSize && !pNewLocalWorkSize) ||
+                (supportedFeatures & ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_SIZE),
+            UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+
+  UR_ASSERT((!pUpdateKernelLaunch->numNewMemObjArgs &&
+             !pUpdateKernelLaunch->numNewPointerArgs &&
+             !pUpdateKernelLaunch->numNewValueArgs) ||
+                (supportedFeatures &
+                 ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS),
+            UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+
+  return UR_RESULT_SUCCESS;
+}
+
+/**
+ * Updates the kernel command with the new values.
+ * @param[in] hCommand The command which is being updated.
+ * @param[in] pUpdateKernelLaunch The update command description.
+ * @return UR_RESULT_SUCCESS or an error code on failure
+ */
+static ur_result_t updateKernelCommand(
+    ur_exp_command_buffer_command_handle_t hCommand,
+    const ur_exp_command_buffer_update_kernel_launch_desc_t
+        *pUpdateKernelLaunch) {
+  // The descriptors have to live until
+  // zexCommandListUpdateMutableCommandsExp is called.
+  std::vector<std::variant<
+      std::unique_ptr<ZeStruct<ze_mutable_kernel_argument_exp_desc_t>>,
+      std::unique_ptr<ZeStruct<ze_mutable_global_offset_exp_desc_t>>,
+      std::unique_ptr<ZeStruct<ze_mutable_group_size_exp_desc_t>>,
+      std::unique_ptr<ZeStruct<ze_mutable_group_count_exp_desc_t>>>>
+      descs;
+  // Device pointers of the new memory object arguments, the descriptors
+  // point into it, so it must not be resized.
+  std::vector<void *> memObjPtrs(pUpdateKernelLaunch->numNewMemObjArgs);
+
+  auto hCommandBuffer = hCommand->hCommandBuffer;
+  auto hDevice = hCommandBuffer->hDevice;
+  const void *pNextDesc = nullptr;
+
+  auto addArgDesc = [&](uint32_t argIndex, size_t argSize,
+                        const void *pArgValue) {
+    auto zeMutableArgDesc =
+        std::make_unique<ZeStruct<ze_mutable_kernel_argument_exp_desc_t>>();
+    zeMutableArgDesc->commandId = hCommand->commandId;
+    zeMutableArgDesc->pNext = pNextDesc;
+    zeMutableArgDesc->argIndex = argIndex;
+    zeMutableArgDesc->argSize = argSize;
+    zeMutableArgDesc->pArgValue = pArgValue;
+
+    pNextDesc = zeMutableArgDesc.get();
+    descs.push_back(std::move(zeMutableArgDesc));
+  };
+
+  auto addGroupSizeDesc = [&](uint32_t x, uint32_t y, uint32_t z) {
+    auto zeMutableGroupSizeDesc =
+        std::make_unique<ZeStruct<ze_mutable_group_size_exp_desc_t>>();
+    zeMutableGroupSizeDesc->commandId = hCommand->commandId;
+    zeMutableGroupSizeDesc->pNext = pNextDesc;
+    zeMutableGroupSizeDesc->groupSizeX = x;
+    zeMutableGroupSizeDesc->groupSizeY = y;
+    zeMutableGroupSizeDesc->groupSizeZ = z;
+
+    pNextDesc = zeMutableGroupSizeDesc.get();
+    descs.push_back(std::move(zeMutableGroupSizeDesc));
+  };
+
+  uint32_t dim = pUpdateKernelLaunch->newWorkDim;
+  size_t *pNewGlobalWorkOffset = pUpdateKernelLaunch->pNewGlobalWorkOffset;
+  size_t *pNewLocalWorkSize = pUpdateKernelLaunch->pNewLocalWorkSize;
+  size_t *pNewGlobalWorkSize = pUpdateKernelLaunch->pNewGlobalWorkSize;
+
+  if (pNewGlobalWorkOffset && dim > 0) {
+    auto zeMutableGlobalOffsetDesc =
+        std::make_unique<ZeStruct<ze_mutable_global_offset_exp_desc_t>>();
+    zeMutableGlobalOffsetDesc->commandId = hCommand->commandId;
+    zeMutableGlobalOffsetDesc->pNext = pNextDesc;
+    zeMutableGlobalOffsetDesc->offsetX = pNewGlobalWorkOffset[0];
+    zeMutableGlobalOffsetDesc->offsetY =
+        dim >= 2 ? pNewGlobalWorkOffset[1] : 0;
+    zeMutableGlobalOffsetDesc->offsetZ =
+        dim == 3 ? pNewGlobalWorkOffset[2] : 0;
+
+    pNextDesc = zeMutableGlobalOffsetDesc.get();
+    descs.push_back(std::move(zeMutableGlobalOffsetDesc));
+  }
+
+  if (pNewLocalWorkSize && dim > 0) {
+    addGroupSizeDesc(pNewLocalWorkSize[0],
+                     dim >= 2 ? pNewLocalWorkSize[1] : 1,
+                     dim == 3 ? pNewLocalWorkSize[2] : 1);
+  }
+
+  ze_group_count_t zeThreadGroupDimensions{1, 1, 1};
+  if (pNewGlobalWorkSize && dim > 0) {
+    uint32_t WG[3]{};
+    UR_CALL(calculateKernelWorkDimensions(
+        hCommand->hKernel->getZeHandle(hDevice), hDevice,
+        zeThreadGroupDimensions, WG, dim, pNewGlobalWorkSize,
+        pNewLocalWorkSize));
+
+    auto zeMutableGroupCountDesc =
+        std::make_unique<ZeStruct<ze_mutable_group_count_exp_desc_t>>();
+    zeMutableGroupCountDesc->commandId = hCommand->commandId;
+    zeMutableGroupCountDesc->pNext = pNextDesc;
+    zeMutableGroupCountDesc->pGroupCount = &zeThreadGroupDimensions;
+
+    pNextDesc = zeMutableGroupCountDesc.get();
+    descs.push_back(std::move(zeMutableGroupCountDesc));
+
+    // The local work size suggested by the driver depends on the global one.
+    if (!pNewLocalWorkSize) {
+      addGroupSizeDesc(WG[0], WG[1], WG[2]);
+    }
+  }
+
+  for (uint32_t i = 0; i < pUpdateKernelLaunch->numNewMemObjArgs; i++) {
+    const auto &newMemObjArg = pUpdateKernelLaunch->pNewMemObjArgList[i];
+    // A NULL memory object sets the argument to a NULL pointer.
+    if (auto hMem = newMemObjArg.hNewMemObjArg) {
+      std::scoped_lock<ur_shared_mutex> lock(hMem->getMutex());
+      memObjPtrs[i] = hMem->getDeviceAllocationPtr(hDevice, 0);
+      // The memory of the replaced argument stays recorded, migrating it at
+      // the enqueues is redundant but harmless.
+      hCommandBuffer->recordMemAccess(
+          hMem, memAccessFromKernelProperties(newMemObjArg.pProperties), 0,
+          hMem->getSize());
+    }
+    addArgDesc(newMemObjArg.argIndex, sizeof(void *), &memObjPtrs[i]);
+  }
+
+  for (uint32_t i = 0; i < pUpdateKernelLaunch->numNewPointerArgs; i++) {
+    const auto &newPointerArg = pUpdateKernelLaunch->pNewPointerArgList[i];
+    addArgDesc(newPointerArg.argIndex, sizeof(void *),
+               newPointerArg.pNewPointerArg);
+  }
+
+  for (uint32_t i = 0; i < pUpdateKernelLaunch->numNewValueArgs; i++) {
+    const auto &newValueArg = pUpdateKernelLaunch->pNewValueArgList[i];
+    // Same as urKernelSetArgValue, a pointer to NULL is treated as NULL.
+    const void *pArgValue = newValueArg.pNewValueArg;
+    if (newValueArg.argSize == sizeof(void *) && pArgValue &&
+        *(void **)(const_cast<void *>(pArgValue)) == nullptr) {
+      pArgValue = nullptr;
+    }
+    addArgDesc(newValueArg.argIndex, newValueArg.argSize, pArgValue);
+  }
+
+  ZeStruct<ze_mutable_commands_exp_desc_t> zeMutableCommandDesc;
+  zeMutableCommandDesc.pNext = pNextDesc;
+  zeMutableCommandDesc.flags = 0;
+
+  auto platform = hCommandBuffer->hContext->getPlatform();
+  ZE2UR_CALL(
+      platform->ZeMutableCmdListExt.zexCommandListUpdateMutableCommandsExp,
+      (hCommandBuffer->zeCommandListTranslated, &zeMutableCommandDesc));
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urCommandBufferUpdateKernelLaunchExp(
+    ur_exp_command_buffer_command_handle_t hCommand,
+    const ur_exp_command_buffer_update_kernel_launch_desc_t
+        *pUpdateKernelLaunch) try {
+  TRACK_SCOPE_LATENCY("urCommandBufferUpdateKernelLaunchExp");
+
+  auto hCommandBuffer = hCommand->hCommandBuffer;
+  UR_ASSERT(hCommandBuffer->isUpdatable, UR_RESULT_ERROR_INVALID_OPERATION);
+
+  // Lock command, kernel and command buffer for update.
+  std::scoped_lock<ur_shared_mutex, ur_shared_mutex, ur_shared_mutex> lock(
+      hCommand->Mutex, hCommandBuffer->Mutex, hCommand->hKernel->Mutex);
+
+  UR_ASSERT(hCommandBuffer->isFinalized, UR_RESULT_ERROR_INVALID_OPERATION);
+
+  UR_CALL(validateCommandDesc(hCommand, pUpdateKernelLaunch));
+  UR_CALL(hCommandBuffer->waitForLastSubmission());
+  UR_CALL(updateKernelCommand(hCommand, pUpdateKernelLaunch));
+
+  ZE2UR_CALL(zeCommandListClose, (hCommandBuffer->getZeCommandList()));
+
+  return UR_RESULT_SUCCESS;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+// The commands have no events of their own, see the scope of the v2
+// command-buffer in command_buffer.hpp.
+ur_result_t urCommandBufferUpdateSignalEventExp(
+    ur_exp_command_buffer_command_handle_t hCommand,
+    ur_event_handle_t *phEvent) {
+  std::ignore = hCommand;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t urCommandBufferUpdateWaitEventsExp(
+    ur_exp_command_buffer_command_handle_t hCommand,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList) {
+  std::ignore = hCommand;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t
+urCommandBufferGetInfoExp(ur_exp_command_buffer_handle_t hCommandBuffer,
+                          ur_exp_command_buffer_info_t propName,
+                          size_t propSize, void *pPropValue,
+                          size_t *pPropSizeRet) try {
+  UrReturnHelper returnValue(propSize, pPropValue, pPropSizeRet);
+
+  switch (propName) {
+  case UR_EXP_COMMAND_BUFFER_INFO_REFERENCE_COUNT:
+    return returnValue(uint32_t{hCommandBuffer->RefCount.load()});
+  case UR_EXP_COMMAND_BUFFER_INFO_DESCRIPTOR: {
+    ur_exp_command_buffer_desc_t descriptor{};
+    descriptor.stype = UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_DESC;
+    descriptor.pNext = nullptr;
+    descriptor.isUpdatable = hCommandBuffer->isUpdatable;
+    descriptor.isInOrder = hCommandBuffer->isInOrder;
+    descriptor.enableProfiling = hCommandBuffer->isProfilingEnabled;
+
+    return returnValue(descriptor);
+  }
+  default:
+    assert(!"Command-buffer info request not implemented");
+  }
+
+  return UR_RESULT_ERROR_INVALID_ENUMERATION;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+ur_result_t urCommandBufferCommandGetInfoExp(
+    ur_exp_command_buffer_command_handle_t hCommand,
+    ur_exp_command_buffer_command_info_t propName, size_t propSize,
+    void *pPropValue, size_t *pPropSizeRet) try {
+  UrReturnHelper returnValue(propSize, pPropValue, pPropSizeRet);
+
+  switch (propName) {
+  case UR_EXP_COMMAND_BUFFER_COMMAND_INFO_REFERENCE_COUNT:
+    return returnValue(uint32_t{hCommand->RefCount.load()});
+  default:
+    assert(!"Command-buffer command info request not implemented");
+  }
+
+  return UR_RESULT_ERROR_INVALID_ENUMERATION;
+} catch (...) {
+  return exceptionToResult(std::current_exception());
+}
+
+} // namespace ur::level_zero
@@ -0,0 +1,131 @@
+//===--------- command_buffer.hpp - Level Zero Adapter -------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <ur_api.h>
+#include <ze_api.h>
+
+#include "command_list_cache.hpp"
+#include "common.hpp"
+#include "memory.hpp"
+
+// Scope of the v2 command-buffer: commands are recorded into a single in-order
+// regular command list, in the order they are appended. Sync points are only
+// numbered to validate the wait lists, independent commands are not run
+// concurrently. Per-command events are not created, so event wait lists and
+// signal events on appends, and updates of the signal and wait events of a
+// command, are not supported. Updatable command-buffers support kernel
+// argument, work size and offset updates, but not kernel alternatives.
+// An enqueue of the command-buffer appends the command list to the
+// immediate command list of the queue.
+// The device pointers of memory objects are resolved when the commands are
+// recorded, but the memory is only migrated to the device when the
+// command-buffer is enqueued, as every enqueue may find it elsewhere.
+struct ur_exp_command_buffer_handle_t_ : _ur_object {
+  ur_exp_command_buffer_handle_t_(
+      ur_context_handle_t hContext, ur_device_handle_t hDevice,
+      v2::raii::command_list_unique_handle commandList,
+      const ur_exp_command_buffer_desc_t *pDesc);
+  ~ur_exp_command_buffer_handle_t_();
+
+  // Checks that a command can be appended and that its wait lists are valid.
+  ur_result_t
+  checkAppend(uint32_t numSyncPointsInWaitList,
+              const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+              uint32_t numEventsInWaitList, ur_event_handle_t *phEvent) const;
+
+  // Returns the sync point of the command that was just appended.
+  ur_exp_command_buffer_sync_point_t nextSyncPoint();
+
+  // Keeps the kernel alive for as long as the command-buffer is.
+  void retainKernel(ur_kernel_handle_t hKernel);
+
+  // Records an access of the commands to a memory object, which is kept
+  // alive for as long as the command-buffer is.
+  void recordMemAccess(ur_mem_handle_t hMem,
+                       ur_mem_handle_t_::device_access_mode_t access,
+                       size_t offset, size_t size);
+
+  // Migrates the memory accessed by the commands to the device and marks the
+  // memory they write as only up to date there, before an enqueue of the
+  // command-buffer.
+  void prepareForSubmission(
+      const std::function<void(void *src, void *dst, size_t)> &migrate,
+      wait_list_view waitList);
+
+  // Waits for the last enqueue of the command-buffer to complete.
+  ur_result_t waitForLastSubmission();
+
+  // Event of the last enqueue of the command-buffer, nullptr if none
+  ur_event_handle_t getLastSubmission() const { return lastSubmission; }
+
+  // Replaces the event of the last enqueue of the command-buffer, the
+  // command-buffer takes over the reference of the caller to the event and
+  // retains the queue, which the event cannot outlive.
+  void setLastSubmission(ur_queue_handle_t hQueue, ur_event_handle_t hEvent);
+
+  ze_command_list_handle_t getZeCommandList() const {
+    return commandList.get();
+  }
+
+  const ur_context_handle_t hContext;
+  const ur_device_handle_t hDevice;
+  const bool isUpdatable;
+  const bool isInOrder;
+  const bool isProfilingEnabled;
+
+  // Command list handle to use with the mutable command list extension,
+  // which needs the handle of the driver rather than that of the loader.
+  ze_command_list_handle_t zeCommandListTranslated = nullptr;
+
+  bool isFinalized = false;
+
+  // Handles of the updatable commands, owned by the command-buffer.
+  std::vector<std::unique_ptr<ur_exp_command_buffer_command_handle_t_>>
+      commands;
+
+private:
+  // Event of the last enqueue of the command-buffer and its queue, the next
+  // enqueue and updates of the commands wait for it.
+  ur_event_handle_t lastSubmission = nullptr;
+  ur_queue_handle_t lastSubmissionQueue = nullptr;
+
+  v2::raii::command_list_unique_handle commandList;
+
+  ur_exp_command_buffer_sync_point_t numSyncPoints = 0;
+
+  std::vector<ur_kernel_handle_t> kernels;
+
+  struct mem_access_t {
+    ur_mem_handle_t hMem;
+    ur_mem_handle_t_::device_access_mode_t access;
+    size_t offset;
+    size_t size;
+  };
+  std::vector<mem_access_t> memAccesses;
+};
+
+struct ur_exp_command_buffer_command_handle_t_ : _ur_object {
+  ur_exp_command_buffer_command_handle_t_(
+      ur_exp_command_buffer_handle_t hCommandBuffer, uint64_t commandId,
+      ur_kernel_handle_t hKernel, uint32_t workDim, bool userDefinedLocalSize);
+
+  const ur_exp_command_buffer_handle_t hCommandBuffer;
+  // Id of the command in the mutable command list
+  const uint64_t commandId;
+  const ur_kernel_handle_t hKernel;
+  // Work dimension the command was appended with
+  const uint32_t workDim;
+  // Whether the local work size was set when the command was appended
+  const bool userDefinedLocalSize;
+};
@@ -13,6 +13,9 @@
 
 #include "../device.hpp"
 
+#include <charconv>
+#include <cstring>
+
 template <>
 ze_structure_type_t
 getZeStructureType<zex_intel_queue_copy_operations_offload_hint_exp_desc_t>() {
@@ -22,13 +25,16 @@ getZeStructureType<zex_intel_queue_copy_operations_offload_hint_exp_desc_t>() {
 bool v2::immediate_command_list_descriptor_t::operator==(
     const immediate_command_list_descriptor_t &rhs) const {
   return ZeDevice == rhs.ZeDevice && IsInOrder == rhs.IsInOrder &&
-         Mode == rhs.Mode && Priority == rhs.Priority && Index == rhs.Index;
+         Ordinal == rhs.Ordinal &&
+         CopyOffloadEnabled == rhs.CopyOffloadEnabled && Mode == rhs.Mode &&
+         Priority == rhs.Priority && Index == rhs.Index;
 }
 
 bool v2::regular_command_list_descriptor_t::operator==(
     const regular_command_list_descriptor_t &rhs) const {
   return ZeDevice == rhs.ZeDevice && Ordinal == rhs.Ordinal &&
-         IsInOrder == rhs.IsInOrder;
+         IsInOrder == rhs.IsInOrder &&
+         CopyOffloadEnabled == rhs.CopyOffloadEnabled;
 }
 
 namespace v2 {
@@ -37,17 +43,54 @@ inline size_t command_list_descriptor_hash_t::operator()(
   if (auto ImmCmdDesc =
           std::get_if<immediate_command_list_descriptor_t>(&desc)) {
     return combine_hashes(0, ImmCmdDesc->ZeDevice, ImmCmdDesc->Ordinal,
-                          ImmCmdDesc->IsInOrder, ImmCmdDesc->Mode,
-                          ImmCmdDesc->Priority, ImmCmdDesc->Index);
+                          ImmCmdDesc->IsInOrder, ImmCmdDesc->CopyOffloadEnabled,
+                          ImmCmdDesc->Mode, ImmCmdDesc->Priority,
+                          ImmCmdDesc->Index);
   } else {
     auto RegCmdDesc = std::get<regular_command_list_descriptor_t>(desc);
     return combine_hashes(0, RegCmdDesc.ZeDevice, RegCmdDesc.IsInOrder,
-                          RegCmdDesc.Ordinal);
+                          RegCmdDesc.Ordinal, RegCmdDesc.CopyOffloadEnabled);
   }
 }
 
+static size_t getMaxCachedCommandLists() {
+  const char *UrRet = std::getenv("UR_L0_V2_COMMAND_LIST_CACHE_SIZE");
+  if (!UrRet)
+    return command_list_cache_t::DefaultMaxCachedLists;
+  // Unlike std::stoul, std::from_chars rejects signs and whitespace, so
+  // negative values are not wrapped around.
+  size_t Value = 0;
+  const char *End = UrRet + std::strlen(UrRet);
+  auto [Ptr, Err] = std::from_chars(UrRet, End, Value);
+  if (Err != std::errc() || Ptr != End) {
+    logger::error("Invalid value of UR_L0_V2_COMMAND_LIST_CACHE_SIZE: {}",
+                  UrRet);
+    return command_list_cache_t::DefaultMaxCachedLists;
+  }
+  return Value;
+}
+
 command_list_cache_t::command_list_cache_t(ze_context_handle_t ZeContext)
-    : ZeContext{ZeContext} {}
+    : command_list_cache_t(ZeContext, getMaxCachedCommandLists()) {}
+
+command_list_cache_t::command_list_cache_t(ze_context_handle_t ZeContext,
+                                           size_t MaxCachedLists,
+                                           size_t NumShards)
+    : ZeContext{ZeContext}, MaxCachedLists(MaxCachedLists), Shards(NumShards) {}
+
+command_list_cache_t::~command_list_cache_t() {
+  logger::debug("command_list_cache_t: {} hits, {} misses, {} evictions",
+                Hits.load(), Misses.load(), Evictions.load());
+}
+
+command_list_cache_t::stats_t command_list_cache_t::getStats() const {
+  return {Hits.load(), Misses.load(), Evictions.load()};
+}
+
+command_list_cache_t::shard_t &
+command_list_cache_t::getShard(const command_list_descriptor_t &desc) {
+  return Shards[command_list_descriptor_hash_t{}(desc) % Shards.size()];
+}
 
 raii::ze_command_list_handle_t
 command_list_cache_t::createCommandList(const command_list_descriptor_t &desc) {
@@ -132,52 +175,142 @@ command_list_cache_t::getRegularCommandList(ze_device_handle_t ZeDevice,
 
 raii::ze_command_list_handle_t
 command_list_cache_t::getCommandList(const command_list_descriptor_t &desc) {
-  std::unique_lock<ur_mutex> Lock(ZeCommandListCacheMutex);
-  auto it = ZeCommandListCache.find(desc);
-  if (it == ZeCommandListCache.end()) {
+  auto &Shard = getShard(desc);
+  std::unique_lock<ur_mutex> Lock(Shard.Mutex);
+  auto it = Shard.Entries.find(desc);
+  if (it == Shard.Entries.end()) {
     Lock.unlock();
+    Misses.fetch_add(1, std::memory_order_relaxed);
     return createCommandList(desc);
   }
 
-  assert(!it->second.empty());
+  auto &Entry = it->second;
+  assert(!Entry.CommandLists.empty());
 
+  // The most recently returned command list is the most likely to still be
+  // warm in the driver.
   raii::ze_command_list_handle_t CommandListHandle =
-      std::move(it->second.top());
-  it->second.pop();
+      std::move(Entry.CommandLists.back());
+  Entry.CommandLists.pop_back();
+  Shard.NumCommandLists--;
+  NumCachedLists.fetch_sub(1, std::memory_order_relaxed);
 
-  if (it->second.empty())
-    ZeCommandListCache.erase(it);
+  if (Entry.CommandLists.empty()) {
+    Shard.LRU.erase(Entry.LRUPosition);
+    Shard.Entries.erase(it);
+  } else {
+    Shard.LRU.splice(Shard.LRU.begin(), Shard.LRU, Entry.LRUPosition);
+    Entry.LastUsed = UseCounter.fetch_add(1, std::memory_order_relaxed);
+  }
 
+  Hits.fetch_add(1, std::memory_order_relaxed);
   return CommandListHandle;
 }
 
 void command_list_cache_t::addCommandList(
     const command_list_descriptor_t &desc,
     raii::ze_command_list_handle_t cmdList) {
-  // TODO: add a limit?
-  std::unique_lock<ur_mutex> Lock(ZeCommandListCacheMutex);
-  auto [it, _] = ZeCommandListCache.try_emplace(desc);
-  it->second.emplace(std::move(cmdList));
+  if (MaxCachedLists == 0) {
+    // Caching is disabled, cmdList is destroyed right away.
+    Evictions.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  {
+    auto &Shard = getShard(desc);
+    std::unique_lock<ur_mutex> Lock(Shard.Mutex);
+
+    auto [it, inserted] = Shard.Entries.try_emplace(desc);
+    auto &Entry = it->second;
+    if (inserted) {
+      Entry.LRUPosition = Shard.LRU.insert(Shard.LRU.begin(), desc);
+    } else {
+      Shard.LRU.splice(Shard.LRU.begin(), Shard.LRU, Entry.LRUPosition);
+    }
+    Entry.LastUsed = UseCounter.fetch_add(1, std::memory_order_relaxed);
+    Entry.CommandLists.emplace_back(std::move(cmdList));
+    Shard.NumCommandLists++;
+    NumCachedLists.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // The shard lock is released first, so that at most one shard is locked
+  // at a time while looking for the victim.
+  while (NumCachedLists.load(std::memory_order_relaxed) > MaxCachedLists) {
+    // The evicted command list is destroyed outside of the shard lock.
+    auto Evicted = evictOldestCommandList();
+    if (!Evicted) {
+      break;
+    }
+    Evictions.fetch_add(1, std::memory_order_relaxed);
+  }
 }
 
-size_t command_list_cache_t::getNumImmediateCommandLists() {
-  std::unique_lock<ur_mutex> Lock(ZeCommandListCacheMutex);
-  size_t NumLists = 0;
-  for (auto &Pair : ZeCommandListCache) {
-    if (std::holds_alternative<immediate_command_list_descriptor_t>(Pair.first))
-      NumLists += Pair.second.size();
+std::optional<raii::ze_command_list_handle_t>
+command_list_cache_t::evictOldestCommandList() {
+  for (;;) {
+    // Find the shard whose least recently used descriptor is the oldest of
+    // all the shards.
+    shard_t *Oldest = nullptr;
+    uint64_t OldestLastUsed = 0;
+    for (auto &Shard : Shards) {
+      std::unique_lock<ur_mutex> Lock(Shard.Mutex);
+      if (Shard.LRU.empty()) {
+        continue;
+      }
+      auto LastUsed = Shard.Entries.find(Shard.LRU.back())->second.LastUsed;
+      if (!Oldest || LastUsed < OldestLastUsed) {
+        Oldest = &Shard;
+        OldestLastUsed = LastUsed;
+      }
+    }
+    if (!Oldest) {
+      return std::nullopt;
+    }
+
+    std::unique_lock<ur_mutex> Lock(Oldest->Mutex);
+    // Another thread may have evicted or taken the command lists of the shard
+    // since it was inspected, or evicted enough already.
+    if (NumCachedLists.load(std::memory_order_relaxed) <= MaxCachedLists) {
+      return std::nullopt;
+    }
+    if (Oldest->LRU.empty()) {
+      continue;
+    }
+
+    auto VictimIt = Oldest->Entries.find(Oldest->LRU.back());
+    auto &Victim = VictimIt->second;
+    raii::ze_command_list_handle_t CommandList =
+        std::move(Victim.CommandLists.front());
+    Victim.CommandLists.pop_front();
+    Oldest->NumCommandLists--;
+    NumCachedLists.fetch_sub(1, std::memory_order_relaxed);
+    if (Victim.CommandLists.empty()) {
+      Oldest->LRU.pop_back();
+      Oldest->Entries.erase(VictimIt);
+    }
+    return CommandList;
   }
-  return NumLists;
 }
 
-size_t command_list_cache_t::getNumRegularCommandLists() {
-  std::unique_lock<ur_mutex> Lock(ZeCommandListCacheMutex);
+template <typename Descriptor>
+size_t command_list_cache_t::getNumCommandLists() {
   size_t NumLists = 0;
-  for (auto &Pair : ZeCommandListCache) {
-    if (std::holds_alternative<regular_command_list_descriptor_t>(Pair.first))
-      NumLists += Pair.second.size();
+  for (auto &Shard : Shards) {
+    std::unique_lock<ur_mutex> Lock(Shard.Mutex);
+    for (auto &Pair : Shard.Entries) {
+      if (std::holds_alternative<Descriptor>(Pair.first))
+        NumLists += Pair.second.CommandLists.size();
+    }
   }
   return NumLists;
 }
 
+size_t command_list_cache_t::getNumImmediateCommandLists() {
+  return getNumCommandLists<immediate_command_list_descriptor_t>();
+}
+
+size_t command_list_cache_t::getNumRegularCommandLists() {
+  return getNumCommandLists<regular_command_list_descriptor_t>();
+}
+
 } // namespace v2
@@ -9,8 +9,11 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <atomic>
+#include <deque>
 #include <functional>
-#include <stack>
+#include <list>
+#include <optional>
 
 #include "latency_tracker.hpp"
 #include <ur/ur.hpp>
@@ -54,7 +57,19 @@ struct command_list_descriptor_hash_t {
 };
 
 struct command_list_cache_t {
+  // Default upper bound of the number of cached command lists, can be
+  // overridden with UR_L0_V2_COMMAND_LIST_CACHE_SIZE.
+  static constexpr size_t DefaultMaxCachedLists = 128;
+  static constexpr size_t DefaultNumShards = 4;
+
   command_list_cache_t(ze_context_handle_t ZeContext);
+  // The cache is split in NumShards independently locked shards, which
+  // together hold at most MaxCachedLists command lists. When the bound is
+  // exceeded, the least recently used descriptor of all the shards loses its
+  // oldest command list.
+  command_list_cache_t(ze_context_handle_t ZeContext, size_t MaxCachedLists,
+                       size_t NumShards = DefaultNumShards);
+  ~command_list_cache_t();
 
   raii::command_list_unique_handle
   getImmediateCommandList(ze_device_handle_t ZeDevice, bool IsInOrder,
@@ -66,23 +81,61 @@ struct command_list_cache_t {
   getRegularCommandList(ze_device_handle_t ZeDevice, bool IsInOrder,
                         uint32_t Ordinal, bool CopyOffloadEnable);
 
+  struct stats_t {
+    // Command lists taken from the cache
+    uint64_t Hits;
+    // Command lists created because none was cached
+    uint64_t Misses;
+    // Command lists destroyed because the cache was full
+    uint64_t Evictions;
+  };
+  stats_t getStats() const;
+
   // For testing purposes
   size_t getNumImmediateCommandLists();
   size_t getNumRegularCommandLists();
 
 private:
+  // Command lists of one descriptor, the most recently returned at the back.
+  struct cache_entry_t {
+    std::deque<raii::ze_command_list_handle_t> CommandLists;
+    // Position of the descriptor in shard_t::LRU
+    std::list<command_list_descriptor_t>::iterator LRUPosition;
+    // Value of UseCounter when the descriptor was last used, orders the
+    // descriptors of different shards.
+    uint64_t LastUsed = 0;
+  };
+
+  struct shard_t {
+    ur_mutex Mutex{"v2.command_list_cache"};
+    std::unordered_map<command_list_descriptor_t, cache_entry_t,
+                       command_list_descriptor_hash_t>
+        Entries;
+    // Descriptors with cached command lists, the most recently used first.
+    std::list<command_list_descriptor_t> LRU;
+    size_t NumCommandLists = 0;
+  };
+
   ze_context_handle_t ZeContext;
-  std::unordered_map<command_list_descriptor_t,
-                     std::stack<raii::ze_command_list_handle_t>,
-                     command_list_descriptor_hash_t>
-      ZeCommandListCache;
-  ur_mutex ZeCommandListCacheMutex;
+  size_t MaxCachedLists;
+  std::vector<shard_t> Shards;
+  // Command lists cached in all the shards.
+  std::atomic<size_t> NumCachedLists{0};
+  // Incremented on every use of a descriptor.
+  std::atomic<uint64_t> UseCounter{0};
+
+  std::atomic<uint64_t> Hits{0};
+  std::atomic<uint64_t> Misses{0};
+  std::atomic<uint64_t> Evictions{0};
 
+  shard_t &getShard(const command_list_descriptor_t &desc);
   raii::ze_command_list_handle_t
   getCommandList(const command_list_descriptor_t &desc);
   void addCommandList(const command_list_descriptor_t &desc,
                       raii::ze_command_list_handle_t cmdList);
+  std::optional<raii::ze_command_list_handle_t> evictOldestCommandList();
   raii::ze_command_list_handle_t
   createCommandList(const command_list_descriptor_t &desc);
+  template <typename Descriptor> size_t getNumCommandLists();
 };
 } // namespace v2
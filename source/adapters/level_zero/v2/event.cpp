@@ -29,6 +29,8 @@ void ur_event_handle_t_::resetQueueAndCommand(ur_queue_handle_t hQueue,
                                               ur_command_t commandType) {
   this->hQueue = hQueue;
   this->commandType = commandType;
+  this->hSignalingCommandList = nullptr;
+  this->completed.store(false, std::memory_order_relaxed);
 }
 
 void ur_event_handle_t_::reset() {
@@ -126,6 +128,7 @@ uint64_t ur_event_handle_t_::getEventEndTimestamp() {
     // profiling info not ready
     return 0;
   }
+  markCompleted();
 
   adjustedEventEndTimestamp =
       adjustEndEventTimestamp(getEventStartTimestmap(), recordEventEndTimestamp,
@@ -152,6 +155,23 @@ ur_queue_handle_t ur_event_handle_t_::getQueue() const { return hQueue; }
 
 ur_command_t ur_event_handle_t_::getCommandType() const { return commandType; }
 
+void ur_event_handle_t_::setSignalingCommandList(
+    ze_command_list_handle_t hZeCommandList) {
+  hSignalingCommandList = hZeCommandList;
+}
+
+ze_command_list_handle_t ur_event_handle_t_::getSignalingCommandList() const {
+  return hSignalingCommandList;
+}
+
+void ur_event_handle_t_::markCompleted() {
+  completed.store(true, std::memory_order_release);
+}
+
+bool ur_event_handle_t_::isCompleted() const {
+  return completed.load(std::memory_order_acquire);
+}
+
 namespace ur::level_zero {
 ur_result_t urEventRetain(ur_event_handle_t hEvent) try {
   return hEvent->retain();
@@ -170,6 +190,7 @@ ur_result_t urEventWait(uint32_t numEvents,
   for (uint32_t i = 0; i < numEvents; ++i) {
     ZE2UR_CALL(zeEventHostSynchronize,
                (phEventWaitList[i]->getZeEvent(), UINT64_MAX));
+    phEventWaitList[i]->markCompleted();
   }
   return UR_RESULT_SUCCESS;
 } catch (...) {
@@ -188,6 +209,9 @@ ur_result_t urEventGetInfo(ur_event_handle_t hEvent, ur_event_info_t propName,
     if (zeStatus == ZE_RESULT_NOT_READY) {
       return returnValue(UR_EVENT_STATUS_SUBMITTED);
     } else {
+      if (zeStatus == ZE_RESULT_SUCCESS) {
+        hEvent->markCompleted();
+      }
       return returnValue(UR_EVENT_STATUS_COMPLETE);
     }
   }
@@ -9,6 +9,7 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <atomic>
 #include <stack>
 
 #include <ur/ur.hpp>
@@ -56,6 +57,21 @@ public:
   // Get the type of the command that this event is associated with
   ur_command_t getCommandType() const;
 
+  // Set the command list that signals this event, commands appended later to
+  // that list do not need to wait for the event if the list is in-order.
+  void setSignalingCommandList(ze_command_list_handle_t hZeCommandList);
+
+  // Command list that signals this event, nullptr if not known
+  ze_command_list_handle_t getSignalingCommandList() const;
+
+  // Remember that the event has been observed to be signaled, so that it can
+  // be dropped from wait lists without querying the driver.
+  void markCompleted();
+
+  // Tells if the event has been observed to be signaled. A false result does
+  // not mean that the event is still pending.
+  bool isCompleted() const;
+
   void recordStartTimestamp();
 
   // Get pointer to the end timestamp, and ze event handle.
@@ -68,6 +84,8 @@ public:
 private:
   ur_queue_handle_t hQueue = nullptr;
   ur_command_t commandType = UR_COMMAND_FORCE_UINT32;
+  ze_command_list_handle_t hSignalingCommandList = nullptr;
+  std::atomic<bool> completed = false;
   v2::raii::cache_borrowed_event zeEvent;
   v2::event_pool *pool;
 
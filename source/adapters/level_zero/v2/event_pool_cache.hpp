@@ -41,7 +41,7 @@ public:
   raii::cache_borrowed_event_pool borrow(DeviceId, event_flags_t flags);
 
 private:
-  ur_mutex mutex;
+  ur_mutex mutex{"v2.event_pool_cache"};
   ProviderCreateFunc providerCreate;
 
   struct event_descriptor {
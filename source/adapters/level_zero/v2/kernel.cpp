@@ -107,6 +107,8 @@ ur_result_t ur_kernel_handle_t_::release() {
 }
 
 void ur_kernel_handle_t_::completeInitialization() {
+  args = std::make_shared<const kernel_args_t>();
+
   // Cache kernel name. Should be the same for all devices
   assert(deviceKernels.size() > 0);
   nonEmptyKernel =
@@ -160,6 +162,10 @@ ur_kernel_handle_t_::getZeHandle(ur_device_handle_t hDevice) {
   return deviceKernel.hKernel.get();
 }
 
+ur_mutex &ur_kernel_handle_t_::getLaunchMutex(ur_device_handle_t hDevice) {
+  return deviceKernels[deviceIndex(hDevice)].value().launchMutex;
+}
+
 ur_kernel_handle_t_::common_properties_t
 ur_kernel_handle_t_::getCommonProperties() const {
   return zeCommonProperties.get();
@@ -193,21 +199,75 @@ ur_result_t ur_kernel_handle_t_::setArgValue(
     return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
   }
 
-  for (auto &singleDeviceKernel : deviceKernels) {
-    if (!singleDeviceKernel.has_value()) {
-      continue;
-    }
+  // The value is only passed to L0 at submission, catch the invalid size
+  // that L0 would report now.
+  if (argSize == 0) {
+    return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE;
+  }
 
-    auto zeResult = ZE_CALL_NOCHECK(zeKernelSetArgumentValue,
-                                    (singleDeviceKernel.value().hKernel.get(),
-                                     argIndex, argSize, pArgValue));
+  kernel_arg_t arg;
+  arg.size = argSize;
+  return setArg(argIndex, std::move(arg), pArgValue);
+}
 
-    if (zeResult == ZE_RESULT_ERROR_INVALID_ARGUMENT) {
+ur_result_t
+ur_kernel_handle_t_::setArgMemObj(uint32_t argIndex, ur_mem_handle_t hMem,
+                                  ur_mem_handle_t_::device_access_mode_t mode) {
+  if (argIndex > zeCommonProperties->numKernelArgs - 1) {
+    return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
+  }
+
+  kernel_arg_t arg;
+  arg.size = sizeof(void *);
+  arg.hMem = hMem;
+  arg.mode = mode;
+  return setArg(argIndex, std::move(arg), nullptr);
+}
+
+ur_result_t ur_kernel_handle_t_::setArg(uint32_t argIndex, kernel_arg_t arg,
+                                        const void *pArgValue) {
+  // L0 does not report the sizes of the arguments, it only checks them when
+  // a value is set. The first value of each argument is set right away to
+  // learn its size, the later ones are checked against it. This changes the
+  // state of the L0 kernel, so launches on its device are held off until the
+  // new arguments are published: their argument version is then older than
+  // the argument, which is set again at the next launch.
+  std::unique_lock<ur_mutex> probeLock;
+  if (pArgValue) {
+    if (argSizes.size() <= argIndex) {
+      argSizes.resize(argIndex + 1, 0);
+    }
+    if (argSizes[argIndex] == 0) {
+      probeLock = std::unique_lock<ur_mutex>(nonEmptyKernel->launchMutex);
+      auto zeResult = ZE_CALL_NOCHECK(
+          zeKernelSetArgumentValue,
+          (nonEmptyKernel->hKernel.get(), argIndex, arg.size, pArgValue));
+      if (zeResult == ZE_RESULT_ERROR_INVALID_ARGUMENT) {
+        return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE;
+      } else if (zeResult != ZE_RESULT_SUCCESS) {
+        return ze2urResult(zeResult);
+      }
+      argSizes[argIndex] = arg.size;
+    } else if (argSizes[argIndex] != arg.size) {
       return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE;
-    } else if (zeResult != ZE_RESULT_SUCCESS) {
-      return ze2urResult(zeResult);
     }
   }
+
+  // Launches may be reading the published arguments concurrently, so they are
+  // never changed in place: a copy with the new argument replaces them. Only
+  // the kernel mutex serializes the writers. The values are shared between
+  // the copies, a new value is always allocated.
+  auto newArgs = std::make_shared<kernel_args_t>(*std::atomic_load(&args));
+  if (newArgs->args.size() <= argIndex) {
+    newArgs->args.resize(argIndex + 1);
+  }
+  if (pArgValue) {
+    auto begin = static_cast<const char *>(pArgValue);
+    arg.value = std::make_shared<std::vector<char>>(begin, begin + arg.size);
+  }
+  arg.version = ++newArgs->version;
+  newArgs->args[argIndex] = std::move(arg);
+  std::atomic_store(&args, std::shared_ptr<const kernel_args_t>(newArgs));
   return UR_RESULT_SUCCESS;
 }
 
@@ -229,6 +289,7 @@ ur_result_t ur_kernel_handle_t_::setExecInfo(ur_kernel_exec_info_t propName,
   for (auto &kernel : deviceKernels) {
     if (!kernel.has_value())
       continue;
+    std::scoped_lock<ur_mutex> launchLock(kernel->launchMutex);
     if (propName == UR_KERNEL_EXEC_INFO_USM_INDIRECT_ACCESS &&
         *(static_cast<const ur_bool_t *>(pPropValue)) == true) {
       // The whole point for users really was to not need to know anything
@@ -269,8 +330,10 @@ ur_result_t ur_kernel_handle_t_::prepareForSubmission(
     ur_context_handle_t hContext, ur_device_handle_t hDevice,
     const size_t *pGlobalWorkOffset, uint32_t workDim, uint32_t groupSizeX,
     uint32_t groupSizeY, uint32_t groupSizeZ,
-    std::function<void(void *, void *, size_t)> migrate) {
-  auto hZeKernel = getZeHandle(hDevice);
+    std::function<void(void *, void *, size_t)> migrate,
+    wait_list_view waitList) {
+  auto &deviceKernel = deviceKernels[deviceIndex(hDevice)].value();
+  auto hZeKernel = deviceKernel.hKernel.get();
 
   if (pGlobalWorkOffset != NULL) {
     UR_CALL(
@@ -280,27 +343,74 @@ ur_result_t ur_kernel_handle_t_::prepareForSubmission(
   ZE2UR_CALL(zeKernelSetGroupSize,
              (hZeKernel, groupSizeX, groupSizeY, groupSizeZ));
 
-  for (auto &pending : pending_allocations) {
-    auto zePtr = pending.hMem->getDevicePtr(hDevice, pending.mode, 0,
-                                            pending.hMem->getSize(), migrate);
-    UR_CALL(setArgPointer(pending.argIndex, nullptr, zePtr));
+  std::shared_ptr<const kernel_args_t> snapshot = std::atomic_load(&args);
+
+  // With a single device in the context, the memory arguments stay where the
+  // last submission to the device migrated them.
+  bool singleDevice = hContext->getDevices().size() == 1;
+  if (singleDevice && snapshot->version == deviceKernel.argsVersion) {
+    return UR_RESULT_SUCCESS;
   }
-  pending_allocations.clear();
 
-  return UR_RESULT_SUCCESS;
-}
+  for (uint32_t argIndex = 0; argIndex < snapshot->args.size(); argIndex++) {
+    auto &arg = snapshot->args[argIndex];
+    bool argChanged = arg.version > deviceKernel.argsVersion;
+    if (!argChanged && (!arg.hMem || singleDevice || !migrate)) {
+      continue;
+    }
 
-ur_result_t ur_kernel_handle_t_::addPendingMemoryAllocation(
-    pending_memory_allocation_t allocation) {
-  if (allocation.argIndex > zeCommonProperties->numKernelArgs - 1) {
-    return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
-  }
+    const void *pArgValue = arg.value ? arg.value->data() : nullptr;
+    void *zePtr = nullptr;
+    if (arg.hMem) {
+      // Another device may have written the memory arguments since the last
+      // submission to the device. Their device pointer does not change once
+      // allocated, so the argument is only set if changed.
+      auto size = arg.hMem->getSize();
+      if (!argChanged) {
+        std::shared_lock<ur_shared_mutex> memLock(arg.hMem->getMutex());
+        if (arg.hMem->isUpToDate(hDevice, arg.mode, 0, size)) {
+          continue;
+        }
+      }
+
+      std::scoped_lock<ur_shared_mutex> memLock(arg.hMem->getMutex());
+      zePtr = migrate ? arg.hMem->getDevicePtr(hDevice, arg.mode, 0, size,
+                                               migrate, waitList)
+                      : arg.hMem->getDeviceAllocationPtr(hDevice, 0);
+      pArgValue = &zePtr;
+    }
 
-  pending_allocations.push_back(allocation);
+    if (!argChanged) {
+      continue;
+    }
+
+    auto zeResult = ZE_CALL_NOCHECK(zeKernelSetArgumentValue,
+                                    (hZeKernel, argIndex, arg.size, pArgValue));
+    if (zeResult == ZE_RESULT_ERROR_INVALID_ARGUMENT) {
+      return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE;
+    } else if (zeResult != ZE_RESULT_SUCCESS) {
+      return ze2urResult(zeResult);
+    }
+  }
+  deviceKernel.argsVersion = snapshot->version;
 
   return UR_RESULT_SUCCESS;
 }
 
+std::vector<std::pair<ur_mem_handle_t, ur_mem_handle_t_::device_access_mode_t>>
+ur_kernel_handle_t_::getMemArgs() const {
+  std::vector<
+      std::pair<ur_mem_handle_t, ur_mem_handle_t_::device_access_mode_t>>
+      memArgs;
+  auto snapshot = std::atomic_load(&args);
+  for (auto &arg : snapshot->args) {
+    if (arg.hMem) {
+      memArgs.emplace_back(arg.hMem, arg.mode);
+    }
+  }
+  return memArgs;
+}
+
 std::vector<char> ur_kernel_handle_t_::getSourceAttributes() const {
   uint32_t size;
   ZE2UR_CALL_THROWS(zeKernelGetSourceAttributes,
@@ -312,6 +422,23 @@ std::vector<char> ur_kernel_handle_t_::getSourceAttributes() const {
   return attributes;
 }
 
+ur_mem_handle_t_::device_access_mode_t memAccessFromKernelProperties(
+    const ur_kernel_arg_mem_obj_properties_t *pProperties) {
+  if (pProperties) {
+    switch (pProperties->memoryAccess) {
+    case UR_MEM_FLAG_READ_WRITE:
+      return ur_mem_handle_t_::device_access_mode_t::read_write;
+    case UR_MEM_FLAG_WRITE_ONLY:
+      return ur_mem_handle_t_::device_access_mode_t::write_only;
+    case UR_MEM_FLAG_READ_ONLY:
+      return ur_mem_handle_t_::device_access_mode_t::read_only;
+    default:
+      return ur_mem_handle_t_::device_access_mode_t::read_write;
+    }
+  }
+  return ur_mem_handle_t_::device_access_mode_t::read_write;
+}
+
 namespace ur::level_zero {
 ur_result_t urKernelCreate(ur_program_handle_t hProgram,
                            const char *pKernelName,
@@ -405,23 +532,6 @@ ur_result_t urKernelSetArgPointer(
   return exceptionToResult(std::current_exception());
 }
 
-static ur_mem_handle_t_::device_access_mode_t memAccessFromKernelProperties(
-    const ur_kernel_arg_mem_obj_properties_t *pProperties) {
-  if (pProperties) {
-    switch (pProperties->memoryAccess) {
-    case UR_MEM_FLAG_READ_WRITE:
-      return ur_mem_handle_t_::device_access_mode_t::read_write;
-    case UR_MEM_FLAG_WRITE_ONLY:
-      return ur_mem_handle_t_::device_access_mode_t::write_only;
-    case UR_MEM_FLAG_READ_ONLY:
-      return ur_mem_handle_t_::device_access_mode_t::read_only;
-    default:
-      return ur_mem_handle_t_::device_access_mode_t::read_write;
-    }
-  }
-  return ur_mem_handle_t_::device_access_mode_t::read_write;
-}
-
 ur_result_t
 urKernelSetArgMemObj(ur_kernel_handle_t hKernel, uint32_t argIndex,
                      const ur_kernel_arg_mem_obj_properties_t *pProperties,
@@ -430,10 +540,8 @@ urKernelSetArgMemObj(ur_kernel_handle_t hKernel, uint32_t argIndex,
 
   std::scoped_lock<ur_shared_mutex> guard(hKernel->Mutex);
 
-  UR_CALL(hKernel->addPendingMemoryAllocation(
-      {hArgValue, memAccessFromKernelProperties(pProperties), argIndex}));
-
-  return UR_RESULT_SUCCESS;
+  return hKernel->setArgMemObj(argIndex, hArgValue,
+                               memAccessFromKernelProperties(pProperties));
 } catch (...) {
   return exceptionToResult(std::current_exception());
 }
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "../program.hpp"
 
 #include "common.hpp"
@@ -23,12 +25,17 @@ struct ur_single_device_kernel_t {
   ur_device_handle_t hDevice;
   v2::raii::ze_kernel_handle_t hKernel;
   mutable ZeCache<ZeStruct<ze_kernel_properties_t>> zeKernelProperties;
+
+  // The arguments, group size and offset are state of the L0 kernel, so the
+  // launches on the device are serialized from prepareForSubmission until the
+  // launch is appended.
+  ur_mutex launchMutex{"v2.kernel.launch"};
+
+  // Version of the arguments last set on the L0 kernel.
+  uint64_t argsVersion = 0;
 };
 
 struct ur_kernel_handle_t_ : _ur_object {
-private:
-  struct pending_memory_allocation_t;
-
 public:
   struct common_properties_t {
     std::string name;
@@ -57,6 +64,10 @@ public:
   // Get properties of the kernel.
   const ze_kernel_properties_t &getProperties(ur_device_handle_t hDevice) const;
 
+  // Get the mutex to hold around prepareForSubmission and the append of the
+  // launch to a command list of the device.
+  ur_mutex &getLaunchMutex(ur_device_handle_t hDevice);
+
   // Implementation of urKernelSetArgValue.
   ur_result_t setArgValue(uint32_t argIndex, size_t argSize,
                           const ur_kernel_arg_value_properties_t *pProperties,
@@ -68,6 +79,11 @@ public:
                 const ur_kernel_arg_pointer_properties_t *pProperties,
                 const void *pArgValue);
 
+  // Implementation of urKernelSetArgMemObj, the device pointer of the memory
+  // object is only known at submission.
+  ur_result_t setArgMemObj(uint32_t argIndex, ur_mem_handle_t hMem,
+                           ur_mem_handle_t_::device_access_mode_t mode);
+
   // Implementation of urKernelSetExecInfo.
   ur_result_t setExecInfo(ur_kernel_exec_info_t propName,
                           const void *pPropValue);
@@ -77,18 +93,23 @@ public:
   // Perform cleanup.
   ur_result_t release();
 
-  // Add a pending memory allocation for which device is not yet known.
-  ur_result_t
-  addPendingMemoryAllocation(pending_memory_allocation_t allocation);
-
-  // Set all required values for the kernel before submission (including pending
-  // memory allocations).
+  // Set all required values for the kernel before submission (including the
+  // arguments changed since the last submission to the device) and migrate
+  // the memory arguments to the device. If migrate is null, the memory
+  // arguments are only allocated on the device. The launch mutex of the
+  // device must be held.
   ur_result_t
   prepareForSubmission(ur_context_handle_t hContext, ur_device_handle_t hDevice,
                        const size_t *pGlobalWorkOffset, uint32_t workDim,
                        uint32_t groupSizeX, uint32_t groupSizeY,
                        uint32_t groupSizeZ,
-                       std::function<void(void *, void *, size_t)> migrate);
+                       std::function<void(void *, void *, size_t)> migrate,
+                       wait_list_view waitList);
+
+  // Memory object arguments of the kernel with their access mode.
+  std::vector<
+      std::pair<ur_mem_handle_t, ur_mem_handle_t_::device_access_mode_t>>
+  getMemArgs() const;
 
 private:
   // Keep the program of the kernel.
@@ -103,16 +124,46 @@ private:
   // Index of the device in the deviceKernels vector.
   size_t deviceIndex(ur_device_handle_t hDevice) const;
 
-  struct pending_memory_allocation_t {
-    ur_mem_handle_t hMem;
-    ur_mem_handle_t_::device_access_mode_t mode;
-    uint32_t argIndex;
+  struct kernel_arg_t {
+    // Version of the arguments in which the argument was set, 0 if unset.
+    uint64_t version = 0;
+    size_t size = 0;
+    // Value of the argument, null for a null pointer or local memory.
+    std::shared_ptr<std::vector<char>> value;
+    // Memory object whose device pointer is the value of the argument.
+    ur_mem_handle_t hMem = nullptr;
+    ur_mem_handle_t_::device_access_mode_t mode =
+        ur_mem_handle_t_::device_access_mode_t::read_write;
+  };
+
+  struct kernel_args_t {
+    // Incremented each time an argument is set.
+    uint64_t version = 0;
+    std::vector<kernel_arg_t> args;
   };
 
-  std::vector<pending_memory_allocation_t> pending_allocations;
+  // Arguments of the kernel, never modified once published. Setting an
+  // argument publishes a modified copy with std::atomic_store, submissions
+  // take a snapshot with std::atomic_load under the launch mutex of their
+  // device only, and set the arguments changed since the last submission to
+  // the device.
+  std::shared_ptr<const kernel_args_t> args;
+
+  // Sizes of the arguments accepted by L0, indexed by argument, 0 if no value
+  // has been set yet. Guarded by the kernel mutex.
+  std::vector<size_t> argSizes;
+
+  // Replace an argument, with a copy of pArgValue as value if it is not null.
+  // The kernel mutex must be held.
+  ur_result_t setArg(uint32_t argIndex, kernel_arg_t arg,
+                     const void *pArgValue);
 
   void completeInitialization();
 
   // pointer to any non-null kernel in deviceKernels
   ur_single_device_kernel_t *nonEmptyKernel;
 };
+
+// Access mode of a memory object argument with the given properties.
+ur_mem_handle_t_::device_access_mode_t memAccessFromKernelProperties(
+    const ur_kernel_arg_mem_obj_properties_t *pProperties);
@@ -40,6 +40,11 @@ size_t ur_mem_handle_t_::getSize() const { return size; }
 
 ur_shared_mutex &ur_mem_handle_t_::getMutex() { return Mutex; }
 
+bool ur_mem_handle_t_::isUpToDate(ur_device_handle_t, device_access_mode_t,
+                                  size_t, size_t) const {
+  return true;
+}
+
 ur_usm_handle_t_::ur_usm_handle_t_(ur_context_handle_t hContext, size_t size,
                                    const void *ptr)
     : ur_mem_handle_t_(hContext, size, device_access_mode_t::read_write),
@@ -49,7 +54,8 @@ ur_usm_handle_t_::~ur_usm_handle_t_() {}
 
 void *ur_usm_handle_t_::getDevicePtr(
     ur_device_handle_t hDevice, device_access_mode_t access, size_t offset,
-    size_t size, std::function<void(void *src, void *dst, size_t)> migrate) {
+    size_t size, std::function<void(void *src, void *dst, size_t)> migrate,
+    wait_list_view) {
   std::ignore = hDevice;
   std::ignore = access;
   std::ignore = offset;
@@ -58,9 +64,18 @@ void *ur_usm_handle_t_::getDevicePtr(
   return ptr;
 }
 
+void *ur_usm_handle_t_::getDeviceAllocationPtr(ur_device_handle_t hDevice,
+                                               size_t offset) {
+  std::ignore = hDevice;
+  std::ignore = offset;
+  return ptr;
+}
+
 void *ur_usm_handle_t_::mapHostPtr(
-    ur_map_flags_t flags, size_t offset, size_t size,
-    std::function<void(void *src, void *dst, size_t)>) {
+    ur_device_handle_t hDevice, ur_map_flags_t flags, size_t offset,
+    size_t size, std::function<void(void *src, void *dst, size_t)>,
+    std::function<void *(size_t size)>, wait_list_view) {
+  std::ignore = hDevice;
   std::ignore = flags;
   std::ignore = offset;
   std::ignore = size;
@@ -68,7 +83,10 @@ void *ur_usm_handle_t_::mapHostPtr(
 }
 
 void ur_usm_handle_t_::unmapHostPtr(
-    void *pMappedPtr, std::function<void(void *src, void *dst, size_t)>) {
+    ur_device_handle_t hDevice, void *pMappedPtr,
+    std::function<void(void *src, void *dst, size_t)>,
+    std::function<void(void *ptr)>, wait_list_view) {
+  std::ignore = hDevice;
   std::ignore = pMappedPtr;
   /* nop */
 }
@@ -124,7 +142,8 @@ ur_integrated_mem_handle_t::ur_integrated_mem_handle_t(
 
 void *ur_integrated_mem_handle_t::getDevicePtr(
     ur_device_handle_t hDevice, device_access_mode_t access, size_t offset,
-    size_t size, std::function<void(void *src, void *dst, size_t)> migrate) {
+    size_t size, std::function<void(void *src, void *dst, size_t)> migrate,
+    wait_list_view) {
   std::ignore = hDevice;
   std::ignore = access;
   std::ignore = offset;
@@ -133,9 +152,19 @@ void *ur_integrated_mem_handle_t::getDevicePtr(
   return ptr.get();
 }
 
+void *
+ur_integrated_mem_handle_t::getDeviceAllocationPtr(ur_device_handle_t hDevice,
+                                                   size_t offset) {
+  std::ignore = hDevice;
+  std::ignore = offset;
+  return ptr.get();
+}
+
 void *ur_integrated_mem_handle_t::mapHostPtr(
-    ur_map_flags_t flags, size_t offset, size_t size,
-    std::function<void(void *src, void *dst, size_t)> migrate) {
+    ur_device_handle_t hDevice, ur_map_flags_t flags, size_t offset,
+    size_t size, std::function<void(void *src, void *dst, size_t)> migrate,
+    std::function<void *(size_t size)>, wait_list_view) {
+  std::ignore = hDevice;
   std::ignore = flags;
   std::ignore = offset;
   std::ignore = size;
@@ -144,14 +173,18 @@ void *ur_integrated_mem_handle_t::mapHostPtr(
 }
 
 void ur_integrated_mem_handle_t::unmapHostPtr(
-    void *pMappedPtr, std::function<void(void *src, void *dst, size_t)>) {
+    ur_device_handle_t hDevice, void *pMappedPtr,
+    std::function<void(void *src, void *dst, size_t)>,
+    std::function<void(void *ptr)>, wait_list_view) {
+  std::ignore = hDevice;
   std::ignore = pMappedPtr;
   /* nop */
 }
 
 static ur_result_t synchronousZeCopy(ur_context_handle_t hContext,
                                      ur_device_handle_t hDevice, void *dst,
-                                     const void *src, size_t size) {
+                                     const void *src, size_t size,
+                                     wait_list_view waitList = {}) {
   auto commandList = hContext->commandListCache.getImmediateCommandList(
       hDevice->ZeDevice, true,
       hDevice
@@ -161,11 +194,20 @@ static ur_result_t synchronousZeCopy(ur_context_handle_t hContext,
       std::nullopt);
 
   ZE2UR_CALL(zeCommandListAppendMemoryCopy,
-             (commandList.get(), dst, src, size, nullptr, 0, nullptr));
+             (commandList.get(), dst, src, size, nullptr, waitList.second,
+              waitList.first));
 
   return UR_RESULT_SUCCESS;
 }
 
+// Granularity at which the validity of the allocations of discrete buffers is
+// tracked.
+static constexpr size_t migrationPageSize = 64 * 1024;
+
+static size_t getPageCount(size_t size) {
+  return (size + migrationPageSize - 1) / migrationPageSize;
+}
+
 void *ur_discrete_mem_handle_t::allocateOnDevice(ur_device_handle_t hDevice,
                                                  size_t size) {
   assert(hDevice);
@@ -185,7 +227,25 @@ void *ur_discrete_mem_handle_t::allocateOnDevice(ur_device_handle_t hDevice,
         }
       });
 
-  activeAllocationDevice = hDevice;
+  allocationDevices.push_back(hDevice);
+  validPages[id].assign(getPageCount(size), false);
+
+  return ptr;
+}
+
+void *ur_discrete_mem_handle_t::allocateHostCopy() {
+  assert(hostCopy.get() == nullptr);
+
+  void *ptr;
+  UR_CALL_THROWS(hContext->getDefaultUSMPool()->allocate(
+      hContext, nullptr, nullptr, UR_USM_TYPE_HOST, getSize(), &ptr));
+
+  hostCopy = usm_unique_ptr_t(ptr, [hContext = this->hContext](void *ptr) {
+    auto ret = hContext->getDefaultUSMPool()->free(ptr);
+    if (ret != UR_RESULT_SUCCESS) {
+      logger::error("Failed to free host memory: {}", ret);
+    }
+  });
 
   return ptr;
 }
@@ -200,6 +260,7 @@ ur_discrete_mem_handle_t::migrateBufferTo(ur_device_handle_t hDevice, void *src,
                                           : allocateOnDevice(hDevice, size);
 
   UR_CALL(synchronousZeCopy(hContext, hDevice, dst, src, size));
+  validPages[Id].assign(getPageCount(size), true);
 
   return UR_RESULT_SUCCESS;
 }
@@ -209,7 +270,8 @@ ur_discrete_mem_handle_t::ur_discrete_mem_handle_t(
     device_access_mode_t accessMode)
     : ur_mem_handle_t_(hContext, size, accessMode),
       deviceAllocations(hContext->getPlatform()->getNumDevices()),
-      activeAllocationDevice(nullptr), hostAllocations() {
+      validPages(hContext->getPlatform()->getNumDevices()),
+      hostValidPages(getPageCount(size)), hostAllocations() {
   if (hostPtr) {
     auto initialDevice = hContext->getDevices()[0];
     UR_CALL_THROWS(migrateBufferTo(initialDevice, hostPtr, size));
@@ -222,7 +284,8 @@ ur_discrete_mem_handle_t::ur_discrete_mem_handle_t(
     bool ownZePtr)
     : ur_mem_handle_t_(hContext, size, accessMode),
       deviceAllocations(hContext->getPlatform()->getNumDevices()),
-      activeAllocationDevice(hDevice), writeBackPtr(writeBackMemory),
+      validPages(hContext->getPlatform()->getNumDevices()),
+      hostValidPages(getPageCount(size)), writeBackPtr(writeBackMemory),
       hostAllocations() {
 
   if (!devicePtr) {
@@ -239,74 +302,263 @@ ur_discrete_mem_handle_t::ur_discrete_mem_handle_t(
             logger::error("Failed to free device memory: {}", ret);
           }
         });
+    allocationDevices.push_back(hDevice);
+    validPages[hDevice->Id.value()].assign(getPageCount(size), true);
   }
 }
 
 ur_discrete_mem_handle_t::~ur_discrete_mem_handle_t() {
-  if (!activeAllocationDevice || !writeBackPtr)
+  if (p2pMigratedBytes || hostMigratedBytes) {
+    logger::debug("ur_discrete_mem_handle_t: {} bytes migrated P2P, {} bytes "
+                  "migrated through the host",
+                  p2pMigratedBytes, hostMigratedBytes);
+  }
+
+  // The allocations are returned to the pool right away. Unlike the map
+  // staging memory, which the queue frees once the unmap has completed, they
+  // are not reclaimed asynchronously: the buffer does not track the commands
+  // using it, so the caller must have synchronized with them.
+  if (!writeBackPtr)
+    return;
+
+  // Each page is written back from where its latest content is.
+  auto numPages = getPageCount(getSize());
+  size_t page = 0;
+  while (page < numPages) {
+    auto source = getPageSource(page, nullptr);
+    size_t endPage = page + 1;
+    while (endPage < numPages && getPageSource(endPage, nullptr) == source) {
+      endPage++;
+    }
+
+    auto runOffset = page * migrationPageSize;
+    auto runSize = std::min(endPage * migrationPageSize, getSize()) - runOffset;
+    auto dstPtr = ur_cast<char *>(writeBackPtr) + runOffset;
+    if (source && *source) {
+      auto srcPtr =
+          ur_cast<char *>(deviceAllocations[(*source)->Id.value()].get());
+      synchronousZeCopy(hContext, *source, dstPtr, srcPtr + runOffset,
+                        runSize);
+    } else if (source) {
+      std::memcpy(dstPtr, ur_cast<char *>(hostCopy.get()) + runOffset,
+                  runSize);
+    }
+
+    page = endPage;
+  }
+}
+
+ur_discrete_mem_handle_t::page_source_t
+ur_discrete_mem_handle_t::getPageSource(size_t page,
+                                        ur_device_handle_t hDevice) const {
+  if (hDevice) {
+    for (auto hP2PDevice : hContext->getP2PDevices(hDevice)) {
+      auto &valid = validPages[hP2PDevice->Id.value()];
+      if (!valid.empty() && valid[page]) {
+        return hP2PDevice;
+      }
+    }
+  }
+
+  if (hostValidPages[page]) {
+    return page_source_t(nullptr);
+  }
+
+  for (auto hSrcDevice : allocationDevices) {
+    if (validPages[hSrcDevice->Id.value()][page]) {
+      return hSrcDevice;
+    }
+  }
+
+  return std::nullopt;
+}
+
+void ur_discrete_mem_handle_t::migratePagesTo(
+    ur_device_handle_t hDevice, size_t firstPage, size_t lastPage,
+    const std::function<void(void *src, void *dst, size_t)> &migrate,
+    wait_list_view waitList) {
+  auto &dstValid = validPages[hDevice->Id.value()];
+  auto dstPtr = ur_cast<char *>(deviceAllocations[hDevice->Id.value()].get());
+  auto &p2pDevices = hContext->getP2PDevices(hDevice);
+
+  size_t page = firstPage;
+  while (page < lastPage) {
+    if (dstValid[page]) {
+      page++;
+      continue;
+    }
+
+    // Consecutive pages with the same source are migrated by a single copy.
+    auto source = getPageSource(page, hDevice);
+    size_t endPage = page + 1;
+    while (endPage < lastPage && !dstValid[endPage] &&
+           getPageSource(endPage, hDevice) == source) {
+      endPage++;
+    }
+
+    auto runOffset = page * migrationPageSize;
+    auto runSize = std::min(endPage * migrationPageSize, getSize()) - runOffset;
+    if (!source) {
+      // The pages have not been written yet, there is nothing to copy.
+    } else if (!*source) {
+      migrate(ur_cast<char *>(hostCopy.get()) + runOffset, dstPtr + runOffset,
+              runSize);
+      hostMigratedBytes += runSize;
+    } else {
+      auto hSrcDevice = *source;
+      auto srcPtr =
+          ur_cast<char *>(deviceAllocations[hSrcDevice->Id.value()].get());
+      if (std::find(p2pDevices.begin(), p2pDevices.end(), hSrcDevice) !=
+          p2pDevices.end()) {
+        migrate(srcPtr + runOffset, dstPtr + runOffset, runSize);
+        p2pMigratedBytes += runSize;
+      } else {
+        // The device cannot access the memory of the source device, so the
+        // pages are staged in the host copy. That copy is done synchronously
+        // on the source device after the wait list, which has to hold the
+        // commands writing the pages on the queues of the source device.
+        auto hostPtr = ur_cast<char *>(hostCopy ? hostCopy.get()
+                                                : allocateHostCopy());
+        UR_CALL_THROWS(synchronousZeCopy(hContext, hSrcDevice,
+                                         hostPtr + runOffset,
+                                         srcPtr + runOffset, runSize,
+                                         waitList));
+        std::fill(hostValidPages.begin() + page,
+                  hostValidPages.begin() + endPage, true);
+
+        migrate(hostPtr + runOffset, dstPtr + runOffset, runSize);
+        hostMigratedBytes += runSize;
+      }
+    }
+
+    std::fill(dstValid.begin() + page, dstValid.begin() + endPage, true);
+    page = endPage;
+  }
+}
+
+void ur_discrete_mem_handle_t::migrateRangeTo(
+    ur_device_handle_t hDevice, size_t offset, size_t size, bool overwrite,
+    const std::function<void(void *src, void *dst, size_t)> &migrate,
+    wait_list_view waitList) {
+  auto firstPage = offset / migrationPageSize;
+  auto lastPage = getPageCount(offset + size);
+
+  if (!overwrite) {
+    migratePagesTo(hDevice, firstPage, lastPage, migrate, waitList);
     return;
+  }
 
-  auto srcPtr = ur_cast<char *>(
-      deviceAllocations[activeAllocationDevice->Id.value()].get());
-  synchronousZeCopy(hContext, activeAllocationDevice, writeBackPtr, srcPtr,
-                    getSize());
+  // The rest of the pages the range partially covers has to be kept.
+  if (offset % migrationPageSize) {
+    migratePagesTo(hDevice, firstPage, firstPage + 1, migrate, waitList);
+  }
+  auto end = offset + size;
+  if (end % migrationPageSize && end < getSize() && lastPage > firstPage) {
+    migratePagesTo(hDevice, lastPage - 1, lastPage, migrate, waitList);
+  }
+}
+
+void ur_discrete_mem_handle_t::invalidateRangeExcept(ur_device_handle_t hDevice,
+                                                     size_t offset,
+                                                     size_t size) {
+  auto firstPage = offset / migrationPageSize;
+  auto lastPage = getPageCount(offset + size);
+
+  for (auto hOtherDevice : allocationDevices) {
+    auto &valid = validPages[hOtherDevice->Id.value()];
+    std::fill(valid.begin() + firstPage, valid.begin() + lastPage,
+              hOtherDevice == hDevice);
+  }
+  std::fill(hostValidPages.begin() + firstPage,
+            hostValidPages.begin() + lastPage, false);
 }
 
 void *ur_discrete_mem_handle_t::getDevicePtr(
     ur_device_handle_t hDevice, device_access_mode_t access, size_t offset,
-    size_t size, std::function<void(void *src, void *dst, size_t)> migrate) {
+    size_t size, std::function<void(void *src, void *dst, size_t)> migrate,
+    wait_list_view waitList) {
   TRACK_SCOPE_LATENCY("ur_discrete_mem_handle_t::getDevicePtr");
 
-  std::ignore = access;
-  std::ignore = size;
-  std::ignore = migrate;
+  if (!hDevice) {
+    hDevice = allocationDevices.empty() ? hContext->getDevices()[0]
+                                        : allocationDevices[0];
+  }
 
-  if (!activeAllocationDevice) {
-    if (!hDevice) {
-      hDevice = hContext->getDevices()[0];
-    }
+  auto ptr = getDeviceAllocationPtr(hDevice, offset);
 
-    allocateOnDevice(hDevice, getSize());
+  if (!migrate) {
+    // There is no command list to record the migration into.
+    migrate = [this, hDevice](void *src, void *dst, size_t bytes) {
+      UR_CALL_THROWS(synchronousZeCopy(hContext, hDevice, dst, src, bytes));
+    };
   }
 
-  char *ptr;
-  if (activeAllocationDevice == hDevice) {
-    ptr = ur_cast<char *>(deviceAllocations[hDevice->Id.value()].get());
-    return ptr + offset;
+  // A kernel may not write all of the memory of its write-only arguments, so
+  // the range is migrated whatever the access is.
+  migrateRangeTo(hDevice, offset, size, false, migrate, waitList);
+  if (access != device_access_mode_t::read_only) {
+    invalidateRangeExcept(hDevice, offset, size);
   }
 
-  auto &p2pDevices = hContext->getP2PDevices(hDevice);
-  auto p2pAccessible = std::find(p2pDevices.begin(), p2pDevices.end(),
-                                 activeAllocationDevice) != p2pDevices.end();
+  return ptr;
+}
+
+void *
+ur_discrete_mem_handle_t::getDeviceAllocationPtr(ur_device_handle_t hDevice,
+                                                 size_t offset) {
+  if (!hDevice) {
+    hDevice = allocationDevices.empty() ? hContext->getDevices()[0]
+                                        : allocationDevices[0];
+  }
+
+  auto id = hDevice->Id.value();
+  if (!deviceAllocations[id]) {
+    allocateOnDevice(hDevice, getSize());
+  }
+
+  return ur_cast<char *>(deviceAllocations[id].get()) + offset;
+}
+
+bool ur_discrete_mem_handle_t::isUpToDate(ur_device_handle_t hDevice,
+                                          device_access_mode_t access,
+                                          size_t offset, size_t size) const {
+  if (!hDevice || !deviceAllocations[hDevice->Id.value()]) {
+    return false;
+  }
 
-  if (!p2pAccessible) {
-    // TODO: migrate buffer through the host
-    throw UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  auto firstPage = offset / migrationPageSize;
+  auto lastPage = getPageCount(offset + size);
+  for (auto hOtherDevice : allocationDevices) {
+    auto &valid = validPages[hOtherDevice->Id.value()];
+    bool expected = hOtherDevice == hDevice;
+    for (auto page = firstPage; page < lastPage; page++) {
+      // Writes have to invalidate the pages on the other devices.
+      if (valid[page] != expected &&
+          (expected || access != device_access_mode_t::read_only)) {
+        return false;
+      }
+    }
   }
 
-  // TODO: see if it's better to migrate the memory to the specified device
-  return ur_cast<char *>(
-             deviceAllocations[activeAllocationDevice->Id.value()].get()) +
-         offset;
+  if (access == device_access_mode_t::read_only) {
+    return true;
+  }
+  return std::none_of(hostValidPages.begin() + firstPage,
+                      hostValidPages.begin() + lastPage,
+                      [](bool valid) { return valid; });
 }
 
 void *ur_discrete_mem_handle_t::mapHostPtr(
-    ur_map_flags_t flags, size_t offset, size_t size,
-    std::function<void(void *src, void *dst, size_t)> migrate) {
+    ur_device_handle_t hDevice, ur_map_flags_t flags, size_t offset,
+    size_t size, std::function<void(void *src, void *dst, size_t)> migrate,
+    std::function<void *(size_t size)> allocHost, wait_list_view waitList) {
   TRACK_SCOPE_LATENCY("ur_discrete_mem_handle_t::mapHostPtr");
-  // TODO: use async alloc?
-
-  void *ptr;
-  UR_CALL_THROWS(hContext->getDefaultUSMPool()->allocate(
-      hContext, nullptr, nullptr, UR_USM_TYPE_HOST, size, &ptr));
 
-  hostAllocations.emplace_back(ptr, size, offset, flags);
+  hostAllocations.emplace_back(allocHost(size), size, offset, flags);
 
-  if (activeAllocationDevice && (flags & UR_MAP_FLAG_READ)) {
-    auto srcPtr =
-        ur_cast<char *>(
-            deviceAllocations[activeAllocationDevice->Id.value()].get()) +
-        offset;
+  if (!allocationDevices.empty() && (flags & UR_MAP_FLAG_READ)) {
+    auto srcPtr = getDevicePtr(hDevice, device_access_mode_t::read_only,
+                               offset, size, migrate, waitList);
     migrate(srcPtr, hostAllocations.back().ptr, size);
   }
 
@@ -314,31 +566,34 @@ void *ur_discrete_mem_handle_t::mapHostPtr(
 }
 
 void ur_discrete_mem_handle_t::unmapHostPtr(
-    void *pMappedPtr,
-    std::function<void(void *src, void *dst, size_t)> migrate) {
+    ur_device_handle_t hDevice, void *pMappedPtr,
+    std::function<void(void *src, void *dst, size_t)> migrate,
+    std::function<void(void *ptr)> freeHost, wait_list_view waitList) {
   TRACK_SCOPE_LATENCY("ur_discrete_mem_handle_t::unmapHostPtr");
 
-  for (auto &hostAllocation : hostAllocations) {
+  for (auto it = hostAllocations.begin(); it != hostAllocations.end(); ++it) {
+    auto &hostAllocation = *it;
     if (hostAllocation.ptr == pMappedPtr) {
-      void *devicePtr = nullptr;
-      if (activeAllocationDevice) {
-        devicePtr =
-            ur_cast<char *>(
-                deviceAllocations[activeAllocationDevice->Id.value()].get()) +
-            hostAllocation.offset;
-      } else if (!(hostAllocation.flags &
-                   UR_MAP_FLAG_WRITE_INVALIDATE_REGION)) {
-        devicePtr = ur_cast<char *>(getDevicePtr(
-            hContext->getDevices()[0], device_access_mode_t::read_only,
-            hostAllocation.offset, hostAllocation.size, migrate));
-      }
+      // Only writable mappings are copied back, overwriting their range.
+      if (hostAllocation.flags &
+          (UR_MAP_FLAG_WRITE | UR_MAP_FLAG_WRITE_INVALIDATE_REGION)) {
+        auto id = hDevice->Id.value();
+        if (!deviceAllocations[id]) {
+          allocateOnDevice(hDevice, getSize());
+        }
+        migrateRangeTo(hDevice, hostAllocation.offset, hostAllocation.size,
+                       true, migrate, waitList);
+        invalidateRangeExcept(hDevice, hostAllocation.offset,
+                              hostAllocation.size);
 
-      if (devicePtr) {
+        auto devicePtr = ur_cast<char *>(deviceAllocations[id].get()) +
+                         hostAllocation.offset;
         migrate(hostAllocation.ptr, devicePtr, hostAllocation.size);
       }
 
-      // TODO: use async free here?
-      UR_CALL_THROWS(hContext->getDefaultUSMPool()->free(hostAllocation.ptr));
+      // The copy above may still be reading the memory.
+      freeHost(hostAllocation.ptr);
+      hostAllocations.erase(it);
       return;
     }
   }
@@ -377,21 +632,37 @@ ur_mem_sub_buffer_t::~ur_mem_sub_buffer_t() {
 
 void *ur_mem_sub_buffer_t::getDevicePtr(
     ur_device_handle_t hDevice, device_access_mode_t access, size_t offset,
-    size_t size, std::function<void(void *src, void *dst, size_t)> migrate) {
+    size_t size, std::function<void(void *src, void *dst, size_t)> migrate,
+    wait_list_view waitList) {
   return hParent->getDevicePtr(hDevice, access, offset + this->offset, size,
-                               migrate);
+                               migrate, waitList);
 }
 
 void *ur_mem_sub_buffer_t::mapHostPtr(
-    ur_map_flags_t flags, size_t offset, size_t size,
-    std::function<void(void *src, void *dst, size_t)> migrate) {
-  return hParent->mapHostPtr(flags, offset + this->offset, size, migrate);
+    ur_device_handle_t hDevice, ur_map_flags_t flags, size_t offset,
+    size_t size, std::function<void(void *src, void *dst, size_t)> migrate,
+    std::function<void *(size_t size)> allocHost, wait_list_view waitList) {
+  return hParent->mapHostPtr(hDevice, flags, offset + this->offset, size,
+                             migrate, allocHost, waitList);
 }
 
 void ur_mem_sub_buffer_t::unmapHostPtr(
-    void *pMappedPtr,
-    std::function<void(void *src, void *dst, size_t)> migrate) {
-  return hParent->unmapHostPtr(pMappedPtr, migrate);
+    ur_device_handle_t hDevice, void *pMappedPtr,
+    std::function<void(void *src, void *dst, size_t)> migrate,
+    std::function<void(void *ptr)> freeHost, wait_list_view waitList) {
+  return hParent->unmapHostPtr(hDevice, pMappedPtr, migrate, freeHost,
+                               waitList);
+}
+
+void *ur_mem_sub_buffer_t::getDeviceAllocationPtr(ur_device_handle_t hDevice,
+                                                  size_t offset) {
+  return hParent->getDeviceAllocationPtr(hDevice, offset + this->offset);
+}
+
+bool ur_mem_sub_buffer_t::isUpToDate(ur_device_handle_t hDevice,
+                                     device_access_mode_t access,
+                                     size_t offset, size_t size) const {
+  return hParent->isUpToDate(hDevice, access, offset + this->offset, size);
 }
 
 size_t ur_mem_sub_buffer_t::getSize() const { return size; }
@@ -565,7 +836,7 @@ ur_result_t urMemGetNativeHandle(ur_mem_handle_t hMem,
 
   auto ptr = hMem->getDevicePtr(
       nullptr, ur_mem_handle_t_::device_access_mode_t::read_write, 0,
-      hMem->getSize(), nullptr);
+      hMem->getSize(), nullptr, {});
   *phNativeMem = reinterpret_cast<ur_native_handle_t>(ptr);
   return UR_RESULT_SUCCESS;
 } catch (...) {
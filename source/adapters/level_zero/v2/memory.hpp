@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include <ur_api.h>
 
 #include "../device.hpp"
@@ -17,6 +19,11 @@
 
 using usm_unique_ptr_t = std::unique_ptr<void, std::function<void(void *)>>;
 
+// Events the command accessing memory waits for. Pages of discrete buffers
+// staged through the host are copied from the source device once they are
+// signaled.
+using wait_list_view = std::pair<ze_event_handle_t *, uint32_t>;
+
 struct ur_mem_handle_t_ : private _ur_object {
   enum class device_access_mode_t { read_write, read_only, write_only };
 
@@ -31,13 +38,31 @@ struct ur_mem_handle_t_ : private _ur_object {
   virtual void *
   getDevicePtr(ur_device_handle_t, device_access_mode_t, size_t offset,
                size_t size,
-               std::function<void(void *src, void *dst, size_t)> mecmpy) = 0;
+               std::function<void(void *src, void *dst, size_t)> mecmpy,
+               wait_list_view waitList) = 0;
+  // The host memory of a mapping is allocated and freed with the callbacks,
+  // which let the queue order its release after the commands using it. The
+  // copies of the mapping are done from and to the memory of the device.
   virtual void *
-  mapHostPtr(ur_map_flags_t, size_t offset, size_t size,
-             std::function<void(void *src, void *dst, size_t)> memcpy) = 0;
+  mapHostPtr(ur_device_handle_t, ur_map_flags_t, size_t offset, size_t size,
+             std::function<void(void *src, void *dst, size_t)> memcpy,
+             std::function<void *(size_t size)> allocHost,
+             wait_list_view waitList) = 0;
   virtual void
-  unmapHostPtr(void *pMappedPtr,
-               std::function<void(void *src, void *dst, size_t)> memcpy) = 0;
+  unmapHostPtr(ur_device_handle_t, void *pMappedPtr,
+               std::function<void(void *src, void *dst, size_t)> memcpy,
+               std::function<void(void *ptr)> freeHost,
+               wait_list_view waitList) = 0;
+
+  // Returns pointer to the device memory like getDevicePtr, without migrating
+  // any of it to the device. Commands recorded into command-buffers use it,
+  // their memory is migrated when the command-buffer is enqueued.
+  virtual void *getDeviceAllocationPtr(ur_device_handle_t, size_t offset) = 0;
+
+  // Whether getDevicePtr would return the memory without migrating any of it
+  // or changing where it is up to date.
+  virtual bool isUpToDate(ur_device_handle_t, device_access_mode_t,
+                          size_t offset, size_t size) const;
 
   inline device_access_mode_t getDeviceAccessMode() const { return accessMode; }
   inline ur_context_handle_t getContext() const { return hContext; }
@@ -60,11 +85,18 @@ struct ur_usm_handle_t_ : ur_mem_handle_t_ {
   void *
   getDevicePtr(ur_device_handle_t, device_access_mode_t, size_t offset,
                size_t size,
-               std::function<void(void *src, void *dst, size_t)>) override;
-  void *mapHostPtr(ur_map_flags_t, size_t offset, size_t size,
-                   std::function<void(void *src, void *dst, size_t)>) override;
-  void unmapHostPtr(void *pMappedPtr,
-                    std::function<void(void *src, void *dst, size_t)>) override;
+               std::function<void(void *src, void *dst, size_t)>,
+               wait_list_view) override;
+  void *mapHostPtr(ur_device_handle_t, ur_map_flags_t, size_t offset,
+                   size_t size,
+                   std::function<void(void *src, void *dst, size_t)>,
+                   std::function<void *(size_t size)>,
+                   wait_list_view) override;
+  void unmapHostPtr(ur_device_handle_t, void *pMappedPtr,
+                    std::function<void(void *src, void *dst, size_t)>,
+                    std::function<void(void *ptr)>,
+                    wait_list_view) override;
+  void *getDeviceAllocationPtr(ur_device_handle_t, size_t offset) override;
 
 private:
   void *ptr;
@@ -87,11 +119,18 @@ struct ur_integrated_mem_handle_t : public ur_mem_handle_t_ {
   void *
   getDevicePtr(ur_device_handle_t, device_access_mode_t, size_t offset,
                size_t size,
-               std::function<void(void *src, void *dst, size_t)>) override;
-  void *mapHostPtr(ur_map_flags_t, size_t offset, size_t size,
-                   std::function<void(void *src, void *dst, size_t)>) override;
-  void unmapHostPtr(void *pMappedPtr,
-                    std::function<void(void *src, void *dst, size_t)>) override;
+               std::function<void(void *src, void *dst, size_t)>,
+               wait_list_view) override;
+  void *mapHostPtr(ur_device_handle_t, ur_map_flags_t, size_t offset,
+                   size_t size,
+                   std::function<void(void *src, void *dst, size_t)>,
+                   std::function<void *(size_t size)>,
+                   wait_list_view) override;
+  void unmapHostPtr(ur_device_handle_t, void *pMappedPtr,
+                    std::function<void(void *src, void *dst, size_t)>,
+                    std::function<void(void *ptr)>,
+                    wait_list_view) override;
+  void *getDeviceAllocationPtr(ur_device_handle_t, size_t offset) override;
 
 private:
   usm_unique_ptr_t ptr;
@@ -109,7 +148,10 @@ struct host_allocation_desc_t {
 };
 
 // Manages memory buffer for discrete GPU.
-// Memory is allocated on the device and migrated/copies if necessary.
+// Memory is allocated on every device accessing the buffer and the pages
+// which are out of date there are migrated when the device accesses them.
+// Pages are copied directly from the devices with P2P access and through a
+// host copy of the buffer from the other devices.
 struct ur_discrete_mem_handle_t : public ur_mem_handle_t_ {
   // If hostPtr is not null, the buffer is allocated immediately on the
   // first device in the context. Otherwise, the buffer is allocated on
@@ -127,21 +169,45 @@ struct ur_discrete_mem_handle_t : public ur_mem_handle_t_ {
   void *
   getDevicePtr(ur_device_handle_t, device_access_mode_t, size_t offset,
                size_t size,
-               std::function<void(void *src, void *dst, size_t)>) override;
-  void *mapHostPtr(ur_map_flags_t, size_t offset, size_t size,
-                   std::function<void(void *src, void *dst, size_t)>) override;
-  void unmapHostPtr(void *pMappedPtr,
-                    std::function<void(void *src, void *dst, size_t)>) override;
+               std::function<void(void *src, void *dst, size_t)>,
+               wait_list_view) override;
+  void *mapHostPtr(ur_device_handle_t, ur_map_flags_t, size_t offset,
+                   size_t size,
+                   std::function<void(void *src, void *dst, size_t)>,
+                   std::function<void *(size_t size)>,
+                   wait_list_view) override;
+  void unmapHostPtr(ur_device_handle_t, void *pMappedPtr,
+                    std::function<void(void *src, void *dst, size_t)>,
+                    std::function<void(void *ptr)>,
+                    wait_list_view) override;
+  void *getDeviceAllocationPtr(ur_device_handle_t, size_t offset) override;
+  bool isUpToDate(ur_device_handle_t, device_access_mode_t, size_t offset,
+                  size_t size) const override;
 
 private:
-  void *getCurrentAllocation();
+  // Location of the latest content of a page: a device, nullptr for the host
+  // copy or std::nullopt if the page has not been written yet.
+  using page_source_t = std::optional<ur_device_handle_t>;
 
   // Vector of per-device allocations indexed by device->Id
   std::vector<usm_unique_ptr_t> deviceAllocations;
 
-  // Specifies device on which the latest allocation resides.
-  // If null, there is no allocation.
-  ur_device_handle_t activeAllocationDevice = nullptr;
+  // Devices with an allocation of the buffer, in the order of allocation.
+  std::vector<ur_device_handle_t> allocationDevices;
+
+  // Pages holding the latest content in the allocation of each device,
+  // indexed by device->Id, empty if the device has no allocation.
+  std::vector<std::vector<bool>> validPages;
+
+  // Host copy of the buffer, through which pages are migrated between
+  // devices without P2P access, allocated on the first such migration.
+  usm_unique_ptr_t hostCopy;
+  std::vector<bool> hostValidPages;
+
+  // Bytes copied to the allocations by migrations, directly between devices
+  // and from the host copy.
+  uint64_t p2pMigratedBytes = 0;
+  uint64_t hostMigratedBytes = 0;
 
   // If not null, copy the buffer content back to this memory on release.
   void *writeBackPtr = nullptr;
@@ -149,9 +215,30 @@ private:
   std::vector<host_allocation_desc_t> hostAllocations;
 
   void *allocateOnDevice(ur_device_handle_t hDevice, size_t size);
+  void *allocateHostCopy();
 
   ur_result_t migrateBufferTo(ur_device_handle_t hDevice, void *src,
                               size_t size);
+
+  // Returns where to copy the page from to hDevice, preferring devices with
+  // P2P access to it, or from where to write it back if hDevice is null.
+  page_source_t getPageSource(size_t page, ur_device_handle_t hDevice) const;
+
+  // Makes [offset, offset + size) up to date in the allocation of hDevice.
+  // If the range is about to be overwritten, only the pages it partially
+  // covers are migrated.
+  void migrateRangeTo(
+      ur_device_handle_t hDevice, size_t offset, size_t size, bool overwrite,
+      const std::function<void(void *src, void *dst, size_t)> &migrate,
+      wait_list_view waitList);
+  void migratePagesTo(
+      ur_device_handle_t hDevice, size_t firstPage, size_t lastPage,
+      const std::function<void(void *src, void *dst, size_t)> &migrate,
+      wait_list_view waitList);
+
+  // Marks [offset, offset + size) as only up to date on hDevice.
+  void invalidateRangeExcept(ur_device_handle_t hDevice, size_t offset,
+                             size_t size);
 };
 
 struct ur_mem_sub_buffer_t : public ur_mem_handle_t_ {
@@ -162,11 +249,20 @@ struct ur_mem_sub_buffer_t : public ur_mem_handle_t_ {
   void *
   getDevicePtr(ur_device_handle_t, device_access_mode_t, size_t offset,
                size_t size,
-               std::function<void(void *src, void *dst, size_t)>) override;
-  void *mapHostPtr(ur_map_flags_t, size_t offset, size_t size,
-                   std::function<void(void *src, void *dst, size_t)>) override;
-  void unmapHostPtr(void *pMappedPtr,
-                    std::function<void(void *src, void *dst, size_t)>) override;
+               std::function<void(void *src, void *dst, size_t)>,
+               wait_list_view) override;
+  void *mapHostPtr(ur_device_handle_t, ur_map_flags_t, size_t offset,
+                   size_t size,
+                   std::function<void(void *src, void *dst, size_t)>,
+                   std::function<void *(size_t size)>,
+                   wait_list_view) override;
+  void unmapHostPtr(ur_device_handle_t, void *pMappedPtr,
+                    std::function<void(void *src, void *dst, size_t)>,
+                    std::function<void(void *ptr)>,
+                    wait_list_view) override;
+  void *getDeviceAllocationPtr(ur_device_handle_t, size_t offset) override;
+  bool isUpToDate(ur_device_handle_t, device_access_mode_t, size_t offset,
+                  size_t size) const override;
 
   size_t getSize() const override;
   ur_shared_mutex &getMutex() override;
@@ -13,12 +13,17 @@
 #pragma once
 
 #include <ur_api.h>
+#include <ze_api.h>
 
 struct ur_queue_handle_t_ {
   virtual ~ur_queue_handle_t_();
 
   virtual void deferEventFree(ur_event_handle_t hEvent) = 0;
 
+  virtual ur_result_t enqueueCommandBuffer(ur_exp_command_buffer_handle_t,
+                                           ur_event_handle_t *, uint32_t,
+                                           const ur_event_handle_t *) = 0;
+
   virtual ur_result_t queueGetInfo(ur_queue_info_t, size_t, void *,
                                    size_t *) = 0;
   virtual ur_result_t queueRetain() = 0;
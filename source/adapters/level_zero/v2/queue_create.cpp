@@ -13,6 +13,7 @@
 #include "logger/ur_logger.hpp"
 #include "queue_api.hpp"
 #include "queue_immediate_in_order.hpp"
+#include "queue_immediate_out_of_order.hpp"
 
 #include <tuple>
 #include <utility>
@@ -27,8 +28,14 @@ ur_result_t urQueueCreate(ur_context_handle_t hContext,
   }
 
   // TODO: For now, always use immediate, in-order
-  *phQueue =
-      new v2::ur_queue_immediate_in_order_t(hContext, hDevice, pProperties);
+  if (pProperties &&
+      (pProperties->flags & UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE)) {
+    *phQueue = new v2::ur_queue_immediate_out_of_order_t(hContext, hDevice,
+                                                         pProperties);
+  } else {
+    *phQueue =
+        new v2::ur_queue_immediate_in_order_t(hContext, hDevice, pProperties);
+  }
   return UR_RESULT_SUCCESS;
 } catch (...) {
   return exceptionToResult(std::current_exception());
@@ -9,6 +9,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "queue_immediate_in_order.hpp"
+#include "command_buffer.hpp"
 #include "kernel.hpp"
 #include "memory.hpp"
 #include "ur.hpp"
@@ -19,25 +20,53 @@
 #include "../program.hpp"
 #include "../ur_interface_loader.hpp"
 
+#include <algorithm>
+
 namespace v2 {
 
 std::pair<ze_event_handle_t *, uint32_t>
 ur_queue_immediate_in_order_t::getWaitListView(
     const ur_event_handle_t *phWaitEvents, uint32_t numWaitEvents) {
 
-  waitList.resize(numWaitEvents);
+  waitList.clear();
   for (uint32_t i = 0; i < numWaitEvents; i++) {
-    waitList[i] = phWaitEvents[i]->getZeEvent();
+    auto hEvent = phWaitEvents[i];
+    // Commands of an in-order list already run after the commands appended
+    // to it before, and waiting for a signaled event is a no-op, so neither
+    // needs to be passed to the driver.
+    if (hEvent->getSignalingCommandList() == handler.commandList.get() ||
+        hEvent->isCompleted()) {
+      continue;
+    }
+    waitList.push_back(hEvent->getZeEvent());
   }
 
-  return {waitList.data(), static_cast<uint32_t>(numWaitEvents)};
+  if (waitList.size() > 1) {
+    std::sort(waitList.begin(), waitList.end());
+    waitList.erase(std::unique(waitList.begin(), waitList.end()),
+                   waitList.end());
+  }
+
+  numEliminatedWaitEvents.fetch_add(numWaitEvents - waitList.size(),
+                                    std::memory_order_relaxed);
+
+  if (waitList.empty()) {
+    return {nullptr, 0};
+  }
+  return {waitList.data(), static_cast<uint32_t>(waitList.size())};
 }
 
-static int32_t getZeOrdinal(ur_device_handle_t hDevice) {
-  return hDevice->QueueGroup[queue_group_type::Compute].ZeOrdinal;
+static int32_t getZeOrdinal(ur_device_handle_t hDevice,
+                            queue_group_type queueGroup) {
+  return hDevice->QueueGroup[queueGroup].ZeOrdinal;
 }
 
-static std::optional<int32_t> getZeIndex(const ur_queue_properties_t *pProps) {
+static std::optional<int32_t> getZeIndex(const ur_queue_properties_t *pProps,
+                                         queue_group_type queueGroup) {
+  // The index selected by the user is an index of the compute engines.
+  if (queueGroup != queue_group_type::Compute) {
+    return std::nullopt;
+  }
   if (pProps && pProps->pNext) {
     const ur_base_properties_t *extendedDesc =
         reinterpret_cast<const ur_base_properties_t *>(pProps->pNext);
@@ -60,13 +89,14 @@ static ze_command_queue_priority_t getZePriority(ur_queue_flags_t flags) {
 
 ur_command_list_handler_t::ur_command_list_handler_t(
     ur_context_handle_t hContext, ur_device_handle_t hDevice,
-    const ur_queue_properties_t *pProps)
+    const ur_queue_properties_t *pProps, queue_group_type queueGroup)
     : commandList(hContext->commandListCache.getImmediateCommandList(
-          hDevice->ZeDevice, true, getZeOrdinal(hDevice),
-          true /* always enable copy offload */,
+          hDevice->ZeDevice, true, getZeOrdinal(hDevice, queueGroup),
+          // always enable copy offload, only compute engines support it
+          queueGroup == queue_group_type::Compute,
           ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS,
           getZePriority(pProps ? pProps->flags : ur_queue_flags_t{}),
-          getZeIndex(pProps))) {}
+          getZeIndex(pProps, queueGroup))) {}
 
 ur_command_list_handler_t::ur_command_list_handler_t(
     ze_command_list_handle_t hZeCommandList, bool ownZeHandle)
@@ -87,25 +117,45 @@ static event_flags_t eventFlagsFromQueueFlags(ur_queue_flags_t flags) {
 ur_queue_immediate_in_order_t::ur_queue_immediate_in_order_t(
     ur_context_handle_t hContext, ur_device_handle_t hDevice,
     const ur_queue_properties_t *pProps)
+    : ur_queue_immediate_in_order_t(hContext, hDevice, pProps,
+                                    queue_group_type::Compute, this) {}
+
+ur_queue_immediate_in_order_t::ur_queue_immediate_in_order_t(
+    ur_context_handle_t hContext, ur_device_handle_t hDevice,
+    const ur_queue_properties_t *pProps, queue_group_type queueGroup,
+    ur_queue_handle_t hOwnerQueue)
     : hContext(hContext), hDevice(hDevice), flags(pProps ? pProps->flags : 0),
+      hOwnerQueue(hOwnerQueue),
       eventPool(hContext->eventPoolCache.borrow(
           hDevice->Id.value(), eventFlagsFromQueueFlags(flags))),
-      handler(hContext, hDevice, pProps) {}
+      handler(hContext, hDevice, pProps, queueGroup) {}
 
 ur_queue_immediate_in_order_t::ur_queue_immediate_in_order_t(
     ur_context_handle_t hContext, ur_device_handle_t hDevice,
     ur_native_handle_t hNativeHandle, ur_queue_flags_t flags, bool ownZeQueue)
-    : hContext(hContext), hDevice(hDevice), flags(flags),
+    : hContext(hContext), hDevice(hDevice), flags(flags), hOwnerQueue(this),
       eventPool(hContext->eventPoolCache.borrow(
           hDevice->Id.value(), eventFlagsFromQueueFlags(flags))),
       handler(reinterpret_cast<ze_command_list_handle_t>(hNativeHandle),
               ownZeQueue) {}
 
+ur_queue_immediate_in_order_t::~ur_queue_immediate_in_order_t() {
+  logger::debug("ur_queue_immediate_in_order_t: {} wait events eliminated",
+                getNumEliminatedWaitEvents());
+
+  if (!asyncFrees.empty()) {
+    ZE_CALL_NOCHECK(zeCommandListHostSynchronize,
+                    (handler.commandList.get(), UINT64_MAX));
+    reclaimAsyncFreesUnlocked(true);
+  }
+}
+
 ur_event_handle_t
 ur_queue_immediate_in_order_t::getSignalEvent(ur_event_handle_t *hUserEvent,
                                               ur_command_t commandType) {
   if (hUserEvent) {
-    *hUserEvent = eventPool->allocate(this, commandType);
+    *hUserEvent = eventPool->allocate(hOwnerQueue, commandType);
+    (*hUserEvent)->setSignalingCommandList(handler.commandList.get());
     return *hUserEvent;
   } else {
     return nullptr;
@@ -164,6 +214,54 @@ void ur_queue_immediate_in_order_t::deferEventFree(ur_event_handle_t hEvent) {
   deferredEvents.push_back(hEvent);
 }
 
+void *ur_queue_immediate_in_order_t::allocateHostAsyncUnlocked(size_t size) {
+  reclaimAsyncFreesUnlocked(false);
+
+  void *ptr;
+  UR_CALL_THROWS(hContext->getDefaultUSMPool()->allocate(
+      hContext, nullptr, nullptr, UR_USM_TYPE_HOST, size, &ptr));
+  return ptr;
+}
+
+void ur_queue_immediate_in_order_t::freeHostAsyncUnlocked(
+    void *ptr, ur_event_handle_t hReleaseEvent) {
+  if (!hReleaseEvent) {
+    hReleaseEvent = eventPool->allocate(hOwnerQueue, UR_COMMAND_MEM_UNMAP);
+    hReleaseEvent->setSignalingCommandList(handler.commandList.get());
+    ZE2UR_CALL_THROWS(zeCommandListAppendSignalEvent,
+                      (handler.commandList.get(), hReleaseEvent->getZeEvent()));
+  }
+  asyncFrees.push_back({ptr, hReleaseEvent});
+
+  reclaimAsyncFreesUnlocked(false);
+}
+
+void ur_queue_immediate_in_order_t::reclaimAsyncFreesUnlocked(bool queueIdle) {
+  auto reclaimed = [&](async_free_t &asyncFree) {
+    if (!queueIdle) {
+      auto zeResult = ZE_CALL_NOCHECK(
+          zeEventQueryStatus, (asyncFree.hReleaseEvent->getZeEvent()));
+      if (zeResult != ZE_RESULT_SUCCESS) {
+        return false;
+      }
+    }
+
+    auto ret = hContext->getDefaultUSMPool()->free(asyncFree.ptr);
+    if (ret != UR_RESULT_SUCCESS) {
+      logger::error("Failed to free host memory: {}", ret);
+    }
+    asyncFree.hReleaseEvent->release();
+    return true;
+  };
+  asyncFrees.erase(
+      std::remove_if(asyncFrees.begin(), asyncFrees.end(), reclaimed),
+      asyncFrees.end());
+}
+
+uint64_t ur_queue_immediate_in_order_t::getNumEliminatedWaitEvents() const {
+  return numEliminatedWaitEvents.load(std::memory_order_relaxed);
+}
+
 ur_result_t ur_queue_immediate_in_order_t::queueGetNativeHandle(
     ur_queue_native_desc_t *pDesc, ur_native_handle_t *phNativeQueue) {
   std::ignore = pDesc;
@@ -189,6 +287,8 @@ ur_result_t ur_queue_immediate_in_order_t::queueFinish() {
   }
   deferredEvents.clear();
 
+  reclaimAsyncFreesUnlocked(true);
+
   return UR_RESULT_SUCCESS;
 }
 
@@ -211,8 +311,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueKernelLaunch(
 
   ze_kernel_handle_t hZeKernel = hKernel->getZeHandle(hDevice);
 
-  std::scoped_lock<ur_shared_mutex, ur_shared_mutex> Lock(this->Mutex,
-                                                          hKernel->Mutex);
+  std::scoped_lock<ur_shared_mutex, ur_mutex> Lock(
+      this->Mutex, hKernel->getLaunchMutex(hDevice));
 
   ze_group_count_t zeThreadGroupDimensions{1, 1, 1};
   uint32_t WG[3]{};
@@ -234,7 +334,7 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueKernelLaunch(
 
   UR_CALL(hKernel->prepareForSubmission(hContext, hDevice, pGlobalWorkOffset,
                                         workDim, WG[0], WG[1], WG[2],
-                                        memoryMigrate));
+                                        memoryMigrate, waitList));
 
   if (memoryMigrated) {
     // If memory was migrated, we don't need to pass the wait list to
@@ -253,6 +353,44 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueKernelLaunch(
   return UR_RESULT_SUCCESS;
 }
 
+ur_result_t ur_queue_immediate_in_order_t::enqueueCommandBuffer(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_event_handle_t *phEvent,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList) {
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::enqueueCommandBuffer");
+
+  std::scoped_lock<ur_shared_mutex> lock(this->Mutex);
+
+  auto signalEvent =
+      getSignalEvent(phEvent, UR_COMMAND_COMMAND_BUFFER_ENQUEUE_EXP);
+
+  auto waitList = getWaitListView(phEventWaitList, numEventsInWaitList);
+
+  bool memoryMigrated = false;
+  hCommandBuffer->prepareForSubmission(
+      [&](void *src, void *dst, size_t size) {
+        ZE2UR_CALL_THROWS(zeCommandListAppendMemoryCopy,
+                          (handler.commandList.get(), dst, src, size, nullptr,
+                           waitList.second, waitList.first));
+        memoryMigrated = true;
+      },
+      waitList);
+
+  if (memoryMigrated) {
+    // If memory was migrated, we don't need to pass the wait list to
+    // the command-buffer again.
+    waitList.first = nullptr;
+    waitList.second = 0;
+  }
+
+  auto hZeCommandList = hCommandBuffer->getZeCommandList();
+  auto zeSignalEvent = signalEvent ? signalEvent->getZeEvent() : nullptr;
+  ZE2UR_CALL(zeCommandListImmediateAppendCommandListsExp,
+             (handler.commandList.get(), 1, &hZeCommandList, zeSignalEvent,
+              waitList.second, waitList.first));
+
+  return UR_RESULT_SUCCESS;
+}
+
 ur_result_t ur_queue_immediate_in_order_t::enqueueEventsWait(
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
@@ -316,7 +454,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueGenericCopyUnlocked(
                           (handler.commandList.get(), dst, src, size, nullptr,
                            waitList.second, waitList.first));
         memoryMigrated = true;
-      }));
+      },
+      waitList));
 
   auto pDst = ur_cast<char *>(dst->getDevicePtr(
       hDevice, ur_mem_handle_t_::device_access_mode_t::write_only, dstOffset,
@@ -325,7 +464,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueGenericCopyUnlocked(
                           (handler.commandList.get(), dst, src, size, nullptr,
                            waitList.second, waitList.first));
         memoryMigrated = true;
-      }));
+      },
+      waitList));
 
   if (memoryMigrated) {
     // If memory was migrated, we don't need to pass the wait list to
@@ -405,7 +545,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueRegionCopyUnlocked(
                           (handler.commandList.get(), dst, src, size, nullptr,
                            waitList.second, waitList.first));
         memoryMigrated = true;
-      }));
+      },
+      waitList));
   auto pDst = ur_cast<char *>(dst->getDevicePtr(
       hDevice, ur_mem_handle_t_::device_access_mode_t::write_only, 0,
       dst->getSize(), [&](void *src, void *dst, size_t size) {
@@ -413,7 +554,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueRegionCopyUnlocked(
                           (handler.commandList.get(), dst, src, size, nullptr,
                            waitList.second, waitList.first));
         memoryMigrated = true;
-      }));
+      },
+      waitList));
 
   if (memoryMigrated) {
     // If memory was migrated, we don't need to pass the wait list to
@@ -601,12 +743,15 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueMemBufferMap(
 
   bool memoryMigrated = false;
   auto pDst = ur_cast<char *>(hBuffer->mapHostPtr(
-      mapFlags, offset, size, [&](void *src, void *dst, size_t size) {
+      hDevice, mapFlags, offset, size,
+      [&](void *src, void *dst, size_t size) {
         ZE2UR_CALL_THROWS(zeCommandListAppendMemoryCopy,
                           (handler.commandList.get(), dst, src, size, nullptr,
                            waitList.second, waitList.first));
         memoryMigrated = true;
-      }));
+      },
+      [&](size_t size) { return allocateHostAsyncUnlocked(size); },
+      waitList));
   *ppRetMap = pDst;
 
   if (!memoryMigrated && waitList.second) {
@@ -632,31 +777,40 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueMemUnmap(
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
   TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::enqueueMemUnmap");
 
-  std::scoped_lock<ur_shared_mutex> lock(this->Mutex);
+  std::scoped_lock<ur_shared_mutex, ur_shared_mutex> lock(this->Mutex,
+                                                          hMem->getMutex());
 
   auto signalEvent = getSignalEvent(phEvent, UR_COMMAND_MEM_UNMAP);
 
   auto waitList = getWaitListView(phEventWaitList, numEventsInWaitList);
 
-  // TODO: currently unmapHostPtr deallocates memory immediately,
-  // since the memory might be used by the user, we need to make sure
-  // all dependencies are completed.
   ZE2UR_CALL(zeCommandListAppendWaitOnEvents,
              (handler.commandList.get(), waitList.second, waitList.first));
 
-  bool memoryMigrated = false;
-  hMem->unmapHostPtr(pMappedPtr, [&](void *src, void *dst, size_t size) {
-    ZE2UR_CALL_THROWS(zeCommandListAppendMemoryCopy,
-                      (handler.commandList.get(), dst, src, size, nullptr,
-                       waitList.second, waitList.first));
-    memoryMigrated = true;
-  });
+  void *pFreedPtr = nullptr;
+  hMem->unmapHostPtr(
+      hDevice, pMappedPtr,
+      [&](void *src, void *dst, size_t size) {
+        ZE2UR_CALL_THROWS(zeCommandListAppendMemoryCopy,
+                          (handler.commandList.get(), dst, src, size, nullptr,
+                           waitList.second, waitList.first));
+      },
+      [&](void *ptr) { pFreedPtr = ptr; }, waitList);
 
   if (signalEvent) {
     ZE2UR_CALL(zeCommandListAppendSignalEvent,
                (handler.commandList.get(), signalEvent->getZeEvent()));
   }
 
+  // The mapped memory is only returned to the pool once the copy back to the
+  // device has completed, which the signal event of the unmap tells.
+  if (pFreedPtr) {
+    if (signalEvent) {
+      signalEvent->retain();
+    }
+    freeHostAsyncUnlocked(pFreedPtr, signalEvent);
+  }
+
   return UR_RESULT_SUCCESS;
 }
 
@@ -672,13 +826,14 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueGenericFillUnlocked(
 
   bool memoryMigrated = false;
   auto pDst = ur_cast<char *>(dst->getDevicePtr(
-      hDevice, ur_mem_handle_t_::device_access_mode_t::read_only, offset, size,
+      hDevice, ur_mem_handle_t_::device_access_mode_t::write_only, offset, size,
       [&](void *src, void *dst, size_t size) {
         ZE2UR_CALL_THROWS(zeCommandListAppendMemoryCopy,
                           (handler.commandList.get(), dst, src, size, nullptr,
                            waitList.second, waitList.first));
         memoryMigrated = true;
-      }));
+      },
+      waitList));
 
   if (memoryMigrated) {
     // If memory was migrated, we don't need to pass the wait list to
@@ -862,9 +1017,11 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueDeviceGlobalVariableWrite(
   TRACK_SCOPE_LATENCY(
       "ur_queue_immediate_in_order_t::enqueueDeviceGlobalVariableWrite");
 
-  // TODO: make getZeModuleHandle thread-safe
-  ze_module_handle_t zeModule =
-      hProgram->getZeModuleHandle(this->hDevice->ZeDevice);
+  ze_module_handle_t zeModule = nullptr;
+  {
+    std::shared_lock<ur_shared_mutex> lock(hProgram->Mutex);
+    zeModule = hProgram->getZeModuleHandle(this->hDevice->ZeDevice);
+  }
 
   // Find global variable pointer
   auto globalVarPtr = getGlobalPointerFromModule(zeModule, offset, count, name);
@@ -882,9 +1039,11 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueDeviceGlobalVariableRead(
   TRACK_SCOPE_LATENCY(
       "ur_queue_immediate_in_order_t::enqueueDeviceGlobalVariableRead");
 
-  // TODO: make getZeModuleHandle thread-safe
-  ze_module_handle_t zeModule =
-      hProgram->getZeModuleHandle(this->hDevice->ZeDevice);
+  ze_module_handle_t zeModule = nullptr;
+  {
+    std::shared_lock<ur_shared_mutex> lock(hProgram->Mutex);
+    zeModule = hProgram->getZeModuleHandle(this->hDevice->ZeDevice);
+  }
 
   // Find global variable pointer
   auto globalVarPtr = getGlobalPointerFromModule(zeModule, offset, count, name);
@@ -991,8 +1150,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueCooperativeKernelLaunchExp(
 
   ze_kernel_handle_t hZeKernel = hKernel->getZeHandle(hDevice);
 
-  std::scoped_lock<ur_shared_mutex, ur_shared_mutex> Lock(this->Mutex,
-                                                          hKernel->Mutex);
+  std::scoped_lock<ur_shared_mutex, ur_mutex> Lock(
+      this->Mutex, hKernel->getLaunchMutex(hDevice));
 
   ze_group_count_t zeThreadGroupDimensions{1, 1, 1};
   uint32_t WG[3]{};
@@ -1014,7 +1173,7 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueCooperativeKernelLaunchExp(
 
   UR_CALL(hKernel->prepareForSubmission(hContext, hDevice, pGlobalWorkOffset,
                                         workDim, WG[0], WG[1], WG[2],
-                                        memoryMigrate));
+                                        memoryMigrate, waitList));
 
   if (memoryMigrated) {
     // If memory was migrated, we don't need to pass the wait list to
@@ -26,7 +26,8 @@ using queue_group_type = ur_device_handle_t_::queue_group_info_t::type;
 struct ur_command_list_handler_t {
   ur_command_list_handler_t(ur_context_handle_t hContext,
                             ur_device_handle_t hDevice,
-                            const ur_queue_properties_t *pProps);
+                            const ur_queue_properties_t *pProps,
+                            queue_group_type queueGroup);
 
   ur_command_list_handler_t(ze_command_list_handle_t hZeCommandList,
                             bool ownZeHandle);
@@ -40,14 +41,34 @@ private:
   ur_device_handle_t hDevice;
   ur_queue_flags_t flags;
 
+  // Queue that the events of this queue are associated with, which is a
+  // different queue if this one is used to implement it.
+  ur_queue_handle_t hOwnerQueue;
+
   raii::cache_borrowed_event_pool eventPool;
 
   ur_command_list_handler_t handler;
 
   std::vector<ze_event_handle_t> waitList;
 
+  // Number of wait events that were not passed to the driver because they
+  // were redundant.
+  std::atomic<uint64_t> numEliminatedWaitEvents = 0;
+
   std::vector<ur_event_handle_t> deferredEvents;
 
+  // Host memory freed by an enqueued command, which is returned to the pool
+  // once the event signaled after the command completes. Only the staging
+  // memory of map/unmap is freed this way, buffer allocations are freed when
+  // the buffer is released.
+  struct async_free_t {
+    void *ptr;
+    ur_event_handle_t hReleaseEvent;
+  };
+  std::vector<async_free_t> asyncFrees;
+
+  // Returns the wait list to pass to the driver, without duplicates, events
+  // signaled by this queue's command list and events known to be signaled.
   std::pair<ze_event_handle_t *, uint32_t>
   getWaitListView(const ur_event_handle_t *phWaitEvents,
                   uint32_t numWaitEvents);
@@ -57,6 +78,19 @@ private:
 
   void deferEventFree(ur_event_handle_t hEvent) override;
 
+  // Allocates host memory for staging, completed asynchronous frees are
+  // reclaimed first.
+  void *allocateHostAsyncUnlocked(size_t size);
+
+  // Frees host memory once the commands appended so far have completed.
+  // Takes over the reference of the caller to hReleaseEvent, which may be
+  // nullptr to let the queue signal an event of its own.
+  void freeHostAsyncUnlocked(void *ptr, ur_event_handle_t hReleaseEvent);
+
+  // Returns the memory of completed asynchronous frees to the pool, all of
+  // them if the queue is known to be idle.
+  void reclaimAsyncFreesUnlocked(bool queueIdle);
+
   ur_result_t enqueueRegionCopyUnlocked(
       ur_mem_handle_t src, ur_mem_handle_t dst, bool blocking,
       ur_rect_offset_t srcOrigin, ur_rect_offset_t dstOrigin,
@@ -80,11 +114,23 @@ private:
 public:
   ur_queue_immediate_in_order_t(ur_context_handle_t, ur_device_handle_t,
                                 const ur_queue_properties_t *);
+  ur_queue_immediate_in_order_t(ur_context_handle_t, ur_device_handle_t,
+                                const ur_queue_properties_t *,
+                                queue_group_type queueGroup,
+                                ur_queue_handle_t hOwnerQueue);
   ur_queue_immediate_in_order_t(ur_context_handle_t, ur_device_handle_t,
                                 ur_native_handle_t, ur_queue_flags_t,
                                 bool ownZeQueue);
 
-  ~ur_queue_immediate_in_order_t() {}
+  ~ur_queue_immediate_in_order_t();
+
+  // Number of redundant wait events that were dropped from wait lists.
+  uint64_t getNumEliminatedWaitEvents() const;
+
+  ur_result_t
+  enqueueCommandBuffer(ur_exp_command_buffer_handle_t hCommandBuffer,
+                       ur_event_handle_t *phEvent, uint32_t numEventsInWaitList,
+                       const ur_event_handle_t *phEventWaitList) override;
 
   ur_result_t queueGetInfo(ur_queue_info_t propName, size_t propSize,
                            void *pPropValue, size_t *pPropSizeRet) override;
@@ -0,0 +1,532 @@
+//===--------- queue_immediate_out_of_order.cpp - Level Zero Adapter ------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "queue_immediate_out_of_order.hpp"
+
+#include "../common/latency_tracker.hpp"
+
+namespace v2 {
+
+using in_order_t = ur_queue_immediate_in_order_t;
+
+ur_queue_immediate_out_of_order_t::ur_queue_immediate_out_of_order_t(
+    ur_context_handle_t hContext, ur_device_handle_t hDevice,
+    const ur_queue_properties_t *pProps)
+    : hContext(hContext), hDevice(hDevice), flags(pProps ? pProps->flags : 0),
+      numCopyLanes(hDevice->hasMainCopyEngine() ? 1 : 0),
+      lanes(numComputeLanes + numCopyLanes + 1) {
+  for (size_t i = 0; i < lanes.size(); i++) {
+    bool isCopyLane =
+        i >= numComputeLanes && i < numComputeLanes + numCopyLanes;
+    auto queueGroup =
+        isCopyLane ? queue_group_type::MainCopy : queue_group_type::Compute;
+    lanes[i].queue = std::make_unique<in_order_t>(hContext, hDevice, pProps,
+                                                  queueGroup, this);
+  }
+}
+
+ur_queue_immediate_out_of_order_t::lane_t &
+ur_queue_immediate_out_of_order_t::getComputeLane() {
+  return lanes[nextComputeLane.fetch_add(1, std::memory_order_relaxed) %
+               numComputeLanes];
+}
+
+ur_queue_immediate_out_of_order_t::lane_t &
+ur_queue_immediate_out_of_order_t::getCopyLane() {
+  if (numCopyLanes == 0) {
+    return getComputeLane();
+  }
+  return lanes[numComputeLanes];
+}
+
+ur_queue_immediate_out_of_order_t::lane_t &
+ur_queue_immediate_out_of_order_t::getMarkerLane() {
+  return lanes.back();
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::getLaneCompletionEvents(
+    std::vector<ur_event_handle_t> &completionEvents) {
+  for (auto &lane : lanes) {
+    if (!lane.hasWork.load(std::memory_order_relaxed)) {
+      continue;
+    }
+    ur_event_handle_t hEvent = nullptr;
+    UR_CALL(lane.queue->enqueueEventsWait(0, nullptr, &hEvent));
+    completionEvents.push_back(hEvent);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::queueGetInfo(
+    ur_queue_info_t propName, size_t propSize, void *pPropValue,
+    size_t *pPropSizeRet) {
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+  switch ((uint32_t)propName) { // cast to avoid warnings on EXT enum values
+  case UR_QUEUE_INFO_CONTEXT:
+    return ReturnValue(hContext);
+  case UR_QUEUE_INFO_DEVICE:
+    return ReturnValue(hDevice);
+  case UR_QUEUE_INFO_REFERENCE_COUNT:
+    return ReturnValue(uint32_t{RefCount.load()});
+  case UR_QUEUE_INFO_FLAGS:
+    return ReturnValue(flags);
+  case UR_QUEUE_INFO_SIZE:
+  case UR_QUEUE_INFO_DEVICE_DEFAULT:
+    return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+  case UR_QUEUE_INFO_EMPTY: {
+    // We can't tell if the queue is empty as we don't hold to any events
+    return ReturnValue(false);
+  }
+  default:
+    logger::error("Unsupported ParamName in urQueueGetInfo: "
+                  "ParamName=ParamName={}(0x{})",
+                  propName, logger::toHex(propName));
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::queueRetain() {
+  RefCount.increment();
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::queueRelease() {
+  if (!RefCount.decrementAndTest())
+    return UR_RESULT_SUCCESS;
+
+  UR_CALL(queueFinish());
+
+  delete this;
+  return UR_RESULT_SUCCESS;
+}
+
+void ur_queue_immediate_out_of_order_t::deferEventFree(
+    ur_event_handle_t hEvent) {
+  std::unique_lock<ur_shared_mutex> lock(this->Mutex);
+  deferredEvents.push_back(hEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueCommandBuffer(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_event_handle_t *phEvent,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList) {
+  return submit(getComputeLane(), &in_order_t::enqueueCommandBuffer,
+                hCommandBuffer, phEvent, numEventsInWaitList, phEventWaitList);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::queueGetNativeHandle(
+    ur_queue_native_desc_t *pDesc, ur_native_handle_t *phNativeQueue) {
+  // There is no single native handle, return the one of the first lane, which
+  // is enough to submit work that runs concurrently with the queue.
+  return lanes[0].queue->queueGetNativeHandle(pDesc, phNativeQueue);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::queueFinish() {
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_out_of_order_t::queueFinish");
+
+  std::unique_lock<ur_shared_mutex> lock(this->Mutex);
+
+  for (auto &lane : lanes) {
+    UR_CALL(lane.queue->queueFinish());
+    lane.hasWork.store(false, std::memory_order_relaxed);
+  }
+
+  // Free deferred events
+  for (auto &hEvent : deferredEvents) {
+    hEvent->releaseDeferred();
+  }
+  deferredEvents.clear();
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::queueFlush() {
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueKernelLaunch(
+    ur_kernel_handle_t hKernel, uint32_t workDim,
+    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
+    const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getComputeLane(), &in_order_t::enqueueKernelLaunch, hKernel,
+                workDim, pGlobalWorkOffset, pGlobalWorkSize, pLocalWorkSize,
+                numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueEventsWait(
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_out_of_order_t::enqueueEventsWait");
+
+  // The marker lane only waits, so a marker does not hold back the commands
+  // that follow it, unlike a wait appended to a compute lane.
+  if (numEventsInWaitList) {
+    return submit(getMarkerLane(), &in_order_t::enqueueEventsWait,
+                  numEventsInWaitList, phEventWaitList, phEvent);
+  }
+
+  if (!phEvent) {
+    // nop
+    return UR_RESULT_SUCCESS;
+  }
+
+  // Without a wait list the event waits for all the commands of the queue.
+  std::shared_lock<ur_shared_mutex> lock(this->Mutex);
+
+  std::vector<ur_event_handle_t> completionEvents;
+  UR_CALL(getLaneCompletionEvents(completionEvents));
+
+  auto &markerLane = getMarkerLane();
+  markerLane.hasWork.store(true, std::memory_order_relaxed);
+  auto result = markerLane.queue->enqueueEventsWait(
+      static_cast<uint32_t>(completionEvents.size()), completionEvents.data(),
+      phEvent);
+
+  for (auto hEvent : completionEvents) {
+    hEvent->release();
+  }
+  return result;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueEventsWaitWithBarrier(
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_immediate_out_of_order_t::enqueueEventsWaitWithBarrier");
+
+  std::unique_lock<ur_shared_mutex> lock(this->Mutex);
+
+  // Only the lanes that got commands since the last barrier are waited for,
+  // the commands of the other lanes are behind the last barrier already.
+  std::vector<ur_event_handle_t> completionEvents;
+  UR_CALL(getLaneCompletionEvents(completionEvents));
+
+  std::vector<ur_event_handle_t> waitEvents = completionEvents;
+  waitEvents.insert(waitEvents.end(), phEventWaitList,
+                    phEventWaitList + numEventsInWaitList);
+
+  ur_result_t result = UR_RESULT_SUCCESS;
+  if (waitEvents.empty()) {
+    // Nothing to wait for, every lane is already behind the last barrier.
+    if (phEvent) {
+      result = lanes[0].queue->enqueueEventsWait(0, nullptr, phEvent);
+    }
+  } else {
+    for (size_t i = 0; i < lanes.size() && result == UR_RESULT_SUCCESS; i++) {
+      result = lanes[i].queue->enqueueEventsWait(
+          static_cast<uint32_t>(waitEvents.size()), waitEvents.data(),
+          i == 0 ? phEvent : nullptr);
+    }
+  }
+
+  for (auto hEvent : completionEvents) {
+    hEvent->release();
+  }
+  for (auto &lane : lanes) {
+    lane.hasWork.store(false, std::memory_order_relaxed);
+  }
+  return result;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueEventsWaitWithBarrierExt(
+    const ur_exp_enqueue_ext_properties_t *, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return enqueueEventsWaitWithBarrier(numEventsInWaitList, phEventWaitList,
+                                      phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferRead(
+    ur_mem_handle_t hBuffer, bool blockingRead, size_t offset, size_t size,
+    void *pDst, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getCopyLane(), &in_order_t::enqueueMemBufferRead, hBuffer,
+                blockingRead, offset, size, pDst, numEventsInWaitList,
+                phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferWrite(
+    ur_mem_handle_t hBuffer, bool blockingWrite, size_t offset, size_t size,
+    const void *pSrc, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getCopyLane(), &in_order_t::enqueueMemBufferWrite, hBuffer,
+                blockingWrite, offset, size, pSrc, numEventsInWaitList,
+                phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferReadRect(
+    ur_mem_handle_t hBuffer, bool blockingRead, ur_rect_offset_t bufferOrigin,
+    ur_rect_offset_t hostOrigin, ur_rect_region_t region, size_t bufferRowPitch,
+    size_t bufferSlicePitch, size_t hostRowPitch, size_t hostSlicePitch,
+    void *pDst, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getCopyLane(), &in_order_t::enqueueMemBufferReadRect, hBuffer,
+                blockingRead, bufferOrigin, hostOrigin, region, bufferRowPitch,
+                bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
+                numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferWriteRect(
+    ur_mem_handle_t hBuffer, bool blockingWrite, ur_rect_offset_t bufferOrigin,
+    ur_rect_offset_t hostOrigin, ur_rect_region_t region, size_t bufferRowPitch,
+    size_t bufferSlicePitch, size_t hostRowPitch, size_t hostSlicePitch,
+    void *pSrc, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getCopyLane(), &in_order_t::enqueueMemBufferWriteRect, hBuffer,
+                blockingWrite, bufferOrigin, hostOrigin, region,
+                bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch,
+                pSrc, numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferCopy(
+    ur_mem_handle_t hBufferSrc, ur_mem_handle_t hBufferDst, size_t srcOffset,
+    size_t dstOffset, size_t size, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getCopyLane(), &in_order_t::enqueueMemBufferCopy, hBufferSrc,
+                hBufferDst, srcOffset, dstOffset, size, numEventsInWaitList,
+                phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferCopyRect(
+    ur_mem_handle_t hBufferSrc, ur_mem_handle_t hBufferDst,
+    ur_rect_offset_t srcOrigin, ur_rect_offset_t dstOrigin,
+    ur_rect_region_t region, size_t srcRowPitch, size_t srcSlicePitch,
+    size_t dstRowPitch, size_t dstSlicePitch, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getCopyLane(), &in_order_t::enqueueMemBufferCopyRect,
+                hBufferSrc, hBufferDst, srcOrigin, dstOrigin, region,
+                srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+                numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferFill(
+    ur_mem_handle_t hBuffer, const void *pPattern, size_t patternSize,
+    size_t offset, size_t size, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  // Fills stay on the compute engines, copy engines only support small
+  // patterns.
+  return submit(getComputeLane(), &in_order_t::enqueueMemBufferFill, hBuffer,
+                pPattern, patternSize, offset, size, numEventsInWaitList,
+                phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemImageRead(
+    ur_mem_handle_t hImage, bool blockingRead, ur_rect_offset_t origin,
+    ur_rect_region_t region, size_t rowPitch, size_t slicePitch, void *pDst,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  return submit(getComputeLane(), &in_order_t::enqueueMemImageRead, hImage,
+                blockingRead, origin, region, rowPitch, slicePitch, pDst,
+                numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemImageWrite(
+    ur_mem_handle_t hImage, bool blockingWrite, ur_rect_offset_t origin,
+    ur_rect_region_t region, size_t rowPitch, size_t slicePitch, void *pSrc,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  return submit(getComputeLane(), &in_order_t::enqueueMemImageWrite, hImage,
+                blockingWrite, origin, region, rowPitch, slicePitch, pSrc,
+                numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemImageCopy(
+    ur_mem_handle_t hImageSrc, ur_mem_handle_t hImageDst,
+    ur_rect_offset_t srcOrigin, ur_rect_offset_t dstOrigin,
+    ur_rect_region_t region, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getComputeLane(), &in_order_t::enqueueMemImageCopy, hImageSrc,
+                hImageDst, srcOrigin, dstOrigin, region, numEventsInWaitList,
+                phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferMap(
+    ur_mem_handle_t hBuffer, bool blockingMap, ur_map_flags_t mapFlags,
+    size_t offset, size_t size, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent,
+    void **ppRetMap) {
+  return submit(getComputeLane(), &in_order_t::enqueueMemBufferMap, hBuffer,
+                blockingMap, mapFlags, offset, size, numEventsInWaitList,
+                phEventWaitList, phEvent, ppRetMap);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemUnmap(
+    ur_mem_handle_t hMem, void *pMappedPtr, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getComputeLane(), &in_order_t::enqueueMemUnmap, hMem,
+                pMappedPtr, numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMFill(
+    void *pMem, size_t patternSize, const void *pPattern, size_t size,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  return submit(getComputeLane(), &in_order_t::enqueueUSMFill, pMem,
+                patternSize, pPattern, size, numEventsInWaitList,
+                phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMMemcpy(
+    bool blocking, void *pDst, const void *pSrc, size_t size,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  return submit(getCopyLane(), &in_order_t::enqueueUSMMemcpy, blocking, pDst,
+                pSrc, size, numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMFill2D(
+    void *pMem, size_t pitch, size_t patternSize, const void *pPattern,
+    size_t width, size_t height, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getComputeLane(), &in_order_t::enqueueUSMFill2D, pMem, pitch,
+                patternSize, pPattern, width, height, numEventsInWaitList,
+                phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMMemcpy2D(
+    bool blocking, void *pDst, size_t dstPitch, const void *pSrc,
+    size_t srcPitch, size_t width, size_t height, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getCopyLane(), &in_order_t::enqueueUSMMemcpy2D, blocking, pDst,
+                dstPitch, pSrc, srcPitch, width, height, numEventsInWaitList,
+                phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMPrefetch(
+    const void *pMem, size_t size, ur_usm_migration_flags_t flags,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  return submit(getComputeLane(), &in_order_t::enqueueUSMPrefetch, pMem, size,
+                flags, numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMAdvise(
+    const void *pMem, size_t size, ur_usm_advice_flags_t advice,
+    ur_event_handle_t *phEvent) {
+  return submit(getComputeLane(), &in_order_t::enqueueUSMAdvise, pMem, size,
+                advice, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueDeviceGlobalVariableWrite(
+    ur_program_handle_t hProgram, const char *name, bool blockingWrite,
+    size_t count, size_t offset, const void *pSrc, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getCopyLane(), &in_order_t::enqueueDeviceGlobalVariableWrite,
+                hProgram, name, blockingWrite, count, offset, pSrc,
+                numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueDeviceGlobalVariableRead(
+    ur_program_handle_t hProgram, const char *name, bool blockingRead,
+    size_t count, size_t offset, void *pDst, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getCopyLane(), &in_order_t::enqueueDeviceGlobalVariableRead,
+                hProgram, name, blockingRead, count, offset, pDst,
+                numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueReadHostPipe(
+    ur_program_handle_t hProgram, const char *pipe_symbol, bool blocking,
+    void *pDst, size_t size, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getComputeLane(), &in_order_t::enqueueReadHostPipe, hProgram,
+                pipe_symbol, blocking, pDst, size, numEventsInWaitList,
+                phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueWriteHostPipe(
+    ur_program_handle_t hProgram, const char *pipe_symbol, bool blocking,
+    void *pSrc, size_t size, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getComputeLane(), &in_order_t::enqueueWriteHostPipe, hProgram,
+                pipe_symbol, blocking, pSrc, size, numEventsInWaitList,
+                phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::bindlessImagesImageCopyExp(
+    const void *pSrc, void *pDst, const ur_image_desc_t *pSrcImageDesc,
+    const ur_image_desc_t *pDstImageDesc,
+    const ur_image_format_t *pSrcImageFormat,
+    const ur_image_format_t *pDstImageFormat,
+    ur_exp_image_copy_region_t *pCopyRegion,
+    ur_exp_image_copy_flags_t imageCopyFlags, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getComputeLane(), &in_order_t::bindlessImagesImageCopyExp,
+                pSrc, pDst, pSrcImageDesc, pDstImageDesc, pSrcImageFormat,
+                pDstImageFormat, pCopyRegion, imageCopyFlags,
+                numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t
+ur_queue_immediate_out_of_order_t::bindlessImagesWaitExternalSemaphoreExp(
+    ur_exp_external_semaphore_handle_t hSemaphore, bool hasWaitValue,
+    uint64_t waitValue, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getComputeLane(),
+                &in_order_t::bindlessImagesWaitExternalSemaphoreExp,
+                hSemaphore, hasWaitValue, waitValue, numEventsInWaitList,
+                phEventWaitList, phEvent);
+}
+
+ur_result_t
+ur_queue_immediate_out_of_order_t::bindlessImagesSignalExternalSemaphoreExp(
+    ur_exp_external_semaphore_handle_t hSemaphore, bool hasSignalValue,
+    uint64_t signalValue, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getComputeLane(),
+                &in_order_t::bindlessImagesSignalExternalSemaphoreExp,
+                hSemaphore, hasSignalValue, signalValue, numEventsInWaitList,
+                phEventWaitList, phEvent);
+}
+
+ur_result_t
+ur_queue_immediate_out_of_order_t::enqueueCooperativeKernelLaunchExp(
+    ur_kernel_handle_t hKernel, uint32_t workDim,
+    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
+    const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getComputeLane(),
+                &in_order_t::enqueueCooperativeKernelLaunchExp, hKernel,
+                workDim, pGlobalWorkOffset, pGlobalWorkSize, pLocalWorkSize,
+                numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueTimestampRecordingExp(
+    bool blocking, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return submit(getComputeLane(), &in_order_t::enqueueTimestampRecordingExp,
+                blocking, numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueKernelLaunchCustomExp(
+    ur_kernel_handle_t hKernel, uint32_t workDim,
+    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
+    const size_t *pLocalWorkSize, uint32_t numPropsInLaunchPropList,
+    const ur_exp_launch_property_t *launchPropList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  return submit(getComputeLane(), &in_order_t::enqueueKernelLaunchCustomExp,
+                hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+                pLocalWorkSize, numPropsInLaunchPropList, launchPropList,
+                numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueNativeCommandExp(
+    ur_exp_enqueue_native_command_function_t pfnNativeEnqueue, void *data,
+    uint32_t numMemsInMemList, const ur_mem_handle_t *phMemList,
+    const ur_exp_enqueue_native_command_properties_t *pProperties,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  return submit(getComputeLane(), &in_order_t::enqueueNativeCommandExp,
+                pfnNativeEnqueue, data, numMemsInMemList, phMemList,
+                pProperties, numEventsInWaitList, phEventWaitList, phEvent);
+}
+} // namespace v2
@@ -0,0 +1,240 @@
+//===--------- ze_call_stats.hpp - Level Zero Adapter ---------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+// Accounting of the Level Zero calls made through the ZE_CALL macros. Every
+// entry point has an ID computed at compile time from its name, which indexes
+// arrays of relaxed atomic counters. This header only depends on the standard
+// library so that the tests can read the counters of the adapter.
+
+// Entry points that are counted under their own name, the calls of any other
+// function are counted under "other". The names are those of the functions
+// in the ZE_CALL macros, without the object they may be accessed through.
+#define ZE_CALL_LIST(X)                                                        \
+  X(getDeviceByUUIdFunctionPtr)                                                \
+  X(getSysManDriversFunctionPtr)                                               \
+  X(initDriversFunctionPtr)                                                    \
+  X(sysManInitFunctionPtr)                                                     \
+  X(zeCommandListAppendBarrier)                                                \
+  X(zeCommandListAppendEventReset)                                             \
+  X(zeCommandListAppendImageCopyFromMemory)                                    \
+  X(zeCommandListAppendImageCopyFromMemoryExt)                                 \
+  X(zeCommandListAppendImageCopyRegion)                                        \
+  X(zeCommandListAppendImageCopyToMemory)                                      \
+  X(zeCommandListAppendImageCopyToMemoryExt)                                   \
+  X(zeCommandListAppendLaunchCooperativeKernel)                                \
+  X(zeCommandListAppendLaunchKernel)                                           \
+  X(zeCommandListAppendMemAdvise)                                              \
+  X(zeCommandListAppendMemoryCopy)                                             \
+  X(zeCommandListAppendMemoryCopyRegion)                                       \
+  X(zeCommandListAppendMemoryFill)                                             \
+  X(zeCommandListAppendMemoryPrefetch)                                         \
+  X(zeCommandListAppendQueryKernelTimestamps)                                  \
+  X(zeCommandListAppendSignalEvent)                                            \
+  X(zeCommandListAppendWaitOnEvents)                                           \
+  X(zeCommandListAppendWriteGlobalTimestamp)                                   \
+  X(zeCommandListClose)                                                        \
+  X(zeCommandListCreate)                                                       \
+  X(zeCommandListCreateImmediate)                                              \
+  X(zeCommandListDestroy)                                                      \
+  X(zeCommandListHostSynchronize)                                              \
+  X(zeCommandListImmediateAppendCommandListsExp)                               \
+  X(zeCommandListReset)                                                        \
+  X(zeCommandQueueCreate)                                                      \
+  X(zeCommandQueueDestroy)                                                     \
+  X(zeCommandQueueExecuteCommandLists)                                         \
+  X(zeCommandQueueSynchronize)                                                 \
+  X(zeContextCreate)                                                           \
+  X(zeContextDestroy)                                                          \
+  X(zeContextMakeImageResident)                                                \
+  X(zeContextMakeMemoryResident)                                               \
+  X(zeDeviceCanAccessPeer)                                                     \
+  X(zeDeviceGet)                                                               \
+  X(zeDeviceGetCacheProperties)                                                \
+  X(zeDeviceGetCommandQueueGroupProperties)                                    \
+  X(zeDeviceGetComputeProperties)                                              \
+  X(zeDeviceGetGlobalTimestamps)                                               \
+  X(zeDeviceGetImageProperties)                                                \
+  X(zeDeviceGetMemoryAccessProperties)                                         \
+  X(zeDeviceGetMemoryProperties)                                               \
+  X(zeDeviceGetModuleProperties)                                               \
+  X(zeDeviceGetP2PProperties)                                                  \
+  X(zeDeviceGetProperties)                                                     \
+  X(zeDeviceGetRootDevice)                                                     \
+  X(zeDeviceGetSubDevices)                                                     \
+  X(zeDevicePciGetPropertiesExt)                                               \
+  X(zeDriverGet)                                                               \
+  X(zeDriverGetApiVersion)                                                     \
+  X(zeDriverGetExtensionFunctionAddress)                                       \
+  X(zeDriverGetExtensionProperties)                                            \
+  X(zeDriverGetProperties)                                                     \
+  X(zeEventCreate)                                                             \
+  X(zeEventDestroy)                                                            \
+  X(zeEventHostReset)                                                          \
+  X(zeEventHostSignal)                                                         \
+  X(zeEventHostSynchronize)                                                    \
+  X(zeEventPoolCreate)                                                         \
+  X(zeEventPoolDestroy)                                                        \
+  X(zeEventQueryKernelTimestamp)                                               \
+  X(zeEventQueryStatus)                                                        \
+  X(zeFenceCreate)                                                             \
+  X(zeFenceDestroy)                                                            \
+  X(zeFenceHostSynchronize)                                                    \
+  X(zeFenceQueryStatus)                                                        \
+  X(zeFenceReset)                                                              \
+  X(zeHostSynchronize)                                                         \
+  X(zeImageCreate)                                                             \
+  X(zeImageDestroy)                                                            \
+  X(zeImageGetDeviceOffsetExpFunctionPtr)                                      \
+  X(zeImageViewCreateExt)                                                      \
+  X(zeInit)                                                                    \
+  X(zeIntelGetDriverVersionStringPointer)                                      \
+  X(zeKernelCreate)                                                            \
+  X(zeKernelDestroy)                                                           \
+  X(zeKernelGetName)                                                           \
+  X(zeKernelGetProperties)                                                     \
+  X(zeKernelGetSourceAttributes)                                               \
+  X(zeKernelSetArgumentValue)                                                  \
+  X(zeKernelSetCacheConfig)                                                    \
+  X(zeKernelSetGlobalOffsetExp)                                                \
+  X(zeKernelSetGroupSize)                                                      \
+  X(zeKernelSetIndirectAccess)                                                 \
+  X(zeKernelSuggestGroupSize)                                                  \
+  X(zeKernelSuggestMaxCooperativeGroupCount)                                   \
+  X(zeMemAllocDevice)                                                          \
+  X(zeMemAllocHost)                                                            \
+  X(zeMemAllocShared)                                                          \
+  X(zeMemCloseIpcHandle)                                                       \
+  X(zeMemFree)                                                                 \
+  X(zeMemGetAddressRange)                                                      \
+  X(zeMemGetAllocProperties)                                                   \
+  X(zeMemGetIpcHandle)                                                         \
+  X(zeMemGetPitchFor2dImageFunctionPtr)                                        \
+  X(zeMemOpenIpcHandle)                                                        \
+  X(zeMemPutIpcHandle)                                                         \
+  X(zeModuleBuildLogDestroy)                                                   \
+  X(zeModuleBuildLogGetString)                                                 \
+  X(zeModuleCreate)                                                            \
+  X(zeModuleDestroy)                                                           \
+  X(zeModuleDynamicLink)                                                       \
+  X(zeModuleGetFunctionPointer)                                                \
+  X(zeModuleGetGlobalPointer)                                                  \
+  X(zeModuleGetKernelNames)                                                    \
+  X(zeModuleGetNativeBinary)                                                   \
+  X(zeModuleGetProperties)                                                     \
+  X(zePhysicalMemCreate)                                                       \
+  X(zePhysicalMemDestroy)                                                      \
+  X(zeSamplerCreate)                                                           \
+  X(zeSamplerDestroy)                                                          \
+  X(zeVirtualMemFree)                                                          \
+  X(zeVirtualMemGetAccessAttribute)                                            \
+  X(zeVirtualMemMap)                                                           \
+  X(zeVirtualMemQueryPageSize)                                                 \
+  X(zeVirtualMemReserve)                                                       \
+  X(zeVirtualMemSetAccessAttribute)                                            \
+  X(zeVirtualMemUnmap)                                                         \
+  X(zelLoaderTranslateHandle)                                                  \
+  X(zesDeviceEnumMemoryModules)                                                \
+  X(zesMemoryGetProperties)                                                    \
+  X(zesMemoryGetState)                                                         \
+  X(zexCommandListGetNextCommandIdExp)                                         \
+  X(zexCommandListUpdateMutableCommandsExp)                                    \
+  X(zexDeviceReleaseExternalSemaphoreExp)                                      \
+  X(zexDriverImportExternalPointer)                                            \
+  X(zexDriverReleaseImportedPointer)                                           \
+  X(zexImportExternalSemaphoreExp)
+
+enum ze_call_id_t : uint32_t {
+#define ZE_CALL_ID_ENUM(ZeName) ze_call_id_##ZeName,
+  ZE_CALL_LIST(ZE_CALL_ID_ENUM)
+#undef ZE_CALL_ID_ENUM
+  ze_call_id_other,
+  ze_call_id_count
+};
+
+constexpr std::string_view ZeCallNames[ze_call_id_count] = {
+#define ZE_CALL_NAME(ZeName) #ZeName,
+    ZE_CALL_LIST(ZE_CALL_NAME)
+#undef ZE_CALL_NAME
+    "other"};
+
+// Returns the ID of the function called by the ZeName argument of the ZE_CALL
+// macros, which may be an expression like Platform->ZeExt.zexFunction.
+constexpr ze_call_id_t zeCallId(std::string_view ZeName) {
+  auto Pos = ZeName.find_last_of(".>:");
+  if (Pos != std::string_view::npos) {
+    ZeName = ZeName.substr(Pos + 1);
+  }
+  for (uint32_t Id = 0; Id < ze_call_id_other; Id++) {
+    if (ZeCallNames[Id] == ZeName) {
+      return static_cast<ze_call_id_t>(Id);
+    }
+  }
+  return ze_call_id_other;
+}
+
+// The ID of a call of the ZE_CALL macros, evaluated at compile time.
+#define ZE_CALL_ID(ZeName)                                                     \
+  std::integral_constant<ze_call_id_t, zeCallId(#ZeName)>::value
+
+struct ze_call_stats_t {
+  // Latencies are counted in buckets of powers of two nanoseconds, the last
+  // bucket counts all the calls longer than that.
+  static constexpr size_t NumLatencyBuckets = 32;
+
+  // Counts a successful call.
+  void countCall(ze_call_id_t Id) {
+    Calls[Id].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // Counts the latency of a call, successful or not.
+  void countLatency(ze_call_id_t Id, uint64_t Nanoseconds) {
+    size_t Bucket = 0;
+    while (Nanoseconds >>= 1) {
+      Bucket++;
+    }
+    if (Bucket >= NumLatencyBuckets) {
+      Bucket = NumLatencyBuckets - 1;
+    }
+    Latency[Id][Bucket].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // Number of successful calls of the named entry point.
+  uint64_t getCalls(std::string_view ZeName) const {
+    return Calls[zeCallId(ZeName)].load(std::memory_order_relaxed);
+  }
+  uint64_t getCalls(ze_call_id_t Id) const {
+    return Calls[Id].load(std::memory_order_relaxed);
+  }
+
+  uint64_t getLatencyCount(ze_call_id_t Id, size_t Bucket) const {
+    return Latency[Id][Bucket].load(std::memory_order_relaxed);
+  }
+
+  void resetCalls(std::string_view ZeName) {
+    Calls[zeCallId(ZeName)].store(0, std::memory_order_relaxed);
+  }
+
+private:
+  std::array<std::atomic<uint64_t>, ze_call_id_count> Calls{};
+  std::array<std::array<std::atomic<uint64_t>, NumLatencyBuckets>,
+             ze_call_id_count>
+      Latency{};
+};
+
+// Counters of the calls of the adapter.
+extern ze_call_stats_t ZeCallStats;
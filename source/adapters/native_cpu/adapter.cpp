@@ -29,7 +29,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urAdapterGet(
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urAdapterRelease(ur_adapter_handle_t) {
-  Adapter.RefCount--;
+  if (--Adapter.RefCount == 0) {
+    urLockStatsReport();
+  }
   return UR_RESULT_SUCCESS;
 }
 
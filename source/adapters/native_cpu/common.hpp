@@ -55,7 +55,7 @@ namespace ur {
 
 // Base class to store common data
 struct _ur_object {
-  ur_shared_mutex Mutex;
+  ur_shared_mutex Mutex{"ur_object"};
 };
 
 // Todo: replace this with a common helper once it is available
@@ -72,9 +72,11 @@ template <typename T> inline void decrementOrDelete(T *refC) {
     delete refC;
 }
 
+// Monotonic, so that the profiling timestamps of a command are ordered even
+// if the system clock is adjusted.
 inline uint64_t get_timestamp() {
   return std::chrono::duration_cast<std::chrono::nanoseconds>(
-             std::chrono::high_resolution_clock::now().time_since_epoch())
+             std::chrono::steady_clock::now().time_since_epoch())
       .count();
 }
 
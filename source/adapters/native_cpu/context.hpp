@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <map>
 #include <mutex>
 #include <set>
 #include <ur_api.h>
@@ -81,6 +82,13 @@ static usm_alloc_info get_alloc_info(void *ptr) {
   return *(usm_alloc_info *)get_alloc_info_addr(ptr);
 }
 
+// A virtual memory range mapped to physical memory, stored by its start
+// address.
+struct virtual_range_t {
+  uintptr_t end;
+  ur_virtual_mem_access_flags_t flags;
+};
+
 } // namespace native_cpu
 
 struct ur_context_handle_t_ : RefCounted {
@@ -89,7 +97,7 @@ struct ur_context_handle_t_ : RefCounted {
   ur_device_handle_t _device;
 
   ur_result_t remove_alloc(void *ptr) {
-    std::lock_guard<std::mutex> lock(alloc_mutex);
+    std::lock_guard<ur_mutex> lock(alloc_mutex);
     const native_cpu::usm_alloc_info &info = native_cpu::get_alloc_info(ptr);
     UR_ASSERT(info.type != UR_USM_TYPE_UNKNOWN,
               UR_RESULT_ERROR_INVALID_MEM_OBJECT);
@@ -101,7 +109,7 @@ struct ur_context_handle_t_ : RefCounted {
 
   // Note this is made non-const to access the mutex
   const native_cpu::usm_alloc_info &get_alloc_info_entry(const void *ptr) {
-    std::lock_guard<std::mutex> lock(alloc_mutex);
+    std::lock_guard<ur_mutex> lock(alloc_mutex);
     auto it = allocations.find(ptr);
     if (it == allocations.end()) {
       return native_cpu::usm_alloc_info_null_entry;
@@ -112,7 +120,7 @@ struct ur_context_handle_t_ : RefCounted {
 
   void *add_alloc(uint32_t alignment, ur_usm_type_t type, size_t size,
                   ur_usm_pool_handle_t pool) {
-    std::lock_guard<std::mutex> lock(alloc_mutex);
+    std::lock_guard<ur_mutex> lock(alloc_mutex);
     // We need to ensure that we align to at least alignof(usm_alloc_info),
     // otherwise its start address may be unaligned.
     alignment =
@@ -135,7 +143,74 @@ struct ur_context_handle_t_ : RefCounted {
     return ptr;
   }
 
+  // Records the access flags of a virtual memory range, or forgets the range
+  // when it is unmapped. Mapped ranges that only partially overlap it are
+  // split, and those it does not cover keep their flags.
+  void map_virtual_range(const void *ptr, size_t size,
+                         ur_virtual_mem_access_flags_t flags) {
+    std::lock_guard<ur_mutex> lock(virtual_mutex);
+    auto [first, last] = split_virtual_ranges(ptr, size);
+    virtual_ranges.erase(first, last);
+    virtual_ranges.emplace(uintptr_t(ptr),
+                           native_cpu::virtual_range_t{uintptr_t(ptr) + size,
+                                                       flags});
+  }
+
+  void unmap_virtual_range(const void *ptr, size_t size) {
+    std::lock_guard<ur_mutex> lock(virtual_mutex);
+    auto [first, last] = split_virtual_ranges(ptr, size);
+    virtual_ranges.erase(first, last);
+  }
+
+  void set_virtual_access(const void *ptr, size_t size,
+                          ur_virtual_mem_access_flags_t flags) {
+    std::lock_guard<ur_mutex> lock(virtual_mutex);
+    auto [first, last] = split_virtual_ranges(ptr, size);
+    for (auto it = first; it != last; ++it) {
+      it->second.flags = flags;
+    }
+  }
+
+  // Access flags of the mapped range holding ptr, none if ptr is not mapped.
+  ur_virtual_mem_access_flags_t get_virtual_access(const void *ptr) {
+    std::lock_guard<ur_mutex> lock(virtual_mutex);
+    auto it = virtual_ranges.upper_bound(uintptr_t(ptr));
+    if (it == virtual_ranges.begin() ||
+        std::prev(it)->second.end <= uintptr_t(ptr)) {
+      return UR_VIRTUAL_MEM_ACCESS_FLAG_NONE;
+    }
+    return std::prev(it)->second.flags;
+  }
+
 private:
-  std::mutex alloc_mutex;
+  using virtual_ranges_t = std::map<uintptr_t, native_cpu::virtual_range_t>;
+
+  // Splits the mapped ranges that cross the bounds of [ptr, ptr + size), and
+  // returns the ranges that are then inside it.
+  std::pair<virtual_ranges_t::iterator, virtual_ranges_t::iterator>
+  split_virtual_ranges(const void *ptr, size_t size) {
+    auto split = [&](uintptr_t addr) {
+      auto it = virtual_ranges.upper_bound(addr);
+      if (it == virtual_ranges.begin()) {
+        return;
+      }
+      auto &[start, range] = *std::prev(it);
+      if (start < addr && addr < range.end) {
+        virtual_ranges.emplace_hint(
+            it, addr, native_cpu::virtual_range_t{range.end, range.flags});
+        range.end = addr;
+      }
+    };
+    uintptr_t begin = uintptr_t(ptr);
+    uintptr_t end = begin + size;
+    split(begin);
+    split(end);
+    return {virtual_ranges.lower_bound(begin), virtual_ranges.lower_bound(end)};
+  }
+
+  ur_mutex alloc_mutex{"context.allocations"};
   std::set<const void *> allocations;
+
+  ur_mutex virtual_mutex{"context.virtual_ranges"};
+  virtual_ranges_t virtual_ranges;
 };
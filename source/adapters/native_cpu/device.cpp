@@ -11,8 +11,13 @@
 #include <ur_api.h>
 
 #include "common.hpp"
+#include "numa.hpp"
 #include "platform.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <future>
+
 #if defined(_MSC_VER) || defined(__MINGW32__) || defined(__MINGW64__)
 #ifndef NOMINMAX
 #define NOMINMAX
@@ -129,7 +134,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_TYPE:
     return ReturnValue(UR_DEVICE_TYPE_CPU);
   case UR_DEVICE_INFO_PARENT_DEVICE:
-    return ReturnValue(nullptr);
+    return ReturnValue(hDevice->Parent);
   case UR_DEVICE_INFO_PLATFORM:
     return ReturnValue(hDevice->Platform);
   case UR_DEVICE_INFO_NAME:
@@ -166,15 +171,24 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
     return ReturnValue(bool{true});
   case UR_DEVICE_INFO_MAX_COMPUTE_UNITS:
     return ReturnValue(static_cast<uint32_t>(hDevice->tp.num_threads()));
-  case UR_DEVICE_INFO_PARTITION_MAX_SUB_DEVICES:
-    return ReturnValue(uint32_t{0});
-  case UR_DEVICE_INFO_SUPPORTED_PARTITIONS:
-    // TODO: Ensure this property is tested correctly
-    // Taken from CUDA ur adapter
-    if (pPropSizeRet) {
-      *pPropSizeRet = 0;
+  case UR_DEVICE_INFO_PARTITION_MAX_SUB_DEVICES: {
+    // Each sub-device needs at least one worker of the thread pool.
+    const size_t NumThreads = hDevice->tp.num_threads();
+    return ReturnValue(static_cast<uint32_t>(NumThreads > 1 ? NumThreads : 0));
+  }
+  case UR_DEVICE_INFO_SUPPORTED_PARTITIONS: {
+    // A device that cannot be split into at least two sub-devices reports no
+    // partition types.
+    std::vector<ur_device_partition_t> Partitions;
+    if (hDevice->tp.num_threads() > 1) {
+      Partitions.push_back(UR_DEVICE_PARTITION_EQUALLY);
+      Partitions.push_back(UR_DEVICE_PARTITION_BY_COUNTS);
+      if (hDevice->numa_groups().size() > 1) {
+        Partitions.push_back(UR_DEVICE_PARTITION_BY_AFFINITY_DOMAIN);
+      }
     }
-    return UR_RESULT_SUCCESS;
+    return ReturnValue(Partitions.data(), Partitions.size());
+  }
   case UR_DEVICE_INFO_VENDOR_ID:
     // '0x8086' : 'Intel HD graphics vendor ID'
     return ReturnValue(uint32_t{0x8086});
@@ -209,10 +223,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_MAX_WORK_ITEM_DIMENSIONS:
     return ReturnValue(uint32_t{3});
   case UR_DEVICE_INFO_PARTITION_TYPE:
-    if (pPropSizeRet) {
-      *pPropSizeRet = 0;
-    }
-    return UR_RESULT_SUCCESS;
+    // Empty for the root device.
+    return ReturnValue(hDevice->PartitionProps.data(),
+                       hDevice->PartitionProps.size());
   case UR_EXT_DEVICE_INFO_OPENCL_C_VERSION:
     return ReturnValue("");
   case UR_DEVICE_INFO_QUEUE_PROPERTIES:
@@ -308,8 +321,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_ERROR_CORRECTION_SUPPORT:
     return ReturnValue(bool{false});
   case UR_DEVICE_INFO_PROFILING_TIMER_RESOLUTION:
-    // TODO : CHECK
-    return ReturnValue(size_t{0});
+    // get_timestamp counts nanoseconds.
+    return ReturnValue(size_t{1});
   case UR_DEVICE_INFO_BUILT_IN_KERNELS:
     // TODO : CHECK
     return ReturnValue("");
@@ -319,6 +332,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_PREFERRED_INTEROP_USER_SYNC:
     return ReturnValue(bool{false});
   case UR_DEVICE_INFO_PARTITION_AFFINITY_DOMAIN:
+    if (hDevice->numa_groups().size() > 1) {
+      return ReturnValue(ur_device_affinity_domain_flags_t{
+          UR_DEVICE_AFFINITY_DOMAIN_FLAG_NUMA |
+          UR_DEVICE_AFFINITY_DOMAIN_FLAG_NEXT_PARTITIONABLE});
+    }
     return ReturnValue(ur_device_affinity_domain_flags_t{0});
   case UR_DEVICE_INFO_MAX_MEM_ALLOC_SIZE: {
     size_t Global = hDevice->mem_size;
@@ -337,8 +355,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_PROFILE:
     return ReturnValue("FULL_PROFILE");
   case UR_DEVICE_INFO_REFERENCE_COUNT:
-    // TODO : CHECK
-    return ReturnValue(uint32_t{0});
+    return ReturnValue(uint32_t{hDevice->getReferenceCount()});
   case UR_DEVICE_INFO_BUILD_ON_SUBDEVICE:
     return ReturnValue(bool{0});
   case UR_DEVICE_INFO_ATOMIC_64:
@@ -402,7 +419,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
 
     CASE_UR_UNSUPPORTED(UR_DEVICE_INFO_MAX_MEMORY_BANDWIDTH);
   case UR_DEVICE_INFO_VIRTUAL_MEMORY_SUPPORT:
+#ifdef __linux__
+    return ReturnValue(true);
+#else
     return ReturnValue(false);
+#endif
 
   case UR_DEVICE_INFO_COMMAND_BUFFER_SUPPORT_EXP:
   case UR_DEVICE_INFO_COMMAND_BUFFER_EVENT_SUPPORT_EXP:
@@ -412,7 +433,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
         static_cast<ur_device_command_buffer_update_capability_flags_t>(0));
 
   case UR_DEVICE_INFO_TIMESTAMP_RECORDING_SUPPORT_EXP:
-    return ReturnValue(false);
+    return ReturnValue(true);
 
   case UR_DEVICE_INFO_ENQUEUE_NATIVE_COMMAND_SUPPORT_EXP:
     return ReturnValue(false);
@@ -431,6 +452,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
 UR_APIEXPORT ur_result_t UR_APICALL urDeviceRetain(ur_device_handle_t hDevice) {
   UR_ASSERT(hDevice, UR_RESULT_ERROR_INVALID_NULL_HANDLE)
 
+  // The root device lives as long as the platform.
+  if (hDevice->Parent) {
+    hDevice->incrementReferenceCount();
+  }
   return UR_RESULT_SUCCESS;
 }
 
@@ -438,6 +463,9 @@ UR_APIEXPORT ur_result_t UR_APICALL
 urDeviceRelease(ur_device_handle_t hDevice) {
   UR_ASSERT(hDevice, UR_RESULT_ERROR_INVALID_NULL_HANDLE)
 
+  if (hDevice->Parent) {
+    hDevice->decrementReferenceCount();
+  }
   return UR_RESULT_SUCCESS;
 }
 
@@ -445,13 +473,99 @@ UR_APIEXPORT ur_result_t UR_APICALL urDevicePartition(
     ur_device_handle_t hDevice,
     const ur_device_partition_properties_t *pProperties, uint32_t NumDevices,
     ur_device_handle_t *phSubDevices, uint32_t *pNumDevicesRet) {
-  std::ignore = hDevice;
-  std::ignore = NumDevices;
-  std::ignore = pProperties;
-  std::ignore = phSubDevices;
-  std::ignore = pNumDevicesRet;
+  UR_ASSERT(hDevice, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pProperties && pProperties->pProperties,
+            UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pProperties->PropCount > 0, UR_RESULT_ERROR_INVALID_VALUE);
+
+  // Sub-devices are built from the workers of the thread pool of hDevice,
+  // listed by their thread id in that pool.
+  const size_t NumThreads = hDevice->tp.num_threads();
+  const ur_device_partition_property_t *Props = pProperties->pProperties;
+  std::vector<std::vector<size_t>> Groups;
+  auto addGroup = [&](size_t First, size_t Count) {
+    Groups.emplace_back(Count);
+    for (size_t I = 0; I < Count; I++) {
+      Groups.back()[I] = First + I;
+    }
+  };
+
+  switch (Props[0].type) {
+  case UR_DEVICE_PARTITION_EQUALLY: {
+    UR_ASSERT(pProperties->PropCount == 1, UR_RESULT_ERROR_INVALID_VALUE);
+    const size_t PerDevice = Props[0].value.equally;
+    UR_ASSERT(PerDevice > 0, UR_RESULT_ERROR_INVALID_DEVICE_PARTITION_COUNT);
+    UR_ASSERT(PerDevice <= NumThreads,
+              UR_RESULT_ERROR_DEVICE_PARTITION_FAILED);
+    for (size_t First = 0; First + PerDevice <= NumThreads;
+         First += PerDevice) {
+      addGroup(First, PerDevice);
+    }
+    break;
+  }
+  case UR_DEVICE_PARTITION_BY_COUNTS: {
+    size_t First = 0;
+    for (size_t I = 0; I < pProperties->PropCount; I++) {
+      UR_ASSERT(Props[I].type == UR_DEVICE_PARTITION_BY_COUNTS,
+                UR_RESULT_ERROR_INVALID_VALUE);
+      const size_t Count = Props[I].value.count;
+      UR_ASSERT(Count > 0 && First + Count <= NumThreads,
+                UR_RESULT_ERROR_INVALID_DEVICE_PARTITION_COUNT);
+      addGroup(First, Count);
+      First += Count;
+    }
+    break;
+  }
+  case UR_DEVICE_PARTITION_BY_AFFINITY_DOMAIN: {
+    UR_ASSERT(pProperties->PropCount == 1, UR_RESULT_ERROR_INVALID_VALUE);
+    // NUMA is the only affinity domain known to the adapter, so it is also
+    // the next partitionable one.
+    const auto Domain = Props[0].value.affinity_domain;
+    UR_ASSERT(Domain == UR_DEVICE_AFFINITY_DOMAIN_FLAG_NUMA ||
+                  Domain == UR_DEVICE_AFFINITY_DOMAIN_FLAG_NEXT_PARTITIONABLE,
+              UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION);
+    Groups = hDevice->numa_groups();
+    UR_ASSERT(Groups.size() > 1, UR_RESULT_ERROR_DEVICE_PARTITION_FAILED);
+    break;
+  }
+  default:
+    return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+  }
 
-  DIE_NO_IMPLEMENTATION;
+  // Sub-devices record the properties they were created with, an affinity
+  // domain partition reports the domain it was actually split along.
+  std::vector<ur_device_partition_property_t> PartitionProps(
+      Props, Props + pProperties->PropCount);
+  if (PartitionProps[0].type == UR_DEVICE_PARTITION_BY_AFFINITY_DOMAIN) {
+    PartitionProps[0].value.affinity_domain =
+        UR_DEVICE_AFFINITY_DOMAIN_FLAG_NUMA;
+  }
+  std::vector<uint64_t> Key;
+  for (const auto &Prop : PartitionProps) {
+    Key.push_back(Prop.type);
+    Key.push_back(Prop.value.count);
+  }
+
+  std::lock_guard<std::mutex> Lock(hDevice->SubDevicesMutex);
+  auto &SubDevices = hDevice->SubDevices[Key];
+  if (SubDevices.empty()) {
+    for (const auto &ThreadIds : Groups) {
+      SubDevices.push_back(std::make_unique<ur_device_handle_t_>(
+          hDevice, ThreadIds, PartitionProps));
+    }
+  }
+
+  if (pNumDevicesRet) {
+    *pNumDevicesRet = static_cast<uint32_t>(SubDevices.size());
+  }
+  if (phSubDevices) {
+    const size_t NumRet = std::min<size_t>(NumDevices, SubDevices.size());
+    for (size_t I = 0; I < NumRet; I++) {
+      SubDevices[I]->incrementReferenceCount();
+      phSubDevices[I] = SubDevices[I].get();
+    }
+  }
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetNativeHandle(
@@ -478,11 +592,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
     ur_device_handle_t hDevice, uint64_t *pDeviceTimestamp,
     uint64_t *pHostTimestamp) {
   std::ignore = hDevice;
+  // The device and the host share the clock of the profiling timestamps.
+  const uint64_t timestamp = get_timestamp();
   if (pHostTimestamp) {
-    *pHostTimestamp = get_timestamp();
+    *pHostTimestamp = timestamp;
   }
   if (pDeviceTimestamp) {
-    *pDeviceTimestamp = get_timestamp();
+    *pDeviceTimestamp = timestamp;
   }
   return UR_RESULT_SUCCESS;
 }
@@ -513,3 +629,84 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceSelectBinary(
 
 ur_device_handle_t_::ur_device_handle_t_(ur_platform_handle_t ArgPlt)
     : mem_size(os_memory_bounded_size()), Platform(ArgPlt) {}
+
+ur_device_handle_t_::ur_device_handle_t_(
+    ur_device_handle_t ArgParent, const std::vector<size_t> &ThreadIds,
+    std::vector<ur_device_partition_property_t> ArgProps)
+    : tp(ArgParent->tp, ThreadIds), mem_size(ArgParent->mem_size),
+      Platform(ArgParent->Platform), Parent(ArgParent),
+      PartitionProps(std::move(ArgProps)) {
+  // Counted each time urDevicePartition hands the sub-device out.
+  _refCount = 0;
+}
+
+std::vector<std::vector<size_t>> ur_device_handle_t_::numa_groups() const {
+  const auto &Topology = native_cpu::numa::get_topology();
+  std::vector<std::vector<size_t>> Groups(Topology.nodes.size());
+  for (size_t I = 0; I < tp.num_threads(); I++) {
+    const int Node = Topology.node_of(tp.cpu_of(I));
+    if (Node >= 0) {
+      Groups[Node].push_back(I);
+    }
+  }
+  Groups.erase(std::remove_if(Groups.begin(), Groups.end(),
+                              [](const auto &Group) { return Group.empty(); }),
+               Groups.end());
+  return Groups;
+}
+
+void ur_device_handle_t_::place_memory(void *ptr, const void *src,
+                                       size_t size) {
+  const auto placement = native_cpu::numa::get_placement();
+  if (placement == native_cpu::numa::placement_t::none) {
+    if (src) {
+      std::memcpy(ptr, src, size);
+    }
+    return;
+  }
+
+  // A page is placed by its first access, so without a source to copy only
+  // one byte per page is written.
+  constexpr size_t pageSize = 4096;
+  auto touch = [ptr, src](size_t offset, size_t count) {
+    char *dst = static_cast<char *>(ptr) + offset;
+    if (src) {
+      std::memcpy(dst, static_cast<const char *>(src) + offset, count);
+      return;
+    }
+    if (count == 0) {
+      return;
+    }
+    for (size_t i = 0; i < count; i += pageSize) {
+      dst[i] = 0;
+    }
+    // The range may end in a page that the stride skipped.
+    dst[count - 1] = 0;
+  };
+
+  if (placement == native_cpu::numa::placement_t::local) {
+    touch(0, size);
+    return;
+  }
+
+  // Worker i touches the i-th slice, the same split a kernel launch uses for
+  // its work-groups, rounded to whole pages.
+  const size_t numThreads = tp.num_threads();
+  if (numThreads <= 1) {
+    touch(0, size);
+    return;
+  }
+  // At least one page, so that small allocations still make progress.
+  const size_t slice =
+      ((size + numThreads - 1) / numThreads + pageSize - 1) / pageSize *
+      pageSize;
+  std::vector<std::future<void>> touched;
+  for (size_t offset = 0, i = 0; offset < size; offset += slice, i++) {
+    const size_t count = std::min(slice, size - offset);
+    touched.push_back(tp.schedule_task_on(
+        i, [touch, offset, count](size_t) { touch(offset, count); }));
+  }
+  for (auto &future : touched) {
+    future.wait();
+  }
+}
@@ -10,13 +10,50 @@
 
 #pragma once
 
+#include "event.hpp"
 #include "threadpool.hpp"
+#include <map>
+#include <memory>
+#include <mutex>
 #include <ur/ur.hpp>
+#include <vector>
+
+struct ur_device_handle_t_ : RefCounted {
+  // Declared before the thread pool, so that the workers are joined before
+  // the pooled events are freed.
+  native_cpu::event_pool_t events;
+
+  // Sub-devices are created on the first request for a partition and kept
+  // with their parent, so repeating a partition returns the same devices.
+  // Their reference count is tracked, but they are only freed with the
+  // parent.
+  // Declared before the thread pool, since their commands run on its
+  // workers. Keyed by the partition properties.
+  std::map<std::vector<uint64_t>,
+           std::vector<std::unique_ptr<ur_device_handle_t_>>>
+      SubDevices;
+  std::mutex SubDevicesMutex;
 
-struct ur_device_handle_t_ {
   native_cpu::threadpool_t tp;
   ur_device_handle_t_(ur_platform_handle_t ArgPlt);
 
+  // A sub-device owning the given workers of the thread pool of its parent.
+  ur_device_handle_t_(ur_device_handle_t ArgParent,
+                      const std::vector<size_t> &ThreadIds,
+                      std::vector<ur_device_partition_property_t> ArgProps);
+
+  // Places the pages of a new allocation as selected by
+  // SYCL_NATIVE_CPU_MEM_PLACEMENT, copying src into it if given.
+  void place_memory(void *ptr, const void *src, size_t size);
+
+  // Splits the workers of the device into groups, one per NUMA node.
+  std::vector<std::vector<size_t>> numa_groups() const;
+
   const uint64_t mem_size;
   ur_platform_handle_t Platform;
+
+  // Null for the root device.
+  ur_device_handle_t Parent = nullptr;
+  // The properties the device was partitioned from its parent with.
+  std::vector<ur_device_partition_property_t> PartitionProps;
 };
@@ -8,6 +8,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 #include "ur_api.h"
@@ -63,13 +64,25 @@ static native_cpu::state getResizedState(const native_cpu::NDRDescT &ndr,
 }
 #endif
 
+// Hands the event of an enqueued command to the caller, or drops it if the
+// caller did not ask for one. The queue keeps its own reference until the
+// command completes.
+static ur_result_t returnEvent(ur_event_handle_t event,
+                               ur_event_handle_t *phEvent) {
+  if (phEvent) {
+    *phEvent = event;
+  } else {
+    event->release();
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
     ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
     const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
     const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
 
-  urEventWait(numEventsInWaitList, phEventWaitList);
   UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT(pGlobalWorkOffset, UR_RESULT_ERROR_INVALID_NULL_POINTER);
@@ -104,11 +117,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
   // TODO: add proper error checking
   native_cpu::NDRDescT ndr(workDim, pGlobalWorkOffset, pGlobalWorkSize,
                            pLocalWorkSize);
-  auto &tp = hQueue->getDevice()->tp;
-  const size_t numParallelThreads = tp.num_threads();
-  hKernel->updateMemPool(numParallelThreads);
-  std::vector<std::future<void>> futures;
-  std::vector<std::function<void(size_t, ur_kernel_handle_t_)>> groups;
+  std::vector<native_cpu::worker_task_t> tasks;
   auto numWG0 = ndr.GlobalSize[0] / ndr.LocalSize[0];
   auto numWG1 = ndr.GlobalSize[1] / ndr.LocalSize[1];
   auto numWG2 = ndr.GlobalSize[2] / ndr.LocalSize[2];
@@ -116,26 +125,31 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
                           ndr.GlobalSize[2], ndr.LocalSize[0], ndr.LocalSize[1],
                           ndr.LocalSize[2], ndr.GlobalOffset[0],
                           ndr.GlobalOffset[1], ndr.GlobalOffset[2]);
-  auto event = new ur_event_handle_t_(hQueue, UR_COMMAND_KERNEL_LAUNCH);
-  event->tick_start();
+  auto event = hQueue->createEvent(UR_COMMAND_KERNEL_LAUNCH);
 
 #ifndef NATIVECPU_USE_OCK
-  hKernel->handleLocalArgs(1, 0);
-  for (unsigned g2 = 0; g2 < numWG2; g2++) {
-    for (unsigned g1 = 0; g1 < numWG1; g1++) {
-      for (unsigned g0 = 0; g0 < numWG0; g0++) {
-        for (unsigned local2 = 0; local2 < ndr.LocalSize[2]; local2++) {
-          for (unsigned local1 = 0; local1 < ndr.LocalSize[1]; local1++) {
-            for (unsigned local0 = 0; local0 < ndr.LocalSize[0]; local0++) {
-              state.update(g0, g1, g2, local0, local1, local2);
-              hKernel->_subhandler(hKernel->getArgs().data(), &state);
+  auto launch = hKernel->makeLaunch(1);
+  tasks.emplace_back([launch, state, ndr, numWG0, numWG1,
+                      numWG2](size_t) mutable {
+    auto args = launch->getArgs(0);
+    for (unsigned g2 = 0; g2 < numWG2; g2++) {
+      for (unsigned g1 = 0; g1 < numWG1; g1++) {
+        for (unsigned g0 = 0; g0 < numWG0; g0++) {
+          for (unsigned local2 = 0; local2 < ndr.LocalSize[2]; local2++) {
+            for (unsigned local1 = 0; local1 < ndr.LocalSize[1]; local1++) {
+              for (unsigned local0 = 0; local0 < ndr.LocalSize[0]; local0++) {
+                state.update(g0, g1, g2, local0, local1, local2);
+                launch->Subhandler(args.data(), &state);
+              }
             }
           }
         }
       }
     }
-  }
+  });
 #else
+  const size_t numParallelThreads = hQueue->getDevice()->tp.num_threads();
+  auto launch = hKernel->makeLaunch(numParallelThreads);
   bool isLocalSizeOne =
       ndr.LocalSize[0] == 1 && ndr.LocalSize[1] == 1 && ndr.LocalSize[2] == 1;
   if (isLocalSizeOne && ndr.GlobalSize[0] > numParallelThreads) {
@@ -159,20 +173,27 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
     for (unsigned g2 = 0; g2 < numWG2; g2++) {
       for (unsigned g1 = 0; g1 < numWG1; g1++) {
         for (unsigned g0 = 0; g0 < new_num_work_groups_0; g0 += 1) {
-          futures.emplace_back(tp.schedule_task(
-              [ndr, itemsPerThread, kernel = *hKernel, g0, g1, g2](size_t) {
+          tasks.emplace_back(
+              [ndr, itemsPerThread, launch, g0, g1, g2](size_t threadId) {
                 native_cpu::state resized_state =
                     getResizedState(ndr, itemsPerThread);
                 resized_state.update(g0, g1, g2);
-                kernel._subhandler(kernel.getArgs().data(), &resized_state);
-              }));
+                auto args = launch->getArgs(threadId);
+                launch->Subhandler(args.data(), &resized_state);
+              });
         }
         // Peel the remaining work items. Since the local size is 1, we iterate
         // over the work groups.
-        for (unsigned g0 = new_num_work_groups_0 * itemsPerThread; g0 < numWG0;
-             g0++) {
-          state.update(g0, g1, g2);
-          hKernel->_subhandler(hKernel->getArgs().data(), &state);
+        size_t first = new_num_work_groups_0 * itemsPerThread;
+        if (first < numWG0) {
+          tasks.emplace_back([state, launch, first, numWG0, g1,
+                              g2](size_t threadId) mutable {
+            auto args = launch->getArgs(threadId);
+            for (unsigned g0 = first; g0 < numWG0; g0++) {
+              state.update(g0, g1, g2);
+              launch->Subhandler(args.data(), &state);
+            }
+          });
         }
       }
     }
@@ -184,117 +205,132 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
       // Dimensions 1 and 2 have enough work, split them across the threadpool
       for (unsigned g2 = 0; g2 < numWG2; g2++) {
         for (unsigned g1 = 0; g1 < numWG1; g1++) {
-          futures.emplace_back(
-              tp.schedule_task([state, kernel = *hKernel, numWG0, g1, g2,
-                                numParallelThreads](size_t threadId) mutable {
+          tasks.emplace_back(
+              [state, launch, numWG0, g1, g2](size_t threadId) mutable {
+                auto args = launch->getArgs(threadId);
                 for (unsigned g0 = 0; g0 < numWG0; g0++) {
-                  kernel.handleLocalArgs(numParallelThreads, threadId);
                   state.update(g0, g1, g2);
-                  kernel._subhandler(kernel.getArgs().data(), &state);
+                  launch->Subhandler(args.data(), &state);
                 }
-              }));
+              });
         }
       }
     } else {
       // Split dimension 0 across the threadpool
       // Here we try to create groups of workgroups in order to reduce
       // synchronization overhead
-      for (unsigned g2 = 0; g2 < numWG2; g2++) {
-        for (unsigned g1 = 0; g1 < numWG1; g1++) {
-          for (unsigned g0 = 0; g0 < numWG0; g0++) {
-            groups.push_back(
-                [state, g0, g1, g2, numParallelThreads](
-                    size_t threadId, ur_kernel_handle_t_ kernel) mutable {
-                  kernel.handleLocalArgs(numParallelThreads, threadId);
-                  state.update(g0, g1, g2);
-                  kernel._subhandler(kernel.getArgs().data(), &state);
-                });
-          }
-        }
-      }
-      auto numGroups = groups.size();
+      auto numGroups = numWG0 * numWG1 * numWG2;
       auto groupsPerThread = numGroups / numParallelThreads;
       auto remainder = numGroups % numParallelThreads;
+      auto runGroups = [state, launch, numWG0, numWG1](
+                           size_t threadId, size_t first,
+                           size_t count) mutable {
+        auto args = launch->getArgs(threadId);
+        for (size_t index = first; index < first + count; index++) {
+          state.update(index % numWG0, (index / numWG0) % numWG1,
+                       index / (numWG0 * numWG1));
+          launch->Subhandler(args.data(), &state);
+        }
+      };
       for (unsigned thread = 0; thread < numParallelThreads; thread++) {
-        futures.emplace_back(
-            tp.schedule_task([groups, thread, groupsPerThread,
-                              kernel = *hKernel](size_t threadId) {
-              for (unsigned i = 0; i < groupsPerThread; i++) {
-                auto index = thread * groupsPerThread + i;
-                groups[index](threadId, kernel);
-              }
-            }));
+        tasks.emplace_back([runGroups, thread,
+                            groupsPerThread](size_t threadId) mutable {
+          runGroups(threadId, thread * groupsPerThread, groupsPerThread);
+        });
       }
 
       // schedule the remaining tasks
       if (remainder) {
-        futures.emplace_back(
-            tp.schedule_task([groups, remainder,
-                              scheduled = numParallelThreads * groupsPerThread,
-                              kernel = *hKernel](size_t threadId) {
-              for (unsigned i = 0; i < remainder; i++) {
-                auto index = scheduled + i;
-                groups[index](threadId, kernel);
-              }
-            }));
+        tasks.emplace_back(
+            [runGroups, remainder,
+             scheduled = numParallelThreads * groupsPerThread](
+                size_t threadId) mutable {
+              runGroups(threadId, scheduled, remainder);
+            });
       }
     }
   }
 
 #endif // NATIVECPU_USE_OCK
-  event->set_futures(futures);
-
-  *phEvent = event;
-  event->set_callback([hKernel, event]() {
-    event->tick_end();
-    // TODO: avoid calling clear() here.
-    hKernel->_localArgInfo.clear();
-  });
-
-  if (hQueue->isInOrder()) {
-    urEventWait(1, phEvent);
-  }
+  event->set_tasks(std::move(tasks));
+  hQueue->enqueue(event, numEventsInWaitList, phEventWaitList,
+                  ur_queue_handle_t_::ENQUEUE_FLAG_BATCHABLE);
 
-  return UR_RESULT_SUCCESS;
+  return returnEvent(event, phEvent);
 }
 
+// Enqueues a host-side command. It runs on the submitting thread if nothing
+// is left to wait for, and otherwise once its dependencies complete, so f
+// must not reference the caller's stack.
 ur_result_t withTimingEvent(ur_command_t command_type, ur_queue_handle_t hQueue,
                             uint32_t numEventsInWaitList,
                             const ur_event_handle_t *phEventWaitList,
                             ur_event_handle_t *phEvent,
-                            const std::function<ur_result_t()> &f) {
-  urEventWait(numEventsInWaitList, phEventWaitList);
-  ur_event_handle_t event;
-  if (phEvent) {
-    event = new ur_event_handle_t_(hQueue, command_type);
-    event->tick_start();
-  }
-
-  ur_result_t result = f();
+                            std::function<ur_result_t()> &&f,
+                            bool blocking = false) {
+  auto event = hQueue->createEvent(command_type);
+  std::vector<native_cpu::worker_task_t> tasks;
+  tasks.emplace_back([f = std::move(f)](size_t) {
+    ur_result_t result = f();
+    if (result != UR_RESULT_SUCCESS) {
+      logger::error("Enqueued command failed with error {}", result);
+    }
+  });
+  event->set_tasks(std::move(tasks), true);
+  hQueue->enqueue(event, numEventsInWaitList, phEventWaitList);
 
-  if (phEvent) {
-    event->tick_end();
-    *phEvent = event;
+  if (blocking) {
+    event->wait();
   }
-  return result;
+  return returnEvent(event, phEvent);
+}
+
+// Enqueues a command without work, which only orders other commands.
+static ur_result_t enqueueSyncCommand(ur_command_t command_type,
+                                      ur_queue_handle_t hQueue,
+                                      uint32_t numEventsInWaitList,
+                                      const ur_event_handle_t *phEventWaitList,
+                                      ur_event_handle_t *phEvent,
+                                      uint32_t flags) {
+  auto event = hQueue->createEvent(command_type);
+  hQueue->enqueue(event, numEventsInWaitList, phEventWaitList, flags);
+  return returnEvent(event, phEvent);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWait(
     ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-
-  // TODO: the wait here should be async
-  return withTimingEvent(UR_COMMAND_EVENTS_WAIT, hQueue, numEventsInWaitList,
-                         phEventWaitList, phEvent,
-                         [&]() { return UR_RESULT_SUCCESS; });
+  return enqueueSyncCommand(UR_COMMAND_EVENTS_WAIT, hQueue, numEventsInWaitList,
+                            phEventWaitList, phEvent,
+                            ur_queue_handle_t_::ENQUEUE_FLAG_WAIT_FOR_ALL);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
     ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  return withTimingEvent(UR_COMMAND_EVENTS_WAIT_WITH_BARRIER, hQueue,
-                         numEventsInWaitList, phEventWaitList, phEvent,
-                         [&]() { return UR_RESULT_SUCCESS; });
+  return enqueueSyncCommand(UR_COMMAND_EVENTS_WAIT_WITH_BARRIER, hQueue,
+                            numEventsInWaitList, phEventWaitList, phEvent,
+                            ur_queue_handle_t_::ENQUEUE_FLAG_WAIT_FOR_ALL |
+                                ur_queue_handle_t_::ENQUEUE_FLAG_BARRIER);
+}
+
+// Records the time at which the commands before it have completed, like a
+// marker. The timestamp is taken on a worker once the command is ready.
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
+    ur_queue_handle_t hQueue, bool blocking, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(phEvent, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(numEventsInWaitList == 0 || phEventWaitList,
+            UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+
+  auto event = hQueue->createEvent(UR_COMMAND_TIMESTAMP_RECORDING_EXP);
+  hQueue->enqueue(event, numEventsInWaitList, phEventWaitList,
+                  ur_queue_handle_t_::ENQUEUE_FLAG_WAIT_FOR_ALL);
+  if (blocking) {
+    event->wait();
+  }
+  return returnEvent(event, phEvent);
 }
 
 UR_APIEXPORT ur_result_t urEnqueueEventsWaitWithBarrierExt(
@@ -305,23 +341,36 @@ UR_APIEXPORT ur_result_t urEnqueueEventsWaitWithBarrierExt(
                                         phEventWaitList, phEvent);
 }
 
+// Reference to a memory object held by a command until it has run, as the
+// application may release the memory object as soon as it is enqueued.
+using mem_ref_t = std::shared_ptr<ur_mem_handle_t_>;
+
+static mem_ref_t retainMem(ur_mem_handle_t hMem) {
+  hMem->incrementRefCount();
+  return mem_ref_t(hMem, [](ur_mem_handle_t hMem) { urMemRelease(hMem); });
+}
+
 template <bool IsRead>
 static inline ur_result_t enqueueMemBufferReadWriteRect_impl(
-    ur_queue_handle_t hQueue, ur_mem_handle_t Buff, bool,
+    ur_queue_handle_t hQueue, ur_mem_handle_t Buff, bool Blocking,
     ur_rect_offset_t BufferOffset, ur_rect_offset_t HostOffset,
     ur_rect_region_t region, size_t BufferRowPitch, size_t BufferSlicePitch,
     size_t HostRowPitch, size_t HostSlicePitch,
     typename std::conditional<IsRead, void *, const void *>::type DstMem,
     uint32_t NumEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+    ur_event_handle_t *phEvent, ur_mem_handle_t DstBuff = nullptr) {
   ur_command_t command_t;
   if constexpr (IsRead)
     command_t = UR_COMMAND_MEM_BUFFER_READ_RECT;
   else
     command_t = UR_COMMAND_MEM_BUFFER_WRITE_RECT;
+  auto BuffRef = retainMem(Buff);
+  auto DstBuffRef = DstBuff ? retainMem(DstBuff) : nullptr;
   return withTimingEvent(
-      command_t, hQueue, NumEventsInWaitList, phEventWaitList, phEvent, [&]() {
-        // TODO: blocking, check other constraints, performance optimizations
+      command_t, hQueue, NumEventsInWaitList, phEventWaitList, phEvent,
+      [=, BuffRef = std::move(BuffRef),
+       DstBuffRef = std::move(DstBuffRef)]() mutable {
+        // TODO: check other constraints, performance optimizations
         //       More sharing with level_zero where possible
 
         if (BufferRowPitch == 0)
@@ -349,7 +398,8 @@ static inline ur_result_t enqueueMemBufferReadWriteRect_impl(
             }
 
         return UR_RESULT_SUCCESS;
-      });
+      },
+      Blocking);
 }
 
 static inline ur_result_t doCopy_impl(ur_queue_handle_t hQueue, void *DstPtr,
@@ -357,24 +407,27 @@ static inline ur_result_t doCopy_impl(ur_queue_handle_t hQueue, void *DstPtr,
                                       uint32_t numEventsInWaitList,
                                       const ur_event_handle_t *phEventWaitList,
                                       ur_event_handle_t *phEvent,
-                                      ur_command_t command_type) {
-  return withTimingEvent(command_type, hQueue, numEventsInWaitList,
-                         phEventWaitList, phEvent, [&]() {
-                           if (SrcPtr != DstPtr && Size)
-                             memmove(DstPtr, SrcPtr, Size);
-                           return UR_RESULT_SUCCESS;
-                         });
+                                      ur_command_t command_type,
+                                      bool blocking = false,
+                                      std::vector<mem_ref_t> memRefs = {}) {
+  return withTimingEvent(
+      command_type, hQueue, numEventsInWaitList, phEventWaitList, phEvent,
+      [=, memRefs = std::move(memRefs)]() {
+        if (SrcPtr != DstPtr && Size)
+          memmove(DstPtr, SrcPtr, Size);
+        return UR_RESULT_SUCCESS;
+      },
+      blocking);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferRead(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingRead,
     size_t offset, size_t size, void *pDst, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = blockingRead;
-
   void *FromPtr = /*Src*/ hBuffer->_mem + offset;
   auto res = doCopy_impl(hQueue, pDst, FromPtr, size, numEventsInWaitList,
-                         phEventWaitList, phEvent, UR_COMMAND_MEM_BUFFER_READ);
+                         phEventWaitList, phEvent, UR_COMMAND_MEM_BUFFER_READ,
+                         blockingRead, {retainMem(hBuffer)});
   return res;
 }
 
@@ -382,11 +435,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWrite(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingWrite,
     size_t offset, size_t size, const void *pSrc, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = blockingWrite;
-
   void *ToPtr = hBuffer->_mem + offset;
   auto res = doCopy_impl(hQueue, ToPtr, pSrc, size, numEventsInWaitList,
-                         phEventWaitList, phEvent, UR_COMMAND_MEM_BUFFER_WRITE);
+                         phEventWaitList, phEvent, UR_COMMAND_MEM_BUFFER_WRITE,
+                         blockingWrite, {retainMem(hBuffer)});
   return res;
 }
 
@@ -421,11 +473,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
     ur_mem_handle_t hBufferDst, size_t srcOffset, size_t dstOffset, size_t size,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
-  urEventWait(numEventsInWaitList, phEventWaitList);
   const void *SrcPtr = hBufferSrc->_mem + srcOffset;
   void *DstPtr = hBufferDst->_mem + dstOffset;
   return doCopy_impl(hQueue, DstPtr, SrcPtr, size, numEventsInWaitList,
-                     phEventWaitList, phEvent, UR_COMMAND_MEM_BUFFER_COPY);
+                     phEventWaitList, phEvent, UR_COMMAND_MEM_BUFFER_COPY,
+                     false, {retainMem(hBufferSrc), retainMem(hBufferDst)});
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
@@ -439,7 +491,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
       hQueue, hBufferSrc, false /*todo: check blocking*/, srcOrigin,
       /*HostOffset*/ dstOrigin, region, srcRowPitch, srcSlicePitch, dstRowPitch,
       dstSlicePitch, hBufferDst->_mem, numEventsInWaitList, phEventWaitList,
-      phEvent);
+      phEvent, hBufferDst);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferFill(
@@ -448,18 +500,21 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferFill(
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
 
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  // The pattern may be freed as soon as this returns.
+  const auto *patternBytes = static_cast<const uint8_t *>(pPattern);
+  std::vector<uint8_t> pattern(patternBytes, patternBytes + patternSize);
+  auto bufferRef = retainMem(hBuffer);
   return withTimingEvent(
       UR_COMMAND_MEM_BUFFER_FILL, hQueue, numEventsInWaitList, phEventWaitList,
-      phEvent, [&]() {
-        UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
-
+      phEvent, [=, bufferRef = std::move(bufferRef)]() {
         // TODO: error checking
-        // TODO: handle async
         void *startingPtr = hBuffer->_mem + offset;
         unsigned steps = size / patternSize;
         for (unsigned i = 0; i < steps; i++) {
-          memcpy(static_cast<int8_t *>(startingPtr) + i * patternSize, pPattern,
-                 patternSize);
+          memcpy(static_cast<int8_t *>(startingPtr) + i * patternSize,
+                 pattern.data(), patternSize);
         }
 
         return UR_RESULT_SUCCESS;
@@ -530,15 +585,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferMap(
     ur_map_flags_t mapFlags, size_t offset, size_t size,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent, void **ppRetMap) {
-  std::ignore = blockingMap;
   std::ignore = mapFlags;
   std::ignore = size;
 
-  return withTimingEvent(UR_COMMAND_MEM_BUFFER_MAP, hQueue, numEventsInWaitList,
-                         phEventWaitList, phEvent, [&]() {
-                           *ppRetMap = hBuffer->_mem + offset;
-                           return UR_RESULT_SUCCESS;
-                         });
+  // The buffer is host memory, so mapping only needs to wait for the commands
+  // the map depends on.
+  *ppRetMap = hBuffer->_mem + offset;
+  return withTimingEvent(
+      UR_COMMAND_MEM_BUFFER_MAP, hQueue, numEventsInWaitList, phEventWaitList,
+      phEvent, []() { return UR_RESULT_SUCCESS; }, blockingMap);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemUnmap(
@@ -549,24 +604,28 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemUnmap(
   std::ignore = pMappedPtr;
   return withTimingEvent(UR_COMMAND_MEM_UNMAP, hQueue, numEventsInWaitList,
                          phEventWaitList, phEvent,
-                         [&]() { return UR_RESULT_SUCCESS; });
+                         []() { return UR_RESULT_SUCCESS; });
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
     ur_queue_handle_t hQueue, void *ptr, size_t patternSize,
     const void *pPattern, size_t size, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  UR_ASSERT(ptr, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pPattern, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(patternSize != 0, UR_RESULT_ERROR_INVALID_SIZE)
+  UR_ASSERT(size != 0, UR_RESULT_ERROR_INVALID_SIZE)
+  UR_ASSERT(patternSize < size, UR_RESULT_ERROR_INVALID_SIZE)
+  UR_ASSERT(size % patternSize == 0, UR_RESULT_ERROR_INVALID_SIZE)
+  // TODO: add check for allocation size once the query is supported
+
+  // The pattern may be freed as soon as this returns.
+  const auto *patternBytes = static_cast<const uint8_t *>(pPattern);
+  std::vector<uint8_t> patternCopy(patternBytes, patternBytes + patternSize);
   return withTimingEvent(
       UR_COMMAND_USM_FILL, hQueue, numEventsInWaitList, phEventWaitList,
-      phEvent, [&]() {
-        UR_ASSERT(ptr, UR_RESULT_ERROR_INVALID_NULL_POINTER);
-        UR_ASSERT(pPattern, UR_RESULT_ERROR_INVALID_NULL_POINTER);
-        UR_ASSERT(patternSize != 0, UR_RESULT_ERROR_INVALID_SIZE)
-        UR_ASSERT(size != 0, UR_RESULT_ERROR_INVALID_SIZE)
-        UR_ASSERT(patternSize < size, UR_RESULT_ERROR_INVALID_SIZE)
-        UR_ASSERT(size % patternSize == 0, UR_RESULT_ERROR_INVALID_SIZE)
-        // TODO: add check for allocation size once the query is supported
-
+      phEvent, [=]() {
+        const void *pPattern = patternCopy.data();
         switch (patternSize) {
         case 1:
           memset(ptr, *static_cast<const uint8_t *>(pPattern),
@@ -612,18 +671,18 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
     ur_queue_handle_t hQueue, bool blocking, void *pDst, const void *pSrc,
     size_t size, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = blocking;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_QUEUE);
+  UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
   return withTimingEvent(
       UR_COMMAND_USM_MEMCPY, hQueue, numEventsInWaitList, phEventWaitList,
-      phEvent, [&]() {
-        UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_QUEUE);
-        UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
-        UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
-
+      phEvent,
+      [=]() {
         memcpy(pDst, pSrc, size);
-
         return UR_RESULT_SUCCESS;
-      });
+      },
+      blocking);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMPrefetch(
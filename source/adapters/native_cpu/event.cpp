@@ -11,10 +11,14 @@
 #include "ur_api.h"
 
 #include "common.hpp"
+#include "device.hpp"
 #include "event.hpp"
 #include "queue.hpp"
+#include <algorithm>
 #include <cstdint>
+#include <memory>
 #include <mutex>
+#include <thread>
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventGetInfo(ur_event_handle_t hEvent,
                                                    ur_event_info_t propName,
@@ -28,7 +32,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventGetInfo(ur_event_handle_t hEvent,
   case UR_EVENT_INFO_COMMAND_TYPE:
     return ReturnValue(hEvent->getCommandType());
   case UR_EVENT_INFO_REFERENCE_COUNT:
-    return ReturnValue(hEvent->getReferenceCount());
+    return ReturnValue(hEvent->getUserReferenceCount());
   case UR_EVENT_INFO_COMMAND_EXECUTION_STATUS:
     return ReturnValue(hEvent->getExecutionStatus());
   case UR_EVENT_INFO_CONTEXT:
@@ -43,15 +47,23 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventGetInfo(ur_event_handle_t hEvent,
 UR_APIEXPORT ur_result_t UR_APICALL urEventGetProfilingInfo(
     ur_event_handle_t hEvent, ur_profiling_info_t propName, size_t propSize,
     void *pPropValue, size_t *pPropSizeRet) {
+  if (!hEvent->isProfiling() ||
+      hEvent->getExecutionStatus() != UR_EVENT_STATUS_COMPLETE) {
+    return UR_RESULT_ERROR_PROFILING_INFO_NOT_AVAILABLE;
+  }
+
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
   switch (propName) {
+  case UR_PROFILING_INFO_COMMAND_QUEUED:
+    return ReturnValue(hEvent->get_queued_timestamp());
+  case UR_PROFILING_INFO_COMMAND_SUBMIT:
+    return ReturnValue(hEvent->get_submit_timestamp());
   case UR_PROFILING_INFO_COMMAND_START:
     return ReturnValue(hEvent->get_start_timestamp());
   case UR_PROFILING_INFO_COMMAND_END:
     return ReturnValue(hEvent->get_end_timestamp());
-  case UR_PROFILING_INFO_COMMAND_QUEUED:
-  case UR_PROFILING_INFO_COMMAND_SUBMIT:
   case UR_PROFILING_INFO_COMMAND_COMPLETE:
+    return ReturnValue(hEvent->get_complete_timestamp());
   default:
     break;
   }
@@ -68,12 +80,12 @@ urEventWait(uint32_t numEvents, const ur_event_handle_t *phEventWaitList) {
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventRetain(ur_event_handle_t hEvent) {
-  hEvent->incrementReferenceCount();
+  hEvent->retainByUser();
   return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventRelease(ur_event_handle_t hEvent) {
-  decrementOrDelete(hEvent);
+  hEvent->releaseByUser();
   return UR_RESULT_SUCCESS;
 }
 
@@ -108,23 +120,9 @@ urEventSetCallback(ur_event_handle_t hEvent, ur_execution_info_t execStatus,
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
-    ur_queue_handle_t hQueue, bool blocking, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = blocking;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
-  DIE_NO_IMPLEMENTATION;
-}
-
 ur_event_handle_t_::ur_event_handle_t_(ur_queue_handle_t queue,
-                                       ur_command_t command_type)
-    : queue(queue), context(queue->getContext()), command_type(command_type),
-      done(false) {
-  this->queue->addEvent(this);
+                                       ur_command_t command_type) {
+  reset(queue, command_type);
 }
 
 ur_event_handle_t_::~ur_event_handle_t_() {
@@ -133,33 +131,319 @@ ur_event_handle_t_::~ur_event_handle_t_() {
   }
 }
 
+void ur_event_handle_t_::reset(ur_queue_handle_t newQueue,
+                               ur_command_t newCommandType) {
+  _refCount = 1;
+  userRefCount.store(1, std::memory_order_relaxed);
+  queue = newQueue;
+  context = newQueue->getContext();
+  device = newQueue->getDevice();
+  command_type = newCommandType;
+  done = false;
+  running = false;
+  inlineIfReady = false;
+  pendingDependencies.store(1, std::memory_order_relaxed);
+  pendingTasks.store(0, std::memory_order_relaxed);
+  // A recorded timestamp is the whole point of the command, so it is taken
+  // even if the queue does not profile.
+  profiling = newQueue->isProfiling() ||
+              newCommandType == UR_COMMAND_TIMESTAMP_RECORDING_EXP;
+  timestamp_queued = profiling ? get_timestamp() : 0;
+  timestamp_submit = 0;
+  timestamp_start = 0;
+  timestamp_end = 0;
+  timestamp_complete = 0;
+  spans.clear();
+  batchHead = false;
+  batchNext = nullptr;
+}
+
+void ur_event_handle_t_::release() {
+  if (decrementReferenceCount() == 0) {
+    device->events.release(this);
+  }
+}
+
 void ur_event_handle_t_::wait() {
   std::unique_lock<std::mutex> lock(mutex);
-  if (done) {
-    return;
+  doneCondition.wait(lock, [this]() { return done; });
+}
+
+void ur_event_handle_t_::addDependency(ur_event_handle_t dep) {
+  pendingDependencies.fetch_add(1, std::memory_order_relaxed);
+  {
+    std::lock_guard<std::mutex> lock(dep->mutex);
+    if (!dep->done) {
+      dep->dependents.push_back(this);
+      return;
+    }
   }
-  for (auto &f : futures) {
-    f.wait();
+  pendingDependencies.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void ur_event_handle_t_::releaseDependency(bool onSubmittingThread) {
+  if (pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    start(onSubmittingThread);
   }
-  queue->removeEvent(this);
-  done = true;
-  // The callback may need to acquire the lock, so we unlock it here
-  lock.unlock();
+}
 
-  if (callback)
-    callback();
+void ur_event_handle_t_::begin() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    running = true;
+  }
+  if (profiling) {
+    timestamp_submit = get_timestamp();
+    spans.resize(tasks.size());
+  }
 }
 
-void ur_event_handle_t_::tick_start() {
-  if (!queue->isProfiling())
+void ur_event_handle_t_::start(bool onSubmittingThread) {
+  if (batchHead) {
+    auto launches = queue->closeBatch(this);
+    if (launches.size() > 1) {
+      startBatch(std::move(launches));
+      return;
+    }
+  }
+
+  begin();
+  const size_t numTasks = tasks.size();
+
+  if (onSubmittingThread && (inlineIfReady || tasks.empty())) {
+    for (size_t i = 0; i < numTasks; i++) {
+      runTask(i, 0);
+    }
+    complete();
+    return;
+  }
+
+  // Completing a command here would start its dependents on this stack, and
+  // a chain of them could nest deeply, so even a command without tasks goes
+  // through the thread pool.
+  auto &tp = queue->getDevice()->tp;
+  if (tasks.empty()) {
+    tp.schedule([this](size_t) { complete(); });
     return;
-  std::lock_guard<std::mutex> lock(mutex);
-  timestamp_start = get_timestamp();
+  }
+
+  // The last task may complete the command and clear the tasks before this
+  // loop ends, so it must not touch the vector after scheduling.
+  // Kernel launches give each task a contiguous slice of the work-groups.
+  // With pinned workers, the tasks are spread over the workers in blocks, so
+  // neighbouring slices stay on the same NUMA node.
+  const bool placeTasks = numTasks > 1 && tp.is_pinned();
+  const size_t numThreads = tp.num_threads();
+  pendingTasks.store(numTasks, std::memory_order_relaxed);
+  for (size_t i = 0; i < numTasks; i++) {
+    auto task = [this, i](size_t threadId) {
+      runTask(i, threadId);
+      if (pendingTasks.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        complete();
+      }
+    };
+    if (placeTasks) {
+      tp.schedule_on(i * numThreads / numTasks, std::move(task));
+    } else {
+      tp.schedule(std::move(task));
+    }
+  }
 }
 
-void ur_event_handle_t_::tick_end() {
-  if (!queue->isProfiling())
+void ur_event_handle_t_::runTask(size_t index, size_t threadId) {
+  if (!profiling) {
+    tasks[index](threadId);
     return;
-  std::lock_guard<std::mutex> lock(mutex);
-  timestamp_end = get_timestamp();
+  }
+  uint64_t taskStart = get_timestamp();
+  tasks[index](threadId);
+  spans[index] = {threadId, taskStart, get_timestamp()};
+}
+
+void ur_event_handle_t_::complete() {
+  tasks.clear();
+  if (profiling) {
+    // The command runs from the start of its first task to the end of its
+    // last one, a command without tasks takes no time.
+    timestamp_start = timestamp_end = timestamp_submit;
+    if (!spans.empty()) {
+      timestamp_start = spans[0].start;
+      for (const auto &span : spans) {
+        timestamp_start = std::min(timestamp_start, span.start);
+        timestamp_end = std::max(timestamp_end, span.end);
+        logger::debug("native_cpu: command {} ran on worker {} for {} ns",
+                      command_type, span.threadId, span.end - span.start);
+      }
+    }
+    if (command_type == UR_COMMAND_TIMESTAMP_RECORDING_EXP) {
+      timestamp_queued = timestamp_submit;
+    }
+    timestamp_complete = get_timestamp();
+  }
+
+  std::vector<ur_event_handle_t> ready;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    done = true;
+    running = false;
+    ready.swap(dependents);
+  }
+  doneCondition.notify_all();
+
+  for (auto dependent : ready) {
+    dependent->releaseDependency(false);
+  }
+
+  // Drops the reference the queue holds while the command is in flight, so
+  // this must come last.
+  queue->removeEvent(this);
+}
+
+namespace native_cpu {
+
+// Kernel launches of an in-order queue that run in one dispatch. Workers
+// claim the tasks of the current launch, and the worker finishing its last
+// task completes it and moves the batch on to the next launch, so the
+// launches stay ordered without waking the workers for each of them.
+//
+// Workers do not block on each other, since workers shared with other
+// batches could then wait for each other. A worker that finds nothing to
+// claim keeps yielding for a while, which covers the gap between short
+// launches, and then leaves the batch. Workers are added back when a launch
+// has more tasks than workers left, and the worker moving the batch on
+// always stays, so the batch cannot stall.
+struct launch_batch_t {
+  // Yields of a worker without a task to claim before it leaves the batch.
+  static constexpr unsigned maxIdleYields = 256;
+
+  threadpool_t &tp;
+  std::vector<ur_event_handle_t> launches;
+  // Taken when the batch starts, since a launch clears its tasks once it
+  // completes.
+  std::vector<size_t> numTasks;
+  // Index of the current launch in the upper half, index of the next task
+  // to claim in the lower half, so that a worker cannot claim a task of a
+  // launch that has moved on.
+  std::atomic<uint64_t> next{0};
+  // Tasks of the current launch that have not finished.
+  std::atomic<size_t> pendingTasks{0};
+  std::atomic<size_t> numWorkers{0};
+
+  launch_batch_t(threadpool_t &tp, std::vector<ur_event_handle_t> &&launches)
+      : tp(tp), launches(std::move(launches)) {
+    for (auto launch : this->launches) {
+      numTasks.push_back(launch->tasks.size());
+    }
+  }
+
+  // Schedules workers until the launch has as many as it has tasks.
+  static void addWorkers(const std::shared_ptr<launch_batch_t> &batch,
+                         size_t launch) {
+    const size_t wanted =
+        std::min(batch->numTasks[launch], batch->tp.num_threads());
+    while (batch->numWorkers.load(std::memory_order_acquire) < wanted) {
+      batch->numWorkers.fetch_add(1, std::memory_order_acq_rel);
+      batch->tp.schedule(
+          [batch](size_t threadId) { batch->runWorker(batch, threadId); });
+    }
+  }
+
+  void runWorker(const std::shared_ptr<launch_batch_t> &self,
+                 size_t threadId) {
+    constexpr uint64_t taskMask = 0xffffffff;
+    const size_t numLaunches = launches.size();
+    unsigned idleYields = 0;
+    while (true) {
+      uint64_t current = next.load(std::memory_order_acquire);
+      const size_t launch = current >> 32;
+      const size_t task = current & taskMask;
+      if (launch == numLaunches) {
+        break;
+      }
+      if (task >= numTasks[launch]) {
+        if (++idleYields > maxIdleYields) {
+          break;
+        }
+        std::this_thread::yield();
+        continue;
+      }
+      if (!next.compare_exchange_weak(current, current + 1,
+                                      std::memory_order_acq_rel)) {
+        continue;
+      }
+
+      idleYields = 0;
+      ur_event_handle_t event = launches[launch];
+      event->runTask(task, threadId);
+      if (pendingTasks.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        continue;
+      }
+      // The launch is complete before the next one starts, as it would be
+      // without batching.
+      event->complete();
+      if (launch + 1 < numLaunches) {
+        pendingTasks.store(numTasks[launch + 1], std::memory_order_relaxed);
+      }
+      next.store(uint64_t(launch + 1) << 32, std::memory_order_release);
+      if (launch + 1 < numLaunches) {
+        addWorkers(self, launch + 1);
+      }
+    }
+    numWorkers.fetch_sub(1, std::memory_order_acq_rel);
+  }
+};
+
+} // namespace native_cpu
+
+void ur_event_handle_t_::startBatch(
+    std::vector<ur_event_handle_t> &&launches) {
+  logger::debug("native_cpu: running {} kernel launches in one batch",
+                launches.size());
+  for (auto launch : launches) {
+    launch->begin();
+  }
+  auto batch = std::make_shared<native_cpu::launch_batch_t>(
+      queue->getDevice()->tp, std::move(launches));
+  batch->pendingTasks.store(batch->numTasks[0], std::memory_order_relaxed);
+  native_cpu::launch_batch_t::addWorkers(batch, 0);
+}
+
+native_cpu::event_pool_t::~event_pool_t() {
+  while (freeList) {
+    ur_event_handle_t event = freeList;
+    freeList = event->nextFree;
+    delete event;
+  }
+}
+
+ur_event_handle_t
+native_cpu::event_pool_t::acquire(ur_queue_handle_t queue,
+                                  ur_command_t command_type) {
+  ur_event_handle_t event = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (freeList) {
+      event = freeList;
+      freeList = event->nextFree;
+      numFree--;
+    }
+  }
+  if (!event) {
+    return new ur_event_handle_t_(queue, command_type);
+  }
+  event->reset(queue, command_type);
+  return event;
+}
+
+void native_cpu::event_pool_t::release(ur_event_handle_t event) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (numFree < maxFreeEvents) {
+      event->nextFree = freeList;
+      freeList = event;
+      numFree++;
+      return;
+    }
+  }
+  delete event;
 }
@@ -9,28 +9,46 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 #include "common.hpp"
+#include "threadpool.hpp"
 #include "ur_api.h"
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
-#include <future>
 #include <mutex>
 #include <vector>
 
+namespace native_cpu {
+class event_pool_t;
+struct launch_batch_t;
+
+// Execution of one task of a command on a worker thread.
+struct task_span_t {
+  size_t threadId;
+  uint64_t start;
+  uint64_t end;
+};
+} // namespace native_cpu
+
+// Every command is a node of a dependency graph, represented by its event.
+// A command starts once all the events it depends on have completed, and its
+// completion starts the commands depending on it, so no host thread blocks
+// on a wait list.
 struct ur_event_handle_t_ : RefCounted {
 
   ur_event_handle_t_(ur_queue_handle_t queue, ur_command_t command_type);
 
   ~ur_event_handle_t_();
 
-  void set_callback(const std::function<void()> &cb) { callback = cb; }
-
   void wait();
 
   uint32_t getExecutionStatus() {
-    // TODO: add support for UR_EVENT_STATUS_RUNNING
     std::lock_guard<std::mutex> lock(mutex);
     if (done) {
       return UR_EVENT_STATUS_COMPLETE;
     }
+    if (running) {
+      return UR_EVENT_STATUS_RUNNING;
+    }
     return UR_EVENT_STATUS_SUBMITTED;
   }
 
@@ -40,27 +58,151 @@ struct ur_event_handle_t_ : RefCounted {
 
   ur_command_t getCommandType() const { return command_type; }
 
-  void set_futures(std::vector<std::future<void>> &fs) {
-    std::lock_guard<std::mutex> lock(mutex);
-    futures = std::move(fs);
+  // Drops a reference, the last one returns the event to the pool of its
+  // device.
+  void release();
+
+  // References of the user to the handle, which urEventGetInfo reports. The
+  // references the queue and dependent commands hold internally vary with
+  // the progress of the commands, so they are not part of it.
+  void retainByUser() {
+    userRefCount.fetch_add(1, std::memory_order_relaxed);
+    incrementReferenceCount();
+  }
+  void releaseByUser() {
+    userRefCount.fetch_sub(1, std::memory_order_relaxed);
+    release();
+  }
+  uint32_t getUserReferenceCount() const {
+    return userRefCount.load(std::memory_order_relaxed);
   }
 
-  void tick_start();
+  // Sets the work of the command, before it is enqueued. Tasks run on the
+  // device thread pool and the command completes when its last task returns.
+  // With runInline, a command that is ready when it is enqueued runs on the
+  // submitting thread instead, which suits short host-side commands. A
+  // command without tasks only orders other commands.
+  void set_tasks(std::vector<native_cpu::worker_task_t> &&fs,
+                 bool runInline = false) {
+    tasks = std::move(fs);
+    inlineIfReady = runInline;
+  }
+
+  bool isProfiling() const { return profiling; }
+
+  uint64_t get_queued_timestamp() const { return timestamp_queued; }
 
-  void tick_end();
+  uint64_t get_submit_timestamp() const { return timestamp_submit; }
 
   uint64_t get_start_timestamp() const { return timestamp_start; }
 
   uint64_t get_end_timestamp() const { return timestamp_end; }
 
+  uint64_t get_complete_timestamp() const { return timestamp_complete; }
+
+  // When profiling, the execution span of each task of the command, valid
+  // once the command has completed.
+  const std::vector<native_cpu::task_span_t> &get_task_spans() const {
+    return spans;
+  }
+
 private:
+  friend struct ur_queue_handle_t_;
+  friend class native_cpu::event_pool_t;
+  friend struct native_cpu::launch_batch_t;
+
+  // Prepares a pooled event for a new command.
+  void reset(ur_queue_handle_t queue, ur_command_t command_type);
+
+  // Makes this event wait for dep, unless dep has already completed.
+  void addDependency(ur_event_handle_t dep);
+
+  // Called once per completed dependency, and once by the queue after all
+  // dependencies were added. The command starts when this reaches zero.
+  void releaseDependency(bool onSubmittingThread);
+
+  void start(bool onSubmittingThread);
+
+  // Marks the command as running, before its tasks are scheduled.
+  void begin();
+
+  // Runs the kernel launches batched behind this one, see
+  // native_cpu::launch_batch_t.
+  void startBatch(std::vector<ur_event_handle_t> &&launches);
+
+  // Runs a task, recording its execution span when profiling.
+  void runTask(size_t index, size_t threadId);
+
+  void complete();
+
   ur_queue_handle_t queue;
   ur_context_handle_t context;
+  // The queue may be released before its events, so the pool is found
+  // through the device.
+  ur_device_handle_t device;
   ur_command_t command_type;
   bool done;
+  bool running = false;
+  bool inlineIfReady = false;
   std::mutex mutex;
-  std::vector<std::future<void>> futures;
-  std::function<void()> callback;
+  std::condition_variable doneCondition;
+  std::vector<native_cpu::worker_task_t> tasks;
+  // Starts at one, for the reference returned to the user when the command
+  // is enqueued.
+  std::atomic<uint32_t> userRefCount{1};
+  // Starts at one so that the command cannot start while it is enqueued.
+  std::atomic<uint32_t> pendingDependencies{1};
+  std::atomic<size_t> pendingTasks{0};
+  // Commands waiting for this one, guarded by mutex.
+  std::vector<ur_event_handle_t> dependents;
+  // Timestamps are only taken when profiling, and are read once the command
+  // has completed.
+  bool profiling = false;
+  uint64_t timestamp_queued = 0;
+  uint64_t timestamp_submit = 0;
   uint64_t timestamp_start = 0;
   uint64_t timestamp_end = 0;
+  uint64_t timestamp_complete = 0;
+  std::vector<native_cpu::task_span_t> spans;
+  // Links of the list of commands in flight on the queue, guarded by the
+  // queue mutex.
+  ur_event_handle_t prevInFlight = nullptr;
+  ur_event_handle_t nextInFlight = nullptr;
+  // Set on the first kernel launch of a batch, which starts the launches
+  // enqueued behind it.
+  bool batchHead = false;
+  // Next kernel launch of the batch, guarded by the queue mutex until the
+  // batch has started.
+  ur_event_handle_t batchNext = nullptr;
+  // Link of the free list of the pool, guarded by the pool mutex.
+  ur_event_handle_t nextFree = nullptr;
 };
+
+namespace native_cpu {
+
+// Recycles the events of a device, so that enqueuing a command does not
+// allocate an event, its mutex and condition variable, or the storage of
+// its task and dependent vectors, which keep their capacity.
+class event_pool_t {
+public:
+  event_pool_t() = default;
+  event_pool_t(const event_pool_t &) = delete;
+  event_pool_t &operator=(const event_pool_t &) = delete;
+
+  ~event_pool_t();
+
+  ur_event_handle_t acquire(ur_queue_handle_t queue, ur_command_t command_type);
+
+  void release(ur_event_handle_t event);
+
+private:
+  // Events beyond this are freed, so a burst of commands does not pin its
+  // peak number of events.
+  static constexpr size_t maxFreeEvents = 1024;
+
+  std::mutex mutex;
+  ur_event_handle_t freeList = nullptr;
+  size_t numFree = 0;
+};
+
+} // namespace native_cpu
@@ -12,6 +12,7 @@
 #include "nativecpu_state.hpp"
 #include "program.hpp"
 #include <cstring>
+#include <memory>
 #include <ur_api.h>
 #include <utility>
 
@@ -26,6 +27,41 @@ struct local_arg_info_t {
       : argIndex(argIndex), argSize(argSize) {}
 };
 
+namespace native_cpu {
+
+// Everything a kernel launch reads from its kernel, copied when the launch is
+// enqueued. Launches run asynchronously, so they must not observe arguments
+// that are set after they were enqueued.
+struct kernel_launch_t {
+  nativecpu_task_t Subhandler;
+  std::vector<void *> Args;
+  std::vector<local_arg_info_t> LocalArgs;
+  size_t NumThreads = 1;
+  // Copies of the argument values, followed by the local memory of every
+  // thread.
+  char *Storage = nullptr;
+  char *LocalMem = nullptr;
+
+  kernel_launch_t() = default;
+  kernel_launch_t(const kernel_launch_t &) = delete;
+  kernel_launch_t &operator=(const kernel_launch_t &) = delete;
+  ~kernel_launch_t() { aligned_free(Storage); }
+
+  // Returns the arguments of the work groups executed by a thread, with the
+  // local arguments pointing to the local memory of that thread.
+  std::vector<void *> getArgs(size_t threadId) const {
+    std::vector<void *> args = Args;
+    size_t offset = 0;
+    for (auto &entry : LocalArgs) {
+      args[entry.argIndex] = LocalMem + offset + (entry.argSize * threadId);
+      offset += entry.argSize * NumThreads;
+    }
+    return args;
+  }
+};
+
+} // namespace native_cpu
+
 struct ur_kernel_handle_t_ : RefCounted {
 
   ur_kernel_handle_t_(ur_program_handle_t hProgram, const char *name,
@@ -35,15 +71,12 @@ struct ur_kernel_handle_t_ : RefCounted {
   ur_kernel_handle_t_(const ur_kernel_handle_t_ &other)
       : Args(other.Args), hProgram(other.hProgram), _name(other._name),
         _subhandler(other._subhandler), _localArgInfo(other._localArgInfo),
-        _localMemPool(other._localMemPool),
-        _localMemPoolSize(other._localMemPoolSize),
         ReqdWGSize(other.ReqdWGSize) {
     incrementReferenceCount();
   }
 
   ~ur_kernel_handle_t_() {
     if (decrementReferenceCount() == 0) {
-      free(_localMemPool);
       Args.deallocate();
     }
   }
@@ -128,30 +161,48 @@ struct ur_kernel_handle_t_ : RefCounted {
 
   std::optional<uint64_t> getMaxLinearWGSize() const { return MaxLinearWGSize; }
 
-  void updateMemPool(size_t numParallelThreads) {
-    // compute requested size.
-    size_t reqSize = 0;
+  // Copies the arguments and allocates local memory for numParallelThreads
+  // threads. The local arguments are consumed by the launch.
+  std::shared_ptr<native_cpu::kernel_launch_t>
+  makeLaunch(size_t numParallelThreads) {
+    constexpr size_t Align = arguments::MaxAlign;
+    auto alignUp = [](size_t Size) {
+      return (Size + Align - 1) & ~(Align - 1);
+    };
+
+    auto launch = std::make_shared<native_cpu::kernel_launch_t>();
+    launch->Subhandler = _subhandler;
+    launch->Args = Args.Indices;
+    launch->NumThreads = numParallelThreads;
+
+    size_t valuesSize = 0;
+    for (size_t I = 0; I < Args.Indices.size(); I++) {
+      if (Args.OwnsMem[I]) {
+        valuesSize += alignUp(Args.ParamSizes[I]);
+      }
+    }
+    size_t localSize = 0;
     for (auto &entry : _localArgInfo) {
-      reqSize += entry.argSize * numParallelThreads;
+      localSize += entry.argSize * numParallelThreads;
     }
-    if (reqSize == 0 || reqSize == _localMemPoolSize) {
-      return;
+    if (valuesSize + localSize == 0) {
+      return launch;
     }
-    // realloc handles nullptr case
-    _localMemPool = (char *)realloc(_localMemPool, reqSize);
-    _localMemPoolSize = reqSize;
-  }
 
-  // To be called before executing a work group
-  void handleLocalArgs(size_t numParallelThread, size_t threadId) {
-    // For each local argument we have size*numthreads
-    size_t offset = 0;
-    for (auto &entry : _localArgInfo) {
-      Args.Indices[entry.argIndex] =
-          _localMemPool + offset + (entry.argSize * threadId);
-      // update offset in the memory pool
-      offset += entry.argSize * numParallelThread;
+    launch->Storage = static_cast<char *>(
+        native_cpu::aligned_malloc(Align, alignUp(valuesSize + localSize)));
+    char *Ptr = launch->Storage;
+    for (size_t I = 0; I < Args.Indices.size(); I++) {
+      if (Args.OwnsMem[I]) {
+        std::memcpy(Ptr, Args.Indices[I], Args.ParamSizes[I]);
+        launch->Args[I] = Ptr;
+        Ptr += alignUp(Args.ParamSizes[I]);
+      }
     }
+    launch->LocalMem = Ptr;
+    launch->LocalArgs = std::move(_localArgInfo);
+    _localArgInfo.clear();
+    return launch;
   }
 
   const std::vector<void *> &getArgs() const { return Args.getIndices(); }
@@ -163,8 +214,6 @@ struct ur_kernel_handle_t_ : RefCounted {
   void addPtrArg(void *Ptr, size_t Index) { Args.addPtrArg(Index, Ptr); }
 
 private:
-  char *_localMemPool = nullptr;
-  size_t _localMemPoolSize = 0;
   std::optional<native_cpu::WGSize_t> ReqdWGSize = std::nullopt;
   std::optional<native_cpu::WGSize_t> MaxWGSize = std::nullopt;
   std::optional<uint64_t> MaxLinearWGSize = std::nullopt;
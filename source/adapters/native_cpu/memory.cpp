@@ -63,20 +63,28 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemBufferCreate(
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urMemRetain(ur_mem_handle_t hMem) {
-  std::ignore = hMem;
+  UR_ASSERT(hMem, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
-  DIE_NO_IMPLEMENTATION
+  hMem->incrementRefCount();
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urMemRelease(ur_mem_handle_t hMem) {
   UR_ASSERT(hMem, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
-  hMem->decrementRefCount();
-  if (hMem->_refCount > 0) {
+  if (hMem->decrementRefCount() > 0) {
     return UR_RESULT_SUCCESS;
   }
 
+  // A sub-buffer keeps its parent alive.
+  ur_mem_handle_t hParent = nullptr;
+  if (!hMem->isImage()) {
+    hParent = static_cast<_ur_buffer *>(hMem)->SubBuffer.Parent;
+  }
   delete hMem;
+  if (hParent) {
+    return urMemRelease(hParent);
+  }
   return UR_RESULT_SUCCESS;
 }
 
@@ -100,6 +108,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemBufferPartition(
   try {
     auto partitionedBuffer = new _ur_buffer(static_cast<_ur_buffer *>(hBuffer),
                                             pRegion->origin, pRegion->size);
+    hBuffer->incrementRefCount();
     *phMem = reinterpret_cast<ur_mem_handle_t>(partitionedBuffer);
   } catch (const std::bad_alloc &) {
     return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -22,12 +22,6 @@ struct ur_mem_handle_t_ : _ur_object {
       : _mem{static_cast<char *>(malloc(Size))}, _ownsMem{true},
         IsImage{_IsImage} {}
 
-  ur_mem_handle_t_(void *HostPtr, size_t Size, bool _IsImage)
-      : _mem{static_cast<char *>(malloc(Size))}, _ownsMem{true}, IsImage{
-                                                                     _IsImage} {
-    memcpy(_mem, HostPtr, Size);
-  }
-
   ur_mem_handle_t_(void *HostPtr, bool _IsImage)
       : _mem{static_cast<char *>(HostPtr)}, _ownsMem{false}, IsImage{_IsImage} {
   }
@@ -38,7 +32,9 @@ struct ur_mem_handle_t_ : _ur_object {
     }
   }
 
-  void decrementRefCount() noexcept { _refCount--; }
+  void incrementRefCount() noexcept { _refCount++; }
+  // Returns the reference count after the decrement.
+  uint32_t decrementRefCount() noexcept { return --_refCount; }
 
   // Method to get type of the derived object (image or buffer)
   bool isImage() const { return this->IsImage; }
@@ -55,10 +51,14 @@ struct _ur_buffer final : ur_mem_handle_t_ {
   // Buffer constructor
   _ur_buffer(ur_context_handle_t /* Context*/, void *HostPtr)
       : ur_mem_handle_t_(HostPtr, false) {}
-  _ur_buffer(ur_context_handle_t /* Context*/, void *HostPtr, size_t Size)
-      : ur_mem_handle_t_(HostPtr, Size, false) {}
-  _ur_buffer(ur_context_handle_t /* Context*/, size_t Size)
-      : ur_mem_handle_t_(Size, false) {}
+  _ur_buffer(ur_context_handle_t Context, void *HostPtr, size_t Size)
+      : ur_mem_handle_t_(Size, false) {
+    Context->_device->place_memory(_mem, HostPtr, Size);
+  }
+  _ur_buffer(ur_context_handle_t Context, size_t Size)
+      : ur_mem_handle_t_(Size, false) {
+    Context->_device->place_memory(_mem, nullptr, Size);
+  }
   _ur_buffer(_ur_buffer *b, size_t Offset, size_t Size)
       : ur_mem_handle_t_(b->_mem + Offset, false), SubBuffer(b) {
     std::ignore = Size;
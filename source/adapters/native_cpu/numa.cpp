@@ -0,0 +1,173 @@
+//===----------- numa.cpp - Native CPU Adapter ----------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "numa.hpp"
+#include "common.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace native_cpu {
+namespace numa {
+
+std::vector<unsigned> topology_t::cpus() const {
+  std::vector<unsigned> result;
+  for (const auto &node : nodes) {
+    result.insert(result.end(), node.begin(), node.end());
+  }
+  return result;
+}
+
+int topology_t::node_of(int cpu) const {
+  for (size_t node = 0; node < nodes.size(); node++) {
+    for (unsigned nodeCpu : nodes[node]) {
+      if (int(nodeCpu) == cpu) {
+        return int(node);
+      }
+    }
+  }
+  return -1;
+}
+
+#ifdef __linux__
+// Parses a sysfs CPU list such as "0-3,8-11".
+static std::vector<unsigned> parseCpuList(const std::string &list) {
+  std::vector<unsigned> cpus;
+  std::stringstream stream(list);
+  std::string range;
+  while (std::getline(stream, range, ',')) {
+    if (range.empty() || range == "\n") {
+      continue;
+    }
+    auto dash = range.find('-');
+    unsigned first = std::stoul(range.substr(0, dash));
+    unsigned last =
+        dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+    for (unsigned cpu = first; cpu <= last; cpu++) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+static topology_t readTopology() {
+  topology_t topology;
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  bool haveMask = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+  auto isAllowed = [&](unsigned cpu) {
+    return !haveMask || (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed));
+  };
+
+  // Node ids may have gaps, so stop only after a run of missing nodes.
+  for (unsigned node = 0, missing = 0; missing < 64; node++) {
+    std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) +
+                       "/cpulist");
+    std::string list;
+    if (!file || !std::getline(file, list)) {
+      missing++;
+      continue;
+    }
+    missing = 0;
+    std::vector<unsigned> cpus;
+    for (unsigned cpu : parseCpuList(list)) {
+      if (isAllowed(cpu)) {
+        cpus.push_back(cpu);
+      }
+    }
+    if (!cpus.empty()) {
+      topology.nodes.push_back(std::move(cpus));
+    }
+  }
+
+  if (topology.nodes.empty() && haveMask) {
+    std::vector<unsigned> cpus;
+    for (unsigned cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+      if (CPU_ISSET(cpu, &allowed)) {
+        cpus.push_back(cpu);
+      }
+    }
+    topology.nodes.push_back(std::move(cpus));
+  }
+  return topology;
+}
+
+bool pin_current_thread(unsigned cpu) {
+  if (cpu >= CPU_SETSIZE) {
+    return false;
+  }
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+#else
+static topology_t readTopology() {
+  topology_t topology;
+  std::vector<unsigned> cpus;
+  for (unsigned cpu = 0; cpu < std::thread::hardware_concurrency(); cpu++) {
+    cpus.push_back(cpu);
+  }
+  topology.nodes.push_back(std::move(cpus));
+  return topology;
+}
+
+bool pin_current_thread(unsigned cpu) {
+  std::ignore = cpu;
+  return false;
+}
+#endif
+
+const topology_t &get_topology() {
+  static const topology_t topology = readTopology();
+  return topology;
+}
+
+bool pin_threads_enabled() {
+  static const bool enabled = [] {
+    const char *envVar = std::getenv("SYCL_NATIVE_CPU_PIN_THREADS");
+    return envVar && std::string(envVar) != "0";
+  }();
+  return enabled;
+}
+
+placement_t get_placement() {
+  static const placement_t placement = [] {
+    const char *envVar = std::getenv("SYCL_NATIVE_CPU_MEM_PLACEMENT");
+    if (!envVar) {
+      return placement_t::none;
+    }
+    std::string value(envVar);
+    if (value == "local") {
+      return placement_t::local;
+    }
+    if (value == "first_touch") {
+      return placement_t::first_touch;
+    }
+    if (value != "none") {
+      logger::warning("Unknown SYCL_NATIVE_CPU_MEM_PLACEMENT value {}, "
+                      "expected none, local or first_touch",
+                      value);
+    }
+    return placement_t::none;
+  }();
+  return placement;
+}
+
+} // namespace numa
+} // namespace native_cpu
@@ -0,0 +1,57 @@
+//===----------- numa.hpp - Native CPU Adapter ----------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace native_cpu {
+namespace numa {
+
+// CPUs the process may run on, grouped by NUMA node. Systems without NUMA
+// information report a single node.
+struct topology_t {
+  std::vector<std::vector<unsigned>> nodes;
+
+  // CPUs ordered node by node, so that consecutive entries share a node.
+  std::vector<unsigned> cpus() const;
+
+  // Index in nodes of the node of a CPU, -1 if the CPU is not known.
+  int node_of(int cpu) const;
+};
+
+const topology_t &get_topology();
+
+// Pins the calling thread to a CPU, returns false if that is not supported
+// on this platform or failed.
+bool pin_current_thread(unsigned cpu);
+
+// Whether the workers of the thread pool are pinned, from
+// SYCL_NATIVE_CPU_PIN_THREADS.
+bool pin_threads_enabled();
+
+// Where the pages of device allocations are placed, from
+// SYCL_NATIVE_CPU_MEM_PLACEMENT.
+enum class placement_t {
+  // Pages are placed wherever they are touched first.
+  none,
+  // Pages are touched by the allocating thread, which places them on its
+  // node.
+  local,
+  // Each worker touches the slice of the allocation that a kernel launch
+  // assigns to it, so with pinned workers its pages end up on the worker's
+  // node.
+  first_touch,
+};
+
+placement_t get_placement();
+
+} // namespace numa
+} // namespace native_cpu
@@ -12,18 +12,47 @@
 #include "common.hpp"
 #include "context.hpp"
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 UR_APIEXPORT ur_result_t UR_APICALL urPhysicalMemCreate(
-    ur_context_handle_t, ur_device_handle_t, size_t,
-    const ur_physical_mem_properties_t *, ur_physical_mem_handle_t *) {
+    ur_context_handle_t hContext, ur_device_handle_t hDevice, size_t size,
+    const ur_physical_mem_properties_t *pProperties,
+    ur_physical_mem_handle_t *phPhysicalMem) {
+  std::ignore = pProperties;
+  UR_ASSERT(hContext && hDevice, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(phPhysicalMem, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+#ifdef __linux__
+  UR_ASSERT(size && size % native_cpu::get_page_size() == 0,
+            UR_RESULT_ERROR_INVALID_SIZE);
+
+  int Fd = memfd_create("ur_native_cpu_physical_mem", MFD_CLOEXEC);
+  if (Fd < 0) {
+    return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+  }
+  if (ftruncate(Fd, size) != 0) {
+    close(Fd);
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  *phPhysicalMem = new ur_physical_mem_handle_t_(Fd, size, hContext, hDevice);
+  return UR_RESULT_SUCCESS;
+#else
+  std::ignore = size;
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+#endif
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
-urPhysicalMemRetain(ur_physical_mem_handle_t) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+urPhysicalMemRetain(ur_physical_mem_handle_t hPhysicalMem) {
+  UR_ASSERT(hPhysicalMem, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  hPhysicalMem->incrementReferenceCount();
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
-urPhysicalMemRelease(ur_physical_mem_handle_t) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+urPhysicalMemRelease(ur_physical_mem_handle_t hPhysicalMem) {
+  UR_ASSERT(hPhysicalMem, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  decrementOrDelete(hPhysicalMem);
+  return UR_RESULT_SUCCESS;
 }
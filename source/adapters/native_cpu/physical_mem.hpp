@@ -9,8 +9,38 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
-/// UR queue mapping on physical memory allocations used in virtual memory
-/// management.
-/// TODO: Implement.
+#include "common.hpp"
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+namespace native_cpu {
+#ifdef __linux__
+// Granularity of virtual memory reservations, mappings and physical memory.
+inline size_t get_page_size() {
+  static const size_t PageSize = sysconf(_SC_PAGESIZE);
+  return PageSize;
+}
+#endif
+} // namespace native_cpu
+
+/// Physical memory that virtual memory ranges are mapped to. On Linux it is
+/// an anonymous memory file, so that several ranges can map the same pages.
 ///
-struct ur_physical_mem_handle_t_ {};
+struct ur_physical_mem_handle_t_ : RefCounted {
+  ur_physical_mem_handle_t_(int Fd, size_t Size, ur_context_handle_t Context,
+                            ur_device_handle_t Device)
+      : Fd(Fd), Size(Size), Context(Context), Device(Device) {}
+
+  ~ur_physical_mem_handle_t_() {
+#ifdef __linux__
+    close(Fd);
+#endif
+  }
+
+  const int Fd;
+  const size_t Size;
+  const ur_context_handle_t Context;
+  const ur_device_handle_t Device;
+};
@@ -10,6 +10,8 @@
 
 #include "queue.hpp"
 #include "common.hpp"
+#include "device.hpp"
+#include "event.hpp"
 
 #include "ur/ur.hpp"
 #include "ur_api.h"
@@ -85,3 +87,130 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueFlush(ur_queue_handle_t hQueue) {
 
   DIE_NO_IMPLEMENTATION;
 }
+
+ur_event_handle_t ur_queue_handle_t_::createEvent(ur_command_t command_type) {
+  return device->events.acquire(this, command_type);
+}
+
+void ur_queue_handle_t_::enqueue(ur_event_handle_t event,
+                                 uint32_t numEventsInWaitList,
+                                 const ur_event_handle_t *phEventWaitList,
+                                 uint32_t flags) {
+  // A launch only joins a batch if nothing but the previous launch is left
+  // to wait for.
+  bool batchable = inOrder && (flags & ENQUEUE_FLAG_BATCHABLE);
+  for (uint32_t i = 0; batchable && i < numEventsInWaitList; i++) {
+    batchable = phEventWaitList[i]->getExecutionStatus() ==
+                UR_EVENT_STATUS_COMPLETE;
+  }
+
+  // Implicit dependencies are retained until their edge is added, since a
+  // command in flight may complete at any time.
+  std::vector<ur_event_handle_t> implicitDeps;
+  ur_event_handle_t replacedBarrier = nullptr;
+  ur_event_handle_t replacedLast = nullptr;
+  bool batched = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (inOrder) {
+      if (batchable && openBatch && lastEvent == openBatchTail) {
+        // Started by the first launch of the batch, so its dependency count
+        // is never released.
+        openBatchTail->batchNext = event;
+        openBatchTail = event;
+        replacedLast = lastEvent;
+        batched = true;
+      } else {
+        if (lastEvent) {
+          implicitDeps.push_back(lastEvent);
+        }
+        event->batchHead = batchable;
+        openBatch = openBatchTail = batchable ? event : nullptr;
+      }
+      event->incrementReferenceCount();
+      lastEvent = event;
+    } else {
+      if ((flags & ENQUEUE_FLAG_WAIT_FOR_ALL) && numEventsInWaitList == 0) {
+        for (auto dep = inFlight; dep; dep = dep->nextInFlight) {
+          dep->incrementReferenceCount();
+          implicitDeps.push_back(dep);
+        }
+      } else if (lastBarrier) {
+        lastBarrier->incrementReferenceCount();
+        implicitDeps.push_back(lastBarrier);
+      }
+      if (flags & ENQUEUE_FLAG_BARRIER) {
+        event->incrementReferenceCount();
+        replacedBarrier = lastBarrier;
+        lastBarrier = event;
+      }
+    }
+    event->incrementReferenceCount();
+    event->prevInFlight = nullptr;
+    event->nextInFlight = inFlight;
+    if (inFlight) {
+      inFlight->prevInFlight = event;
+    }
+    inFlight = event;
+  }
+
+  if (batched) {
+    replacedLast->release();
+    return;
+  }
+  for (uint32_t i = 0; i < numEventsInWaitList; i++) {
+    event->addDependency(phEventWaitList[i]);
+  }
+  for (auto dep : implicitDeps) {
+    event->addDependency(dep);
+    dep->release();
+  }
+  if (replacedBarrier) {
+    replacedBarrier->release();
+  }
+
+  event->releaseDependency(true);
+}
+
+void ur_queue_handle_t_::removeEvent(ur_event_handle_t event) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (event->prevInFlight) {
+      event->prevInFlight->nextInFlight = event->nextInFlight;
+    } else {
+      inFlight = event->nextInFlight;
+    }
+    if (event->nextInFlight) {
+      event->nextInFlight->prevInFlight = event->prevInFlight;
+    }
+    event->prevInFlight = nullptr;
+    event->nextInFlight = nullptr;
+    if (!inFlight) {
+      idle.notify_all();
+    }
+  }
+  event->release();
+}
+
+std::vector<ur_event_handle_t>
+ur_queue_handle_t_::closeBatch(ur_event_handle_t head) {
+  std::lock_guard<std::mutex> lock(mutex);
+  if (openBatch == head) {
+    openBatch = openBatchTail = nullptr;
+  }
+  std::vector<ur_event_handle_t> launches;
+  for (auto launch = head; launch; launch = launch->batchNext) {
+    launches.push_back(launch);
+  }
+  return launches;
+}
+
+ur_queue_handle_t_::~ur_queue_handle_t_() {
+  finish();
+  if (lastEvent) {
+    lastEvent->release();
+  }
+  if (lastBarrier) {
+    lastBarrier->release();
+  }
+}
@@ -11,7 +11,9 @@
 #include "common.hpp"
 #include "event.hpp"
 #include "ur_api.h"
-#include <set>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
 
 struct ur_queue_handle_t_ : RefCounted {
   ur_queue_handle_t_(ur_device_handle_t device, ur_context_handle_t context,
@@ -27,21 +29,41 @@ struct ur_queue_handle_t_ : RefCounted {
 
   ur_context_handle_t getContext() const { return context; }
 
-  void addEvent(ur_event_handle_t event) { events.insert(event); }
+  // Takes an event for a new command from the pool of the device.
+  ur_event_handle_t createEvent(ur_command_t command_type);
 
-  void removeEvent(ur_event_handle_t event) { events.erase(event); }
+  // Flags of the commands that order the other commands of an out-of-order
+  // queue, an in-order queue is ordered anyway.
+  enum enqueue_flags_t : uint32_t {
+    // With an empty wait list, waits for every command in flight.
+    ENQUEUE_FLAG_WAIT_FOR_ALL = 1,
+    // Later commands wait for this one.
+    ENQUEUE_FLAG_BARRIER = 2,
+    // A kernel launch, which an in-order queue may run in one dispatch with
+    // the launches enqueued right after it.
+    ENQUEUE_FLAG_BATCHABLE = 4,
+  };
+
+  // Adds a command to the dependency graph, its tasks must be set already.
+  // Besides the wait list, a command waits for the previous command of an
+  // in-order queue, or the last barrier of an out-of-order queue. The queue
+  // holds a reference to the event until the command completes.
+  void enqueue(ur_event_handle_t event, uint32_t numEventsInWaitList,
+               const ur_event_handle_t *phEventWaitList, uint32_t flags = 0);
+
+  // Called by a command when it completes.
+  void removeEvent(ur_event_handle_t event);
+
+  // Called by the first kernel launch of a batch when it starts, closes the
+  // batch and returns its launches in order.
+  std::vector<ur_event_handle_t> closeBatch(ur_event_handle_t head);
 
   void finish() {
-    while (!events.empty()) {
-      auto ev = *events.begin();
-      // ur_event_handle_t_::wait removes itself from the events set in the
-      // queue
-      ev->wait();
-    }
-    events.clear();
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this]() { return inFlight == nullptr; });
   }
 
-  ~ur_queue_handle_t_() { finish(); }
+  ~ur_queue_handle_t_();
 
   bool isInOrder() const { return inOrder; }
 
@@ -50,7 +72,18 @@ struct ur_queue_handle_t_ : RefCounted {
 private:
   ur_device_handle_t device;
   ur_context_handle_t context;
-  std::set<ur_event_handle_t> events;
+  std::mutex mutex;
+  std::condition_variable idle;
+  // Intrusive list of the commands in flight, most recent first.
+  ur_event_handle_t inFlight = nullptr;
+  ur_event_handle_t lastEvent = nullptr;
+  ur_event_handle_t lastBarrier = nullptr;
+  // The kernel launches of an in-order queue that are enqueued while the
+  // previous one waits for its dependencies are batched behind it, so that
+  // back-to-back launches cost one dispatch to the workers. The batch is
+  // open until its first launch starts.
+  ur_event_handle_t openBatch = nullptr;
+  ur_event_handle_t openBatchTail = nullptr;
   const bool inOrder;
   const bool profilingEnabled;
 };
@@ -11,7 +11,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstdlib>
-#include <forward_list>
+#include <deque>
 #include <functional>
 #include <future>
 #include <iterator>
@@ -22,6 +22,8 @@
 #include <thread>
 #include <vector>
 
+#include "numa.hpp"
+
 namespace native_cpu {
 
 using worker_task_t = std::function<void(size_t)>;
@@ -30,14 +32,18 @@ namespace detail {
 
 class worker_thread {
 public:
-  // Initializes state, but does not start the worker thread
-  worker_thread(size_t threadId) noexcept
-      : m_threadId(threadId), m_isRunning(false), m_numTasks(0) {
+  // Initializes state, but does not start the worker thread. The worker is
+  // associated with a cpu, and pinned to it if requested.
+  worker_thread(size_t threadId, int cpu = -1, bool pin = false) noexcept
+      : m_threadId(threadId), m_cpu(cpu), m_isRunning(false), m_numTasks(0) {
     std::lock_guard<std::mutex> lock(m_workMutex);
     if (this->is_running()) {
       return;
     }
-    m_worker = std::thread([this]() {
+    m_worker = std::thread([this, pin]() {
+      if (pin && m_cpu >= 0) {
+        numa::pin_current_thread(static_cast<unsigned>(m_cpu));
+      }
       while (true) {
         std::unique_lock<std::mutex> lock(m_workMutex);
         // Wait until there's work available
@@ -97,10 +103,16 @@ public:
     return m_isRunning.load(std::memory_order_acquire);
   }
 
+  // The CPU associated with the worker, which it only runs on if pinned, -1
+  // if unknown
+  int cpu() const noexcept { return m_cpu; }
+
 private:
   // Unique ID identifying the thread in the threadpool
   const size_t m_threadId;
 
+  const int m_cpu;
+
   std::thread m_worker;
 
   std::mutex m_workMutex;
@@ -118,12 +130,34 @@ private:
 // ready at construction. This class mainly holds the interface for
 // scheduling a task to the most appropriate thread and handling input
 // parameters and futures.
+//
+// A pool can also be a slice of the workers of another pool, which keeps
+// owning them. Tasks scheduled on a slice receive their worker's index in
+// the slice as thread id, so per-thread data sized by num_threads() works
+// the same on a slice as on a whole pool.
 class simple_thread_pool {
 public:
   simple_thread_pool() noexcept
-      : m_isRunning(false), m_numThreads(get_num_threads()) {
+      : m_isRunning(false), m_numThreads(get_num_threads()),
+        m_pinned(numa::pin_threads_enabled()) {
+    // Workers take the CPUs node by node, so workers with consecutive ids
+    // share a node.
+    std::vector<unsigned> cpus = numa::get_topology().cpus();
+    m_pinned = m_pinned && !cpus.empty();
     for (size_t i = 0; i < m_numThreads; i++) {
-      m_workers.emplace_front(i);
+      int cpu = cpus.empty() ? -1 : int(cpus[i % cpus.size()]);
+      m_slice.push_back(&m_workers.emplace_back(i, cpu, m_pinned));
+    }
+    m_isRunning.store(true, std::memory_order_release);
+  }
+
+  // A slice made of the given workers of parent, which must outlive it.
+  simple_thread_pool(simple_thread_pool &parent,
+                     const std::vector<size_t> &threadIds) noexcept
+      : m_isRunning(false), m_numThreads(threadIds.size()),
+        m_pinned(parent.m_pinned), m_isSlice(true) {
+    for (size_t threadId : threadIds) {
+      m_slice.push_back(parent.m_slice[threadId]);
     }
     m_isRunning.store(true, std::memory_order_release);
   }
@@ -137,7 +171,26 @@ public:
 
   inline void schedule(const worker_task_t &task) {
     // Schedule the task on the best available worker thread
-    this->best_worker().schedule(task);
+    schedule_on(this->best_worker(), task);
+  }
+
+  // Schedules the task on a given worker, for work that is split so that
+  // neighbouring slices should run on the same NUMA node.
+  inline void schedule_on(size_t threadId, const worker_task_t &task) {
+    threadId %= m_numThreads;
+    if (m_isSlice) {
+      m_slice[threadId]->schedule(
+          [task, threadId](size_t) { task(threadId); });
+    } else {
+      m_slice[threadId]->schedule(task);
+    }
+  }
+
+  inline bool is_pinned() const noexcept { return m_pinned; }
+
+  // The CPU associated with a worker, -1 if unknown
+  inline int cpu_of(size_t threadId) const noexcept {
+    return m_slice[threadId]->cpu();
   }
 
   inline bool is_running() const noexcept {
@@ -147,10 +200,9 @@ public:
   inline size_t num_threads() const noexcept { return m_numThreads; }
 
   inline size_t num_pending_tasks() const noexcept {
-    return std::accumulate(std::begin(m_workers), std::end(m_workers),
-                           size_t(0),
-                           [](size_t numTasks, const worker_thread &t) {
-                             return (numTasks + t.num_pending_tasks());
+    return std::accumulate(std::begin(m_slice), std::end(m_slice), size_t(0),
+                           [](size_t numTasks, const worker_thread *t) {
+                             return (numTasks + t->num_pending_tasks());
                            });
   }
 
@@ -163,14 +215,15 @@ public:
 protected:
   // Determines which thread is the most appropriate for having work
   // scheduled
-  worker_thread &best_worker() noexcept {
-    return *std::min_element(
-        std::begin(m_workers), std::end(m_workers),
-        [](const worker_thread &w1, const worker_thread &w2) {
+  size_t best_worker() noexcept {
+    auto best = std::min_element(
+        std::begin(m_slice), std::end(m_slice),
+        [](const worker_thread *w1, const worker_thread *w2) {
           // Prefer threads whose task queues are shorter
           // This is just an approximation, it doesn't need to be exact
-          return (w1.num_pending_tasks() < w2.num_pending_tasks());
+          return (w1->num_pending_tasks() < w2->num_pending_tasks());
         });
+    return static_cast<size_t>(std::distance(std::begin(m_slice), best));
   }
 
 private:
@@ -185,11 +238,20 @@ private:
     return numThreads;
   }
 
-  std::forward_list<worker_thread> m_workers;
+  // The workers owned by this pool, empty for a slice. A deque, since
+  // workers cannot be moved once their thread has started.
+  std::deque<worker_thread> m_workers;
+
+  // The workers tasks are scheduled on.
+  std::vector<worker_thread *> m_slice;
 
   std::atomic<bool> m_isRunning;
 
   const size_t m_numThreads;
+
+  bool m_pinned;
+
+  const bool m_isSlice = false;
 };
 } // namespace detail
 
@@ -201,12 +263,41 @@ public:
 
   threadpool_interface() : threadpool() {}
 
+  // A thread pool made of some of the workers of parent.
+  threadpool_interface(threadpool_interface &parent,
+                       const std::vector<size_t> &threadIds)
+      : threadpool(parent.threadpool, threadIds) {}
+
+  int cpu_of(size_t threadId) const noexcept {
+    return threadpool.cpu_of(threadId);
+  }
+
   auto schedule_task(worker_task_t &&task) {
     auto workerTask = std::make_shared<std::packaged_task<void(size_t)>>(
         [task](auto &&PH1) { return task(std::forward<decltype(PH1)>(PH1)); });
     threadpool.schedule([=](size_t threadId) { (*workerTask)(threadId); });
     return workerTask->get_future();
   }
+
+  // Schedules a task without a future, for callers that track the completion
+  // of their tasks themselves.
+  void schedule(worker_task_t &&task) { threadpool.schedule(task); }
+
+  void schedule_on(size_t threadId, worker_task_t &&task) {
+    threadpool.schedule_on(threadId, task);
+  }
+
+  auto schedule_task_on(size_t threadId, worker_task_t &&task) {
+    auto workerTask =
+        std::make_shared<std::packaged_task<void(size_t)>>(std::move(task));
+    threadpool.schedule_on(
+        threadId, [=](size_t workerId) { (*workerTask)(workerId); });
+    return workerTask->get_future();
+  }
+
+  // Whether workers are pinned, in which case work split into slices should
+  // be scheduled on consecutive workers.
+  bool is_pinned() const noexcept { return threadpool.is_pinned(); }
 };
 
 using threadpool_t = threadpool_interface<detail::simple_thread_pool>;
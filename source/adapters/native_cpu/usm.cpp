@@ -32,6 +32,10 @@ static ur_result_t alloc_helper(ur_context_handle_t hContext,
 
   auto *ptr = hContext->add_alloc(alignment, type, size, nullptr);
   UR_ASSERT(ptr != nullptr, UR_RESULT_ERROR_OUT_OF_RESOURCES);
+  // Host allocations are left to be placed by the host threads using them.
+  if (type != UR_USM_TYPE_HOST) {
+    hContext->_device->place_memory(ptr, nullptr, size);
+  }
   *ppMem = ptr;
 
   return UR_RESULT_SUCCESS;
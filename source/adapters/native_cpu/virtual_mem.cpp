@@ -12,43 +12,167 @@
 #include "context.hpp"
 #include "physical_mem.hpp"
 
+#ifdef __linux__
+#include <sys/mman.h>
+
+// Virtual memory is reserved as inaccessible anonymous pages, and mapping a
+// range replaces its pages with those of the physical memory file. Unmapping
+// puts inaccessible pages back, so the range stays reserved until it is
+// freed.
+namespace {
+int getProtection(ur_virtual_mem_access_flags_t flags) {
+  if (flags & UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE) {
+    return PROT_READ | PROT_WRITE;
+  }
+  if (flags & UR_VIRTUAL_MEM_ACCESS_FLAG_READ_ONLY) {
+    return PROT_READ;
+  }
+  return PROT_NONE;
+}
+
+void *mapReserved(const void *pStart, size_t size, int flags) {
+  return mmap(const_cast<void *>(pStart), size, PROT_NONE,
+              MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | flags, -1, 0);
+}
+} // namespace
+#endif
+
 UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
-    ur_context_handle_t, ur_device_handle_t, ur_virtual_mem_granularity_info_t,
-    size_t, void *, size_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_context_handle_t hContext, ur_device_handle_t hDevice,
+    ur_virtual_mem_granularity_info_t propName, size_t propSize,
+    void *pPropValue, size_t *pPropSizeRet) {
+  std::ignore = hDevice;
+  UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+
+  switch (propName) {
+#ifdef __linux__
+  case UR_VIRTUAL_MEM_GRANULARITY_INFO_MINIMUM:
+  case UR_VIRTUAL_MEM_GRANULARITY_INFO_RECOMMENDED:
+    return ReturnValue(native_cpu::get_page_size());
+#endif
+  default:
+    return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+  }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemReserve(ur_context_handle_t,
-                                                        const void *, size_t,
-                                                        void **) {
+UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemReserve(
+    ur_context_handle_t hContext, const void *pStart, size_t size,
+    void **ppStart) {
+  UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(ppStart, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+#ifdef __linux__
+  // pStart is only a hint, the kernel picks another address if it is taken.
+  void *Ptr = mapReserved(pStart, size, 0);
+  if (Ptr == MAP_FAILED) {
+    return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+  }
+  *ppStart = Ptr;
+  return UR_RESULT_SUCCESS;
+#else
+  std::ignore = pStart;
+  std::ignore = size;
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+#endif
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemFree(ur_context_handle_t,
-                                                     const void *, size_t) {
+UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemFree(
+    ur_context_handle_t hContext, const void *pStart, size_t size) {
+  UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pStart, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+#ifdef __linux__
+  if (munmap(const_cast<void *>(pStart), size) != 0) {
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+  hContext->unmap_virtual_range(pStart, size);
+  return UR_RESULT_SUCCESS;
+#else
+  std::ignore = size;
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+#endif
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemSetAccess(
-    ur_context_handle_t, const void *, size_t, ur_virtual_mem_access_flags_t) {
+UR_APIEXPORT ur_result_t UR_APICALL
+urVirtualMemSetAccess(ur_context_handle_t hContext, const void *pStart,
+                      size_t size, ur_virtual_mem_access_flags_t flags) {
+  UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pStart, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(!(flags & UR_VIRTUAL_MEM_ACCESS_FLAGS_MASK),
+            UR_RESULT_ERROR_INVALID_ENUMERATION);
+#ifdef __linux__
+  if (mprotect(const_cast<void *>(pStart), size, getProtection(flags)) != 0) {
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+  hContext->set_virtual_access(pStart, size, flags);
+  return UR_RESULT_SUCCESS;
+#else
+  std::ignore = size;
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+#endif
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemMap(
-    ur_context_handle_t, const void *, size_t, ur_physical_mem_handle_t, size_t,
-    ur_virtual_mem_access_flags_t) {
+UR_APIEXPORT ur_result_t UR_APICALL
+urVirtualMemMap(ur_context_handle_t hContext, const void *pStart, size_t size,
+                ur_physical_mem_handle_t hPhysicalMem, size_t offset,
+                ur_virtual_mem_access_flags_t flags) {
+  UR_ASSERT(hContext && hPhysicalMem, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pStart, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(!(flags & UR_VIRTUAL_MEM_ACCESS_FLAGS_MASK),
+            UR_RESULT_ERROR_INVALID_ENUMERATION);
+#ifdef __linux__
+  // Like the size of physical memory, the offset has to be a multiple of the
+  // granularity, which mmap also requires of it.
+  UR_ASSERT(offset % native_cpu::get_page_size() == 0,
+            UR_RESULT_ERROR_INVALID_SIZE);
+  // Pages past the end of the file would fault on access instead of failing
+  // here.
+  UR_ASSERT(offset <= hPhysicalMem->Size &&
+                size <= hPhysicalMem->Size - offset,
+            UR_RESULT_ERROR_INVALID_SIZE);
+
+  void *Ptr = mmap(const_cast<void *>(pStart), size, getProtection(flags),
+                   MAP_SHARED | MAP_FIXED, hPhysicalMem->Fd, offset);
+  if (Ptr == MAP_FAILED) {
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+  hContext->map_virtual_range(pStart, size, flags);
+  return UR_RESULT_SUCCESS;
+#else
+  std::ignore = size;
+  std::ignore = offset;
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+#endif
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemUnmap(ur_context_handle_t,
-                                                      const void *, size_t) {
+UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemUnmap(
+    ur_context_handle_t hContext, const void *pStart, size_t size) {
+  UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pStart, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+#ifdef __linux__
+  if (mapReserved(pStart, size, MAP_FIXED) == MAP_FAILED) {
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+  hContext->unmap_virtual_range(pStart, size);
+  return UR_RESULT_SUCCESS;
+#else
+  std::ignore = size;
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+#endif
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemGetInfo(ur_context_handle_t,
-                                                        const void *, size_t,
-                                                        ur_virtual_mem_info_t,
-                                                        size_t, void *,
-                                                        size_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemGetInfo(
+    ur_context_handle_t hContext, const void *pStart, size_t size,
+    ur_virtual_mem_info_t propName, size_t propSize, void *pPropValue,
+    size_t *pPropSizeRet) {
+  std::ignore = size;
+  UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pStart, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+
+  switch (propName) {
+  case UR_VIRTUAL_MEM_INFO_ACCESS_MODE:
+    return ReturnValue(hContext->get_virtual_access(pStart));
+  default:
+    return UR_RESULT_ERROR_INVALID_ENUMERATION;
+  }
 }
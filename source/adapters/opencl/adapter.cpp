@@ -103,6 +103,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urAdapterRelease(ur_adapter_handle_t) {
         delete cl_ext::ExtFuncPtrCache;
         cl_ext::ExtFuncPtrCache = nullptr;
       }
+      urLockStatsReport();
     }
   }
   return UR_RESULT_SUCCESS;
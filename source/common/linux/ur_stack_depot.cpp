@@ -0,0 +1,59 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <stdlib.h>
+
+#include "ur_stack_depot.hpp"
+
+namespace stack_depot {
+
+__attribute__((noinline)) stack_id_t capture(size_t skip) {
+    void *frames[max_frames + 1];
+    int count = backtrace(frames, static_cast<int>(max_frames + 1));
+    // Drop the frame of capture() itself.
+    size_t first = skip + 1;
+    if (count <= 0 || static_cast<size_t>(count) <= first) {
+        return invalid_stack_id;
+    }
+    return put(frames + first, static_cast<size_t>(count) - first);
+}
+
+void symbolizeModule(const std::string &, std::vector<frame_t *> &frames) {
+    std::vector<void *> pcs;
+    pcs.reserve(frames.size());
+    for (auto *frame : frames) {
+        pcs.push_back(frame->pc);
+    }
+
+    char **symbols =
+        backtrace_symbols(pcs.data(), static_cast<int>(pcs.size()));
+    for (size_t i = 0; i < frames.size(); i++) {
+        frames[i]->symbol = symbols ? symbols[i] : "????????";
+    }
+    free(symbols);
+}
+
+namespace detail {
+
+bool locateFrame(frame_t &frame) {
+    Dl_info info;
+    if (!dladdr(frame.pc, &info) || !info.dli_fname) {
+        return false;
+    }
+    frame.module = info.dli_fname;
+    frame.offset = reinterpret_cast<uintptr_t>(frame.pc) -
+                   reinterpret_cast<uintptr_t>(info.dli_fbase);
+    return true;
+}
+
+} // namespace detail
+
+} // namespace stack_depot
@@ -0,0 +1,196 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_stack_depot.cpp
+ *
+ */
+
+#include "ur_stack_depot.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+
+namespace stack_depot {
+
+namespace {
+
+struct node_t {
+    node_t *next;
+    uint64_t hash;
+    stack_id_t id;
+    uint32_t size;
+    void *frames[1];
+};
+
+// Stacks are chained into a fixed number of buckets by hash. New nodes are
+// pushed to the head of a bucket with a CAS and never removed, so lookups
+// walk the chains without taking a lock.
+constexpr size_t bucketBits = 14;
+constexpr size_t bucketCount = size_t(1) << bucketBits;
+
+// Ids index a two level table, chunks are allocated on first use.
+constexpr size_t chunkBits = 12;
+constexpr size_t chunkSize = size_t(1) << chunkBits;
+constexpr size_t chunkCount = 1024;
+
+using chunk_t = std::atomic<node_t *>;
+
+// Zero-initialized, so usable by layers before static constructors have run.
+std::atomic<node_t *> buckets[bucketCount];
+std::atomic<chunk_t *> chunks[chunkCount];
+std::atomic<stack_id_t> lastId;
+std::atomic<size_t> stackCount;
+
+uint64_t hashFrames(void *const *frames, size_t count) {
+    uint64_t hash = 0xcbf29ce484222325ull ^ count;
+    for (size_t i = 0; i < count; i++) {
+        hash ^= reinterpret_cast<uintptr_t>(frames[i]);
+        hash *= 0x100000001b3ull;
+        hash ^= hash >> 29;
+    }
+    return hash;
+}
+
+// Looks for a stack in the nodes from `head` up to, but excluding, `stop`.
+node_t *find(node_t *head, node_t *stop, uint64_t hash, void *const *frames,
+             size_t count) {
+    for (node_t *node = head; node != stop; node = node->next) {
+        if (node->hash == hash && node->size == count &&
+            std::memcmp(node->frames, frames, count * sizeof(void *)) == 0) {
+            return node;
+        }
+    }
+    return nullptr;
+}
+
+chunk_t *getChunk(stack_id_t id, bool create) {
+    auto &slot = chunks[id >> chunkBits];
+    chunk_t *chunk = slot.load(std::memory_order_acquire);
+    if (chunk || !create) {
+        return chunk;
+    }
+
+    chunk_t *fresh = new chunk_t[chunkSize]();
+    if (slot.compare_exchange_strong(chunk, fresh, std::memory_order_acq_rel,
+                                     std::memory_order_acquire)) {
+        return fresh;
+    }
+    delete[] fresh;
+    return chunk;
+}
+
+} // namespace
+
+stack_id_t put(void *const *frames, size_t count) {
+    if (count == 0) {
+        return invalid_stack_id;
+    }
+    if (count > max_frames) {
+        count = max_frames;
+    }
+
+    uint64_t hash = hashFrames(frames, count);
+    auto &bucket = buckets[hash & (bucketCount - 1)];
+    node_t *head = bucket.load(std::memory_order_acquire);
+    if (node_t *found = find(head, nullptr, hash, frames, count)) {
+        return found->id;
+    }
+
+    stack_id_t id = lastId.fetch_add(1, std::memory_order_relaxed) + 1;
+    if ((id >> chunkBits) >= chunkCount) {
+        return invalid_stack_id;
+    }
+
+    auto *node = static_cast<node_t *>(
+        std::malloc(sizeof(node_t) + (count - 1) * sizeof(void *)));
+    if (!node) {
+        return invalid_stack_id;
+    }
+    node->hash = hash;
+    node->id = id;
+    node->size = static_cast<uint32_t>(count);
+    std::memcpy(node->frames, frames, count * sizeof(void *));
+
+    // The id must resolve as soon as another thread can find the node.
+    chunk_t *chunk = getChunk(id, true);
+    auto &slot = chunk[id & (chunkSize - 1)];
+    slot.store(node, std::memory_order_release);
+
+    // Only the nodes pushed since the last look at the bucket need to be
+    // checked again when the CAS fails. A stack that loses the race leaves
+    // its id unused.
+    node_t *checked = head;
+    node->next = head;
+    while (!bucket.compare_exchange_weak(node->next, node,
+                                         std::memory_order_release,
+                                         std::memory_order_acquire)) {
+        if (node_t *found = find(node->next, checked, hash, frames, count)) {
+            slot.store(nullptr, std::memory_order_relaxed);
+            std::free(node);
+            return found->id;
+        }
+        checked = node->next;
+    }
+
+    stackCount.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+frames_t get(stack_id_t id) {
+    if (id == invalid_stack_id || (id >> chunkBits) >= chunkCount) {
+        return {};
+    }
+    chunk_t *chunk = getChunk(id, false);
+    if (!chunk) {
+        return {};
+    }
+    node_t *node = chunk[id & (chunkSize - 1)].load(std::memory_order_acquire);
+    if (!node) {
+        return {};
+    }
+    return {node->frames, node->size};
+}
+
+size_t size() { return stackCount.load(std::memory_order_relaxed); }
+
+void symbolizer::add(stack_id_t id) {
+    for (void *pc : get(id)) {
+        auto [it, inserted] = frames.try_emplace(pc);
+        if (inserted) {
+            it->second.pc = pc;
+            pending.push_back(pc);
+        }
+    }
+}
+
+void symbolizer::resolve() {
+    std::map<std::string, std::vector<frame_t *>> modules;
+    for (void *pc : pending) {
+        frame_t &frame = frames[pc];
+        detail::locateFrame(frame);
+        modules[frame.module].push_back(&frame);
+    }
+    pending.clear();
+
+    for (auto &[module, moduleFrames] : modules) {
+        moduleFn(module, moduleFrames);
+    }
+}
+
+const frame_t &symbolizer::frame(void *pc) {
+    auto [it, inserted] = frames.try_emplace(pc);
+    if (inserted) {
+        it->second.pc = pc;
+        pending.push_back(pc);
+    }
+    return it->second;
+}
+
+} // namespace stack_depot
@@ -0,0 +1,122 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_stack_depot.hpp
+ *
+ */
+
+#ifndef UR_STACK_DEPOT_HPP
+#define UR_STACK_DEPOT_HPP 1
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// Process wide storage of call stacks recorded by the layers.
+///
+/// Capturing a stack only unwinds the frame addresses, hashes them and stores
+/// each distinct stack once, so a stack is referred to by a compact id. Module
+/// and symbol lookup is deferred until a stack is actually reported, see
+/// stack_depot::symbolizer.
+namespace stack_depot {
+
+using stack_id_t = uint32_t;
+
+/// Id of a stack that could not be captured or stored.
+constexpr stack_id_t invalid_stack_id = 0;
+
+/// Maximum number of frames kept per stack.
+constexpr size_t max_frames = 64;
+
+struct frames_t {
+    void *const *data = nullptr;
+    size_t size = 0;
+
+    void *const *begin() const { return data; }
+    void *const *end() const { return data + size; }
+    bool empty() const { return size == 0; }
+};
+
+/// @brief Stores a stack and returns its id.
+///
+/// Identical stacks share an id. Insertion is lock-free and stored stacks are
+/// never released, so the frames returned by get() remain valid until the
+/// process exits.
+stack_id_t put(void *const *frames, size_t count);
+
+/// @brief Returns the frames of a stored stack, or no frames for an unknown
+/// id.
+frames_t get(stack_id_t id);
+
+/// @brief Returns the number of distinct stacks stored.
+size_t size();
+
+/// @brief Unwinds the calling thread and stores its stack.
+///
+/// @param skip Number of innermost frames to drop in addition to the frame of
+///             capture() itself.
+stack_id_t capture(size_t skip = 0);
+
+struct frame_t {
+    void *pc = nullptr;
+    /// Path of the module containing pc, empty if it is not known.
+    std::string module;
+    /// Offset of pc from the load address of module.
+    uintptr_t offset = 0;
+    /// Human readable location, set by the module symbolizer.
+    std::string symbol;
+};
+
+/// @brief Symbolizes the frames of one module.
+///
+/// Receives every not yet symbolized frame of that module at once and is
+/// expected to set their symbol.
+using module_fn_t =
+    std::function<void(const std::string &module, std::vector<frame_t *> &)>;
+
+/// @brief Default module symbolizer of the platform.
+void symbolizeModule(const std::string &module, std::vector<frame_t *> &frames);
+
+/// Resolves stored stacks into printable frames at report time.
+///
+/// Every distinct frame is looked up once however many stacks contain it, and
+/// the frames are handed to the module symbolizer grouped by module. Frames
+/// symbolized by an earlier resolve() are kept, so a long lived symbolizer
+/// also works as a cache across reports. Not thread-safe.
+class symbolizer {
+  public:
+    explicit symbolizer(module_fn_t moduleFn = symbolizeModule)
+        : moduleFn(std::move(moduleFn)) {}
+
+    /// @brief Queues the frames of a stack for the next resolve().
+    void add(stack_id_t id);
+
+    /// @brief Symbolizes all queued frames.
+    void resolve();
+
+    /// @brief Returns a frame queued by add(), resolve() must be called
+    /// first for its module and symbol to be set.
+    const frame_t &frame(void *pc);
+
+  private:
+    module_fn_t moduleFn;
+    std::unordered_map<void *, frame_t> frames;
+    std::vector<void *> pending;
+};
+
+namespace detail {
+/// @brief Fills in module and offset of a frame, platform specific.
+bool locateFrame(frame_t &frame);
+} // namespace detail
+
+} // namespace stack_depot
+
+#endif /* UR_STACK_DEPOT_HPP */
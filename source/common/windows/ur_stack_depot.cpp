@@ -0,0 +1,72 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+#include <Windows.h>
+// Windows.h must be included before DbgHelp.h
+#include <DbgHelp.h>
+
+#include "ur_stack_depot.hpp"
+
+namespace stack_depot {
+
+__declspec(noinline) stack_id_t capture(size_t skip) {
+    PVOID frames[max_frames];
+    // Drop the frame of capture() itself.
+    WORD count = CaptureStackBackTrace(static_cast<DWORD>(skip + 1),
+                                       static_cast<DWORD>(max_frames), frames,
+                                       nullptr);
+    return put(frames, count);
+}
+
+void symbolizeModule(const std::string &, std::vector<frame_t *> &frames) {
+    HANDLE process = GetCurrentProcess();
+    bool initialized = SymInitialize(process, nullptr, true);
+
+    DWORD displacement = 0;
+    IMAGEHLP_LINE64 line;
+    line.SizeOfStruct = sizeof(IMAGEHLP_LINE64);
+
+    for (auto *frame : frames) {
+        if (initialized && SymGetLineFromAddr64(process, (DWORD64)frame->pc,
+                                                &displacement, &line)) {
+            frame->symbol = std::string(line.FileName) + ":" +
+                            std::to_string(line.LineNumber);
+        } else {
+            frame->symbol = "????????";
+        }
+    }
+
+    if (initialized) {
+        SymCleanup(process);
+    }
+}
+
+namespace detail {
+
+bool locateFrame(frame_t &frame) {
+    HMODULE module = nullptr;
+    if (!GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS |
+                                GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                            static_cast<LPCSTR>(frame.pc), &module)) {
+        return false;
+    }
+    char path[MAX_PATH];
+    DWORD length = GetModuleFileNameA(module, path, MAX_PATH);
+    if (length == 0) {
+        return false;
+    }
+    frame.module.assign(path, length);
+    frame.offset = reinterpret_cast<uintptr_t>(frame.pc) -
+                   reinterpret_cast<uintptr_t>(module);
+    return true;
+}
+
+} // namespace detail
+
+} // namespace stack_depot
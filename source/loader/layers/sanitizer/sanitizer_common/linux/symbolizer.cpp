@@ -79,4 +79,40 @@ void SymbolizeCode(const char *ModuleName, uint64_t ModuleOffset,
         ResultString[ResultSize - 1] = '\0';
     }
 }
+
+void SymbolizeCodeBatch(const char *ModuleName, const uint64_t *ModuleOffsets,
+                        size_t Count,
+                        void (*Callback)(void *Data, size_t Index,
+                                         const char *Result),
+                        void *Data) {
+    llvm::symbolize::PrinterConfig Config = GetPrinterConfig();
+    llvm::symbolize::LLVMSymbolizer Symbolizer;
+    // The module is looked up and its debug info loaded once for the batch.
+    uintptr_t ModuleBase = GetModuleBase(ModuleName);
+
+    for (size_t Index = 0; Index < Count; Index++) {
+        std::string Result;
+        llvm::raw_string_ostream OS(Result);
+        llvm::symbolize::Request Request{ModuleName, ModuleOffsets[Index]};
+        llvm::symbolize::ErrorHandler EH =
+            [&](const llvm::ErrorInfoBase &ErrorInfo,
+                llvm::StringRef ErrorBanner) {
+                OS << ErrorBanner;
+                ErrorInfo.log(OS);
+                OS << '\n';
+            };
+        llvm::symbolize::LLVMPrinter Printer(OS, EH, Config);
+
+        auto ResOrErr = Symbolizer.symbolizeInlinedCode(
+            ModuleName, {ModuleOffsets[Index] - ModuleBase,
+                         llvm::object::SectionedAddress::UndefSection});
+
+        if (!ResOrErr) {
+            continue;
+        }
+        Printer.print(Request, *ResOrErr);
+        Callback(Data, Index, Result.c_str());
+    }
+    Symbolizer.pruneCache();
+}
 }
@@ -13,12 +13,22 @@
 #include "sanitizer_stacktrace.hpp"
 #include "ur_sanitizer_layer.hpp"
 
+#include <mutex>
+#include <sstream>
+
 extern "C" {
 
 __attribute__((weak)) void SymbolizeCode(const char *ModuleName,
                                          uint64_t ModuleOffset,
                                          char *ResultString, size_t ResultSize,
                                          size_t *RetSize);
+
+__attribute__((weak)) void
+SymbolizeCodeBatch(const char *ModuleName, const uint64_t *ModuleOffsets,
+                   size_t Count,
+                   void (*Callback)(void *Data, size_t Index,
+                                    const char *Result),
+                   void *Data);
 }
 
 namespace ur_sanitizer_layer {
@@ -29,22 +39,11 @@ bool Contains(const std::string &s, const char *p) {
     return s.find(p) != std::string::npos;
 }
 
-// Parse back trace information in the following formats:
-//   <module_name>([function_name]+function_offset) [offset]
-void ParseBacktraceInfo(const BacktraceInfo &BI, std::string &ModuleName,
-                        uptr &Offset) {
-    // Parse module name
-    size_t End = BI.find_first_of('(');
-    assert(End != std::string::npos);
-    ModuleName = BI.substr(0, End);
-    // Parse offset
-    size_t Start = BI.find_first_of('[');
-    assert(Start != std::string::npos);
-    Start = BI.substr(Start + 1, 2) == "0x" ? Start + 3 : Start + 1;
-    End = BI.find_first_of(']');
-    assert(End != std::string::npos);
-    Offset = std::stoull(BI.substr(Start, End), nullptr, 16);
-    return;
+bool IsRuntimeModule(const std::string &ModuleName) {
+    return Contains(ModuleName, "libsycl.so") ||
+           Contains(ModuleName, "libur_loader.so") ||
+           Contains(ModuleName, "libomptarget.rtl.unified_runtime.so") ||
+           Contains(ModuleName, "libomptarget.so");
 }
 
 // Parse symbolizer output in the following formats:
@@ -77,58 +76,97 @@ SourceInfo ParseSymbolizerOutput(const std::string &Output) {
     return Info;
 }
 
+std::string FormatSymbolizerOutput(const std::string &Output,
+                                   const stack_depot::frame_t &Frame) {
+    SourceInfo SrcInfo = ParseSymbolizerOutput(Output);
+    std::stringstream Line;
+    if (SrcInfo.file != "??") {
+        Line << "in " << SrcInfo.function << " " << SrcInfo.file << ":"
+             << SrcInfo.line << ":" << SrcInfo.column;
+    } else {
+        Line << "in " << SrcInfo.function << " (" << Frame.module << "+"
+             << (void *)Frame.offset << ")";
+    }
+    return Line.str();
+}
+
+// Frames of the runtime modules are never printed, so they are not
+// symbolized. The symbolizer takes absolute addresses and subtracts the
+// module base itself.
+void SymbolizeModule(const std::string &ModuleName,
+                     std::vector<stack_depot::frame_t *> &Frames) {
+    if (IsRuntimeModule(ModuleName)) {
+        return;
+    }
+    if (&SymbolizeCode == nullptr || ModuleName.empty()) {
+        stack_depot::symbolizeModule(ModuleName, Frames);
+        return;
+    }
+
+    if (&SymbolizeCodeBatch != nullptr) {
+        std::vector<uint64_t> Addresses;
+        for (auto *Frame : Frames) {
+            Addresses.push_back((uint64_t)Frame->pc);
+        }
+        SymbolizeCodeBatch(
+            ModuleName.c_str(), Addresses.data(), Addresses.size(),
+            [](void *Data, size_t Index, const char *Result) {
+                auto &Frames =
+                    *static_cast<std::vector<stack_depot::frame_t *> *>(Data);
+                Frames[Index]->symbol =
+                    FormatSymbolizerOutput(Result, *Frames[Index]);
+            },
+            &Frames);
+        return;
+    }
+
+    for (auto *Frame : Frames) {
+        size_t ResultSize = 0;
+        SymbolizeCode(ModuleName.c_str(), (uint64_t)Frame->pc, nullptr, 0,
+                      &ResultSize);
+        if (ResultSize) {
+            std::vector<char> ResultVector(ResultSize);
+            SymbolizeCode(ModuleName.c_str(), (uint64_t)Frame->pc,
+                          ResultVector.data(), ResultSize, nullptr);
+            Frame->symbol = FormatSymbolizerOutput(ResultVector.data(), *Frame);
+        }
+    }
+}
+
 } // namespace
 
 void StackTrace::print() const {
-    if (!stack.size()) {
+    stack_depot::frames_t Frames = stack_depot::get(id);
+    if (Frames.empty()) {
         getContext()->logger.always("  failed to acquire backtrace");
+        getContext()->logger.always("");
+        return;
     }
 
-    unsigned index = 0;
-
-    char **BacktraceSymbols = GetBacktraceSymbols(stack);
+    // Symbolized frames are kept for later reports, which mostly share the
+    // frames of the user program.
+    static std::mutex SymbolizerMutex;
+    static stack_depot::symbolizer Symbolizer(SymbolizeModule);
+    std::scoped_lock<std::mutex> Guard(SymbolizerMutex);
+    Symbolizer.add(id);
+    Symbolizer.resolve();
 
-    for (size_t i = 0; i < stack.size(); i++) {
-        BacktraceInfo BI = BacktraceSymbols[i];
+    const char *Format = &SymbolizeCode != nullptr ? " #{} {}" : "  #{} {}";
+    unsigned index = 0;
+    for (void *pc : Frames) {
+        const stack_depot::frame_t &Frame = Symbolizer.frame(pc);
 
         // Skip runtime modules
-        if (Contains(BI, "libsycl.so") || Contains(BI, "libur_loader.so") ||
-            Contains(BI, "libomptarget.rtl.unified_runtime.so") ||
-            Contains(BI, "libomptarget.so")) {
+        if (IsRuntimeModule(Frame.module)) {
             continue;
         }
 
-        if (&SymbolizeCode != nullptr) {
-            std::string Result;
-            std::string ModuleName;
-            uptr Offset;
-            ParseBacktraceInfo(BI, ModuleName, Offset);
-            size_t ResultSize = 0;
-            SymbolizeCode(ModuleName.c_str(), Offset, nullptr, 0, &ResultSize);
-            if (ResultSize) {
-                std::vector<char> ResultVector(ResultSize);
-                SymbolizeCode(ModuleName.c_str(), Offset, ResultVector.data(),
-                              ResultSize, nullptr);
-                std::string Result((char *)ResultVector.data());
-                SourceInfo SrcInfo = ParseSymbolizerOutput(Result);
-                if (SrcInfo.file != "??") {
-                    getContext()->logger.always(" #{} in {} {}:{}:{}", index,
-                                                SrcInfo.function, SrcInfo.file,
-                                                SrcInfo.line, SrcInfo.column);
-                } else {
-                    getContext()->logger.always(" #{} in {} ({}+{})", index,
-                                                SrcInfo.function, ModuleName,
-                                                (void *)Offset);
-                }
-            }
-        } else {
-            getContext()->logger.always("  #{} {}", index, BI);
+        if (!Frame.symbol.empty()) {
+            getContext()->logger.always(Format, index, Frame.symbol);
         }
         ++index;
     }
     getContext()->logger.always("");
-
-    free(BacktraceSymbols);
 }
 
 } // namespace ur_sanitizer_layer
@@ -13,21 +13,20 @@
 #pragma once
 
 #include "sanitizer_common.hpp"
-
-#include <vector>
+#include "ur_stack_depot.hpp"
 
 namespace ur_sanitizer_layer {
 
-constexpr size_t MAX_BACKTRACE_FRAMES = 64;
+constexpr size_t MAX_BACKTRACE_FRAMES = stack_depot::max_frames;
 
+// Id of a stack recorded in the stack depot. The frames are symbolized when
+// the stack is printed, most recorded stacks never are.
 struct StackTrace {
-    std::vector<BacktraceFrame> stack;
+    stack_depot::stack_id_t id = stack_depot::invalid_stack_id;
 
     void print() const;
 };
 
 StackTrace GetCurrentBacktrace();
 
-char **GetBacktraceSymbols(const std::vector<BacktraceFrame> &BacktraceFrames);
-
 } // namespace ur_sanitizer_layer
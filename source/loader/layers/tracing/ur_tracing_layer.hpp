@@ -54,6 +54,10 @@ class __urdlllocal context_t : public proxy_layer_context_t,
 };
 
 context_t *getContext();
+
+// Per-thread storage the call arguments are printed into, it keeps its
+// capacity between calls so logging them does not allocate.
+std::string &getArgsStorage();
 } // namespace ur_tracing_layer
 
 #endif /* UR_TRACING_LAYER_H */
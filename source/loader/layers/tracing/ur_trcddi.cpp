@@ -49,8 +49,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGet(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_GET,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_GET,
                                         &params);
         logger.info("   <--- urAdapterGet({}) -> {};\n", args_str.str(),
                     result);
@@ -83,8 +83,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRelease(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_RELEASE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_RELEASE,
                                         &params);
         logger.info("   <--- urAdapterRelease({}) -> {};\n", args_str.str(),
                     result);
@@ -117,8 +117,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRetain(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_RETAIN,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_RETAIN,
                                         &params);
         logger.info("   <--- urAdapterRetain({}) -> {};\n", args_str.str(),
                     result);
@@ -160,8 +160,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ADAPTER_GET_LAST_ERROR, &params);
         logger.info("   <--- urAdapterGetLastError({}) -> {};\n",
                     args_str.str(), result);
@@ -206,8 +206,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_GET_INFO,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_GET_INFO,
                                         &params);
         logger.info("   <--- urAdapterGetInfo({}) -> {};\n", args_str.str(),
                     result);
@@ -255,8 +255,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PLATFORM_GET,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_PLATFORM_GET,
                                         &params);
         logger.info("   <--- urPlatformGet({}) -> {};\n", args_str.str(),
                     result);
@@ -301,8 +301,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PLATFORM_GET_INFO,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_PLATFORM_GET_INFO,
                                         &params);
         logger.info("   <--- urPlatformGetInfo({}) -> {};\n", args_str.str(),
                     result);
@@ -338,8 +338,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_PLATFORM_GET_API_VERSION, &params);
         logger.info("   <--- urPlatformGetApiVersion({}) -> {};\n",
                     args_str.str(), result);
@@ -378,8 +378,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE, &params);
         logger.info("   <--- urPlatformGetNativeHandle({}) -> {};\n",
                     args_str.str(), result);
@@ -424,8 +424,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE, &params);
         logger.info("   <--- urPlatformCreateWithNativeHandle({}) -> {};\n",
                     args_str.str(), result);
@@ -468,8 +468,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION, &params);
         logger.info("   <--- urPlatformGetBackendOption({}) -> {};\n",
                     args_str.str(), result);
@@ -516,8 +516,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_GET,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_DEVICE_GET,
                                         &params);
         logger.info("   <--- urDeviceGet({}) -> {};\n", args_str.str(), result);
     }
@@ -562,8 +562,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_GET_INFO,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_DEVICE_GET_INFO,
                                         &params);
         logger.info("   <--- urDeviceGetInfo({}) -> {};\n", args_str.str(),
                     result);
@@ -597,8 +597,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_RETAIN,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_DEVICE_RETAIN,
                                         &params);
         logger.info("   <--- urDeviceRetain({}) -> {};\n", args_str.str(),
                     result);
@@ -632,8 +632,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_RELEASE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_DEVICE_RELEASE,
                                         &params);
         logger.info("   <--- urDeviceRelease({}) -> {};\n", args_str.str(),
                     result);
@@ -678,8 +678,8 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_PARTITION,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_DEVICE_PARTITION,
                                         &params);
         logger.info("   <--- urDevicePartition({}) -> {};\n", args_str.str(),
                     result);
@@ -724,8 +724,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_DEVICE_SELECT_BINARY, &params);
         logger.info("   <--- urDeviceSelectBinary({}) -> {};\n", args_str.str(),
                     result);
@@ -763,8 +763,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE, &params);
         logger.info("   <--- urDeviceGetNativeHandle({}) -> {};\n",
                     args_str.str(), result);
@@ -809,8 +809,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE, &params);
         logger.info("   <--- urDeviceCreateWithNativeHandle({}) -> {};\n",
                     args_str.str(), result);
@@ -854,8 +854,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS, &params);
         logger.info("   <--- urDeviceGetGlobalTimestamps({}) -> {};\n",
                     args_str.str(), result);
@@ -896,8 +896,8 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_CREATE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_CREATE,
                                         &params);
         logger.info("   <--- urContextCreate({}) -> {};\n", args_str.str(),
                     result);
@@ -931,8 +931,8 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_RETAIN,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_RETAIN,
                                         &params);
         logger.info("   <--- urContextRetain({}) -> {};\n", args_str.str(),
                     result);
@@ -966,8 +966,8 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_RELEASE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_RELEASE,
                                         &params);
         logger.info("   <--- urContextRelease({}) -> {};\n", args_str.str(),
                     result);
@@ -1014,8 +1014,8 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_GET_INFO,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_GET_INFO,
                                         &params);
         logger.info("   <--- urContextGetInfo({}) -> {};\n", args_str.str(),
                     result);
@@ -1054,8 +1054,8 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE, &params);
         logger.info("   <--- urContextGetNativeHandle({}) -> {};\n",
                     args_str.str(), result);
@@ -1106,8 +1106,8 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE, &params);
         logger.info("   <--- urContextCreateWithNativeHandle({}) -> {};\n",
                     args_str.str(), result);
@@ -1148,8 +1148,8 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER, &params);
         logger.info("   <--- urContextSetExtendedDeleter({}) -> {};\n",
                     args_str.str(), result);
@@ -1190,8 +1190,8 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_IMAGE_CREATE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_MEM_IMAGE_CREATE,
                                         &params);
         logger.info("   <--- urMemImageCreate({}) -> {};\n", args_str.str(),
                     result);
@@ -1232,8 +1232,8 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_BUFFER_CREATE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_MEM_BUFFER_CREATE,
                                         &params);
         logger.info("   <--- urMemBufferCreate({}) -> {};\n", args_str.str(),
                     result);
@@ -1267,8 +1267,8 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_RETAIN,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_MEM_RETAIN,
                                         &params);
         logger.info("   <--- urMemRetain({}) -> {};\n", args_str.str(), result);
     }
@@ -1301,8 +1301,8 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_RELEASE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_MEM_RELEASE,
                                         &params);
         logger.info("   <--- urMemRelease({}) -> {};\n", args_str.str(),
                     result);
@@ -1345,8 +1345,8 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_MEM_BUFFER_PARTITION, &params);
         logger.info("   <--- urMemBufferPartition({}) -> {};\n", args_str.str(),
                     result);
@@ -1385,8 +1385,8 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_MEM_GET_NATIVE_HANDLE, &params);
         logger.info("   <--- urMemGetNativeHandle({}) -> {};\n", args_str.str(),
                     result);
@@ -1430,8 +1430,8 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE,
             &params);
         logger.info("   <--- urMemBufferCreateWithNativeHandle({}) -> {};\n",
@@ -1480,8 +1480,8 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE, &params);
         logger.info("   <--- urMemImageCreateWithNativeHandle({}) -> {};\n",
                     args_str.str(), result);
@@ -1528,8 +1528,8 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_GET_INFO,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_MEM_GET_INFO,
                                         &params);
         logger.info("   <--- urMemGetInfo({}) -> {};\n", args_str.str(),
                     result);
@@ -1575,8 +1575,8 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
                              "urMemImageGetInfo", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_MEM_IMAGE_GET_INFO, &params);
         logger.info("   <--- urMemImageGetInfo({}) -> {};\n", args_str.str(),
                     result);
@@ -1612,8 +1612,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_CREATE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_CREATE,
                                         &params);
         logger.info("   <--- urSamplerCreate({}) -> {};\n", args_str.str(),
                     result);
@@ -1647,8 +1647,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_RETAIN,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_RETAIN,
                                         &params);
         logger.info("   <--- urSamplerRetain({}) -> {};\n", args_str.str(),
                     result);
@@ -1682,8 +1682,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_RELEASE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_RELEASE,
                                         &params);
         logger.info("   <--- urSamplerRelease({}) -> {};\n", args_str.str(),
                     result);
@@ -1726,8 +1726,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_GET_INFO,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_GET_INFO,
                                         &params);
         logger.info("   <--- urSamplerGetInfo({}) -> {};\n", args_str.str(),
                     result);
@@ -1766,8 +1766,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE, &params);
         logger.info("   <--- urSamplerGetNativeHandle({}) -> {};\n",
                     args_str.str(), result);
@@ -1811,8 +1811,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE, &params);
         logger.info("   <--- urSamplerCreateWithNativeHandle({}) -> {};\n",
                     args_str.str(), result);
@@ -1853,8 +1853,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_HOST_ALLOC,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_USM_HOST_ALLOC,
                                         &params);
         logger.info("   <--- urUSMHostAlloc({}) -> {};\n", args_str.str(),
                     result);
@@ -1897,8 +1897,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_DEVICE_ALLOC,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_USM_DEVICE_ALLOC,
                                         &params);
         logger.info("   <--- urUSMDeviceAlloc({}) -> {};\n", args_str.str(),
                     result);
@@ -1941,8 +1941,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_SHARED_ALLOC,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_USM_SHARED_ALLOC,
                                         &params);
         logger.info("   <--- urUSMSharedAlloc({}) -> {};\n", args_str.str(),
                     result);
@@ -1976,8 +1976,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_FREE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_USM_FREE,
                                         &params);
         logger.info("   <--- urUSMFree({}) -> {};\n", args_str.str(), result);
     }
@@ -2022,8 +2022,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_USM_GET_MEM_ALLOC_INFO, &params);
         logger.info("   <--- urUSMGetMemAllocInfo({}) -> {};\n", args_str.str(),
                     result);
@@ -2060,8 +2060,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_CREATE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_CREATE,
                                         &params);
         logger.info("   <--- urUSMPoolCreate({}) -> {};\n", args_str.str(),
                     result);
@@ -2094,8 +2094,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRetain(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_RETAIN,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_RETAIN,
                                         &params);
         logger.info("   <--- urUSMPoolRetain({}) -> {};\n", args_str.str(),
                     result);
@@ -2128,8 +2128,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRelease(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_RELEASE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_RELEASE,
                                         &params);
         logger.info("   <--- urUSMPoolRelease({}) -> {};\n", args_str.str(),
                     result);
@@ -2171,8 +2171,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_GET_INFO,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_GET_INFO,
                                         &params);
         logger.info("   <--- urUSMPoolGetInfo({}) -> {};\n", args_str.str(),
                     result);
@@ -2224,8 +2224,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO, &params);
         logger.info("   <--- urVirtualMemGranularityGetInfo({}) -> {};\n",
                     args_str.str(), result);
@@ -2268,8 +2268,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
                              "urVirtualMemReserve", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_VIRTUAL_MEM_RESERVE, &params);
         logger.info("   <--- urVirtualMemReserve({}) -> {};\n", args_str.str(),
                     result);
@@ -2305,8 +2305,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_VIRTUAL_MEM_FREE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_VIRTUAL_MEM_FREE,
                                         &params);
         logger.info("   <--- urVirtualMemFree({}) -> {};\n", args_str.str(),
                     result);
@@ -2350,8 +2350,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_VIRTUAL_MEM_MAP,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_VIRTUAL_MEM_MAP,
                                         &params);
         logger.info("   <--- urVirtualMemMap({}) -> {};\n", args_str.str(),
                     result);
@@ -2387,8 +2387,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_VIRTUAL_MEM_UNMAP,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_VIRTUAL_MEM_UNMAP,
                                         &params);
         logger.info("   <--- urVirtualMemUnmap({}) -> {};\n", args_str.str(),
                     result);
@@ -2428,8 +2428,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS, &params);
         logger.info("   <--- urVirtualMemSetAccess({}) -> {};\n",
                     args_str.str(), result);
@@ -2478,8 +2478,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
                              "urVirtualMemGetInfo", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_VIRTUAL_MEM_GET_INFO, &params);
         logger.info("   <--- urVirtualMemGetInfo({}) -> {};\n", args_str.str(),
                     result);
@@ -2522,8 +2522,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
                              "urPhysicalMemCreate", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_PHYSICAL_MEM_CREATE, &params);
         logger.info("   <--- urPhysicalMemCreate({}) -> {};\n", args_str.str(),
                     result);
@@ -2557,8 +2557,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRetain(
                              "urPhysicalMemRetain", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_PHYSICAL_MEM_RETAIN, &params);
         logger.info("   <--- urPhysicalMemRetain({}) -> {};\n", args_str.str(),
                     result);
@@ -2593,8 +2593,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_PHYSICAL_MEM_RELEASE, &params);
         logger.info("   <--- urPhysicalMemRelease({}) -> {};\n", args_str.str(),
                     result);
@@ -2636,8 +2636,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_PROGRAM_CREATE_WITH_IL, &params);
         logger.info("   <--- urProgramCreateWithIL({}) -> {};\n",
                     args_str.str(), result);
@@ -2691,8 +2691,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY, &params);
         logger.info("   <--- urProgramCreateWithBinary({}) -> {};\n",
                     args_str.str(), result);
@@ -2728,8 +2728,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_BUILD,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_BUILD,
                                         &params);
         logger.info("   <--- urProgramBuild({}) -> {};\n", args_str.str(),
                     result);
@@ -2766,8 +2766,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_COMPILE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_COMPILE,
                                         &params);
         logger.info("   <--- urProgramCompile({}) -> {};\n", args_str.str(),
                     result);
@@ -2812,8 +2812,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_LINK,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_LINK,
                                         &params);
         logger.info("   <--- urProgramLink({}) -> {};\n", args_str.str(),
                     result);
@@ -2847,8 +2847,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_RETAIN,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_RETAIN,
                                         &params);
         logger.info("   <--- urProgramRetain({}) -> {};\n", args_str.str(),
                     result);
@@ -2882,8 +2882,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_RELEASE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_RELEASE,
                                         &params);
         logger.info("   <--- urProgramRelease({}) -> {};\n", args_str.str(),
                     result);
@@ -2930,8 +2930,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER, &params);
         logger.info("   <--- urProgramGetFunctionPointer({}) -> {};\n",
                     args_str.str(), result);
@@ -2981,8 +2981,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER, &params);
         logger.info("   <--- urProgramGetGlobalVariablePointer({}) -> {};\n",
                     args_str.str(), result);
@@ -3028,8 +3028,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_GET_INFO,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_GET_INFO,
                                         &params);
         logger.info("   <--- urProgramGetInfo({}) -> {};\n", args_str.str(),
                     result);
@@ -3078,8 +3078,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_PROGRAM_GET_BUILD_INFO, &params);
         logger.info("   <--- urProgramGetBuildInfo({}) -> {};\n",
                     args_str.str(), result);
@@ -3121,8 +3121,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS,
             &params);
         logger.info("   <--- urProgramSetSpecializationConstants({}) -> {};\n",
@@ -3162,8 +3162,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE, &params);
         logger.info("   <--- urProgramGetNativeHandle({}) -> {};\n",
                     args_str.str(), result);
@@ -3207,8 +3207,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE, &params);
         logger.info("   <--- urProgramCreateWithNativeHandle({}) -> {};\n",
                     args_str.str(), result);
@@ -3244,8 +3244,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_CREATE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_KERNEL_CREATE,
                                         &params);
         logger.info("   <--- urKernelCreate({}) -> {};\n", args_str.str(),
                     result);
@@ -3287,8 +3287,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
                              "urKernelSetArgValue", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_KERNEL_SET_ARG_VALUE, &params);
         logger.info("   <--- urKernelSetArgValue({}) -> {};\n", args_str.str(),
                     result);
@@ -3328,8 +3328,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
                              "urKernelSetArgLocal", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_KERNEL_SET_ARG_LOCAL, &params);
         logger.info("   <--- urKernelSetArgLocal({}) -> {};\n", args_str.str(),
                     result);
@@ -3376,8 +3376,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_GET_INFO,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_KERNEL_GET_INFO,
                                         &params);
         logger.info("   <--- urKernelGetInfo({}) -> {};\n", args_str.str(),
                     result);
@@ -3423,8 +3423,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_KERNEL_GET_GROUP_INFO, &params);
         logger.info("   <--- urKernelGetGroupInfo({}) -> {};\n", args_str.str(),
                     result);
@@ -3472,8 +3472,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO, &params);
         logger.info("   <--- urKernelGetSubGroupInfo({}) -> {};\n",
                     args_str.str(), result);
@@ -3506,8 +3506,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_RETAIN,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_KERNEL_RETAIN,
                                         &params);
         logger.info("   <--- urKernelRetain({}) -> {};\n", args_str.str(),
                     result);
@@ -3541,8 +3541,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_RELEASE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_KERNEL_RELEASE,
                                         &params);
         logger.info("   <--- urKernelRelease({}) -> {};\n", args_str.str(),
                     result);
@@ -3584,8 +3584,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_KERNEL_SET_ARG_POINTER, &params);
         logger.info("   <--- urKernelSetArgPointer({}) -> {};\n",
                     args_str.str(), result);
@@ -3627,8 +3627,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
                              "urKernelSetExecInfo", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_KERNEL_SET_EXEC_INFO, &params);
         logger.info("   <--- urKernelSetExecInfo({}) -> {};\n", args_str.str(),
                     result);
@@ -3668,8 +3668,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_KERNEL_SET_ARG_SAMPLER, &params);
         logger.info("   <--- urKernelSetArgSampler({}) -> {};\n",
                     args_str.str(), result);
@@ -3709,8 +3709,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ, &params);
         logger.info("   <--- urKernelSetArgMemObj({}) -> {};\n", args_str.str(),
                     result);
@@ -3751,8 +3751,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS, &params);
         logger.info("   <--- urKernelSetSpecializationConstants({}) -> {};\n",
                     args_str.str(), result);
@@ -3790,8 +3790,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE, &params);
         logger.info("   <--- urKernelGetNativeHandle({}) -> {};\n",
                     args_str.str(), result);
@@ -3837,8 +3837,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE, &params);
         logger.info("   <--- urKernelCreateWithNativeHandle({}) -> {};\n",
                     args_str.str(), result);
@@ -3892,8 +3892,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE,
             &params);
         logger.info("   <--- urKernelGetSuggestedLocalWorkSize({}) -> {};\n",
@@ -3937,8 +3937,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_GET_INFO,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_QUEUE_GET_INFO,
                                         &params);
         logger.info("   <--- urQueueGetInfo({}) -> {};\n", args_str.str(),
                     result);
@@ -3977,8 +3977,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_CREATE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_QUEUE_CREATE,
                                         &params);
         logger.info("   <--- urQueueCreate({}) -> {};\n", args_str.str(),
                     result);
@@ -4012,8 +4012,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_RETAIN,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_QUEUE_RETAIN,
                                         &params);
         logger.info("   <--- urQueueRetain({}) -> {};\n", args_str.str(),
                     result);
@@ -4047,8 +4047,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_RELEASE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_QUEUE_RELEASE,
                                         &params);
         logger.info("   <--- urQueueRelease({}) -> {};\n", args_str.str(),
                     result);
@@ -4087,8 +4087,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE, &params);
         logger.info("   <--- urQueueGetNativeHandle({}) -> {};\n",
                     args_str.str(), result);
@@ -4133,8 +4133,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE, &params);
         logger.info("   <--- urQueueCreateWithNativeHandle({}) -> {};\n",
                     args_str.str(), result);
@@ -4167,8 +4167,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_FINISH,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_QUEUE_FINISH,
                                         &params);
         logger.info("   <--- urQueueFinish({}) -> {};\n", args_str.str(),
                     result);
@@ -4201,8 +4201,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueFlush(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_FLUSH,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_QUEUE_FLUSH,
                                         &params);
         logger.info("   <--- urQueueFlush({}) -> {};\n", args_str.str(),
                     result);
@@ -4243,8 +4243,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_EVENT_GET_INFO,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_EVENT_GET_INFO,
                                         &params);
         logger.info("   <--- urEventGetInfo({}) -> {};\n", args_str.str(),
                     result);
@@ -4291,8 +4291,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_EVENT_GET_PROFILING_INFO, &params);
         logger.info("   <--- urEventGetProfilingInfo({}) -> {};\n",
                     args_str.str(), result);
@@ -4328,8 +4328,8 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_EVENT_WAIT,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_EVENT_WAIT,
                                         &params);
         logger.info("   <--- urEventWait({}) -> {};\n", args_str.str(), result);
     }
@@ -4361,8 +4361,8 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_EVENT_RETAIN,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_EVENT_RETAIN,
                                         &params);
         logger.info("   <--- urEventRetain({}) -> {};\n", args_str.str(),
                     result);
@@ -4395,8 +4395,8 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_EVENT_RELEASE,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_EVENT_RELEASE,
                                         &params);
         logger.info("   <--- urEventRelease({}) -> {};\n", args_str.str(),
                     result);
@@ -4432,8 +4432,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_EVENT_GET_NATIVE_HANDLE, &params);
         logger.info("   <--- urEventGetNativeHandle({}) -> {};\n",
                     args_str.str(), result);
@@ -4477,8 +4477,8 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE, &params);
         logger.info("   <--- urEventCreateWithNativeHandle({}) -> {};\n",
                     args_str.str(), result);
@@ -4517,8 +4517,8 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
                              "urEventSetCallback", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_EVENT_SET_CALLBACK, &params);
         logger.info("   <--- urEventSetCallback({}) -> {};\n", args_str.str(),
                     result);
@@ -4587,8 +4587,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH, &params);
         logger.info("   <--- urEnqueueKernelLaunch({}) -> {};\n",
                     args_str.str(), result);
@@ -4634,8 +4634,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
                              "urEnqueueEventsWait", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_EVENTS_WAIT, &params);
         logger.info("   <--- urEnqueueEventsWait({}) -> {};\n", args_str.str(),
                     result);
@@ -4684,8 +4684,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER, &params);
         logger.info("   <--- urEnqueueEventsWaitWithBarrier({}) -> {};\n",
                     args_str.str(), result);
@@ -4740,8 +4740,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ, &params);
         logger.info("   <--- urEnqueueMemBufferRead({}) -> {};\n",
                     args_str.str(), result);
@@ -4799,8 +4799,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE, &params);
         logger.info("   <--- urEnqueueMemBufferWrite({}) -> {};\n",
                     args_str.str(), result);
@@ -4880,8 +4880,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT, &params);
         logger.info("   <--- urEnqueueMemBufferReadRect({}) -> {};\n",
                     args_str.str(), result);
@@ -4964,8 +4964,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT, &params);
         logger.info("   <--- urEnqueueMemBufferWriteRect({}) -> {};\n",
                     args_str.str(), result);
@@ -5020,8 +5020,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY, &params);
         logger.info("   <--- urEnqueueMemBufferCopy({}) -> {};\n",
                     args_str.str(), result);
@@ -5090,8 +5090,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT, &params);
         logger.info("   <--- urEnqueueMemBufferCopyRect({}) -> {};\n",
                     args_str.str(), result);
@@ -5151,8 +5151,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL, &params);
         logger.info("   <--- urEnqueueMemBufferFill({}) -> {};\n",
                     args_str.str(), result);
@@ -5213,8 +5213,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ, &params);
         logger.info("   <--- urEnqueueMemImageRead({}) -> {};\n",
                     args_str.str(), result);
@@ -5276,8 +5276,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE, &params);
         logger.info("   <--- urEnqueueMemImageWrite({}) -> {};\n",
                     args_str.str(), result);
@@ -5338,8 +5338,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY, &params);
         logger.info("   <--- urEnqueueMemImageCopy({}) -> {};\n",
                     args_str.str(), result);
@@ -5396,8 +5396,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP, &params);
         logger.info("   <--- urEnqueueMemBufferMap({}) -> {};\n",
                     args_str.str(), result);
@@ -5447,8 +5447,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_ENQUEUE_MEM_UNMAP,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_ENQUEUE_MEM_UNMAP,
                                         &params);
         logger.info("   <--- urEnqueueMemUnmap({}) -> {};\n", args_str.str(),
                     result);
@@ -5504,8 +5504,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_ENQUEUE_USM_FILL,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_ENQUEUE_USM_FILL,
                                         &params);
         logger.info("   <--- urEnqueueUSMFill({}) -> {};\n", args_str.str(),
                     result);
@@ -5558,8 +5558,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
                              "urEnqueueUSMMemcpy", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_USM_MEMCPY, &params);
         logger.info("   <--- urEnqueueUSMMemcpy({}) -> {};\n", args_str.str(),
                     result);
@@ -5611,8 +5611,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_USM_PREFETCH, &params);
         logger.info("   <--- urEnqueueUSMPrefetch({}) -> {};\n", args_str.str(),
                     result);
@@ -5653,8 +5653,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
                              "urEnqueueUSMAdvise", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_USM_ADVISE, &params);
         logger.info("   <--- urEnqueueUSMAdvise({}) -> {};\n", args_str.str(),
                     result);
@@ -5714,8 +5714,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
                              "urEnqueueUSMFill2D", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_USM_FILL_2D, &params);
         logger.info("   <--- urEnqueueUSMFill2D({}) -> {};\n", args_str.str(),
                     result);
@@ -5776,8 +5776,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D, &params);
         logger.info("   <--- urEnqueueUSMMemcpy2D({}) -> {};\n", args_str.str(),
                     result);
@@ -5836,8 +5836,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE,
             &params);
         logger.info("   <--- urEnqueueDeviceGlobalVariableWrite({}) -> {};\n",
@@ -5897,8 +5897,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ, &params);
         logger.info("   <--- urEnqueueDeviceGlobalVariableRead({}) -> {};\n",
                     args_str.str(), result);
@@ -5960,8 +5960,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_READ_HOST_PIPE, &params);
         logger.info("   <--- urEnqueueReadHostPipe({}) -> {};\n",
                     args_str.str(), result);
@@ -6024,8 +6024,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE, &params);
         logger.info("   <--- urEnqueueWriteHostPipe({}) -> {};\n",
                     args_str.str(), result);
@@ -6076,8 +6076,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_USM_PITCHED_ALLOC_EXP, &params);
         logger.info("   <--- urUSMPitchedAllocExp({}) -> {};\n", args_str.str(),
                     result);
@@ -6121,8 +6121,8 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str,
             UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP,
             &params);
@@ -6170,8 +6170,8 @@ urBindlessImagesSampledImageHandleDestroyExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str,
             UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP,
             &params);
@@ -6218,8 +6218,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP, &params);
         logger.info("   <--- urBindlessImagesImageAllocateExp({}) -> {};\n",
                     args_str.str(), result);
@@ -6259,8 +6259,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP, &params);
         logger.info("   <--- urBindlessImagesImageFreeExp({}) -> {};\n",
                     args_str.str(), result);
@@ -6306,8 +6306,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
         "urBindlessImagesUnsampledImageCreateExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP,
             &params);
         logger.info(
@@ -6358,8 +6358,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
         "urBindlessImagesSampledImageCreateExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP,
             &params);
         logger.info(
@@ -6435,8 +6435,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP, &params);
         logger.info("   <--- urBindlessImagesImageCopyExp({}) -> {};\n",
                     args_str.str(), result);
@@ -6479,8 +6479,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP, &params);
         logger.info("   <--- urBindlessImagesImageGetInfoExp({}) -> {};\n",
                     args_str.str(), result);
@@ -6524,8 +6524,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP,
             &params);
         logger.info("   <--- urBindlessImagesMipmapGetLevelExp({}) -> {};\n",
@@ -6566,8 +6566,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP, &params);
         logger.info("   <--- urBindlessImagesMipmapFreeExp({}) -> {};\n",
                     args_str.str(), result);
@@ -6615,8 +6615,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
         "urBindlessImagesImportExternalMemoryExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP,
             &params);
         logger.info(
@@ -6665,8 +6665,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP,
             &params);
         logger.info("   <--- urBindlessImagesMapExternalArrayExp({}) -> {};\n",
@@ -6713,8 +6713,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str,
             UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP,
             &params);
@@ -6758,8 +6758,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
         "urBindlessImagesReleaseExternalMemoryExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP,
             &params);
         logger.info(
@@ -6810,8 +6810,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP,
             &params);
         logger.info(
@@ -6856,8 +6856,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str,
             UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP,
             &params);
@@ -6920,8 +6920,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
         "urBindlessImagesWaitExternalSemaphoreExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP,
             &params);
         logger.info(
@@ -6985,8 +6985,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP,
             &params);
         logger.info(
@@ -7030,8 +7030,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCreateExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP, &params);
         logger.info("   <--- urCommandBufferCreateExp({}) -> {};\n",
                     args_str.str(), result);
@@ -7067,8 +7067,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP, &params);
         logger.info("   <--- urCommandBufferRetainExp({}) -> {};\n",
                     args_str.str(), result);
@@ -7105,8 +7105,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP, &params);
         logger.info("   <--- urCommandBufferReleaseExp({}) -> {};\n",
                     args_str.str(), result);
@@ -7143,8 +7143,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP, &params);
         logger.info("   <--- urCommandBufferFinalizeExp({}) -> {};\n",
                     args_str.str(), result);
@@ -7238,8 +7238,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         "urCommandBufferAppendKernelLaunchExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP,
             &params);
         logger.info("   <--- urCommandBufferAppendKernelLaunchExp({}) -> {};\n",
@@ -7312,8 +7312,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP,
             &params);
         logger.info("   <--- urCommandBufferAppendUSMMemcpyExp({}) -> {};\n",
@@ -7389,8 +7389,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP, &params);
         logger.info("   <--- urCommandBufferAppendUSMFillExp({}) -> {};\n",
                     args_str.str(), result);
@@ -7466,8 +7466,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
         "urCommandBufferAppendMemBufferCopyExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP,
             &params);
         logger.info(
@@ -7544,8 +7544,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
         "urCommandBufferAppendMemBufferWriteExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP,
             &params);
         logger.info(
@@ -7621,8 +7621,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
         "urCommandBufferAppendMemBufferReadExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP,
             &params);
         logger.info(
@@ -7713,8 +7713,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str,
             UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP,
             &params);
@@ -7813,8 +7813,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str,
             UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP,
             &params);
@@ -7910,8 +7910,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str,
             UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP,
             &params);
@@ -7991,8 +7991,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
         "urCommandBufferAppendMemBufferFillExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP,
             &params);
         logger.info(
@@ -8066,8 +8066,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP,
             &params);
         logger.info("   <--- urCommandBufferAppendUSMPrefetchExp({}) -> {};\n",
@@ -8140,8 +8140,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP,
             &params);
         logger.info("   <--- urCommandBufferAppendUSMAdviseExp({}) -> {};\n",
@@ -8193,8 +8193,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP, &params);
         logger.info("   <--- urCommandBufferEnqueueExp({}) -> {};\n",
                     args_str.str(), result);
@@ -8231,8 +8231,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP, &params);
         logger.info("   <--- urCommandBufferRetainCommandExp({}) -> {};\n",
                     args_str.str(), result);
@@ -8269,8 +8269,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP, &params);
         logger.info("   <--- urCommandBufferReleaseCommandExp({}) -> {};\n",
                     args_str.str(), result);
@@ -8311,8 +8311,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
         "urCommandBufferUpdateKernelLaunchExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP,
             &params);
         logger.info("   <--- urCommandBufferUpdateKernelLaunchExp({}) -> {};\n",
@@ -8352,8 +8352,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateSignalEventExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_UPDATE_SIGNAL_EVENT_EXP,
             &params);
         logger.info("   <--- urCommandBufferUpdateSignalEventExp({}) -> {};\n",
@@ -8398,8 +8398,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateWaitEventsExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_UPDATE_WAIT_EVENTS_EXP,
             &params);
         logger.info("   <--- urCommandBufferUpdateWaitEventsExp({}) -> {};\n",
@@ -8448,8 +8448,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP, &params);
         logger.info("   <--- urCommandBufferGetInfoExp({}) -> {};\n",
                     args_str.str(), result);
@@ -8497,8 +8497,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP, &params);
         logger.info("   <--- urCommandBufferCommandGetInfoExp({}) -> {};\n",
                     args_str.str(), result);
@@ -8570,8 +8570,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP,
             &params);
         logger.info("   <--- urEnqueueCooperativeKernelLaunchExp({}) -> {};\n",
@@ -8625,8 +8625,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str,
             UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP,
             &params);
@@ -8686,8 +8686,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP, &params);
         logger.info("   <--- urEnqueueTimestampRecordingExp({}) -> {};\n",
                     args_str.str(), result);
@@ -8767,8 +8767,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP, &params);
         logger.info("   <--- urEnqueueKernelLaunchCustomExp({}) -> {};\n",
                     args_str.str(), result);
@@ -8807,8 +8807,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_BUILD_EXP,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_BUILD_EXP,
                                         &params);
         logger.info("   <--- urProgramBuildExp({}) -> {};\n", args_str.str(),
                     result);
@@ -8849,8 +8849,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
                              "urProgramCompileExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_PROGRAM_COMPILE_EXP, &params);
         logger.info("   <--- urProgramCompileExp({}) -> {};\n", args_str.str(),
                     result);
@@ -8899,8 +8899,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_LINK_EXP,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_LINK_EXP,
                                         &params);
         logger.info("   <--- urProgramLinkExp({}) -> {};\n", args_str.str(),
                     result);
@@ -8935,8 +8935,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_IMPORT_EXP,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_USM_IMPORT_EXP,
                                         &params);
         logger.info("   <--- urUSMImportExp({}) -> {};\n", args_str.str(),
                     result);
@@ -8970,8 +8970,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_RELEASE_EXP,
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(args_str, UR_FUNCTION_USM_RELEASE_EXP,
                                         &params);
         logger.info("   <--- urUSMReleaseExp({}) -> {};\n", args_str.str(),
                     result);
@@ -9010,8 +9010,8 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP, &params);
         logger.info("   <--- urUsmP2PEnablePeerAccessExp({}) -> {};\n",
                     args_str.str(), result);
@@ -9050,8 +9050,8 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP, &params);
         logger.info("   <--- urUsmP2PDisablePeerAccessExp({}) -> {};\n",
                     args_str.str(), result);
@@ -9104,8 +9104,8 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP, &params);
         logger.info("   <--- urUsmP2PPeerAccessGetInfoExp({}) -> {};\n",
                     args_str.str(), result);
@@ -9157,8 +9157,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrierExt(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER_EXT,
             &params);
         logger.info("   <--- urEnqueueEventsWaitWithBarrierExt({}) -> {};\n",
@@ -9226,8 +9226,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP, &params);
         logger.info("   <--- urEnqueueNativeCommandExp({}) -> {};\n",
                     args_str.str(), result);
@@ -9313,8 +9313,8 @@ __urdlllocal ur_result_t UR_APICALL urTensorMapEncodeIm2ColExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_TENSOR_MAP_ENCODE_IM_2_COL_EXP, &params);
         logger.info("   <--- urTensorMapEncodeIm2ColExp({}) -> {};\n",
                     args_str.str(), result);
@@ -9386,8 +9386,8 @@ __urdlllocal ur_result_t UR_APICALL urTensorMapEncodeTiledExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
+        auto args_str = ur::writer::stringBuffer(getArgsStorage());
+        ur::writer::printFunctionParams(
             args_str, UR_FUNCTION_TENSOR_MAP_ENCODE_TILED_EXP, &params);
         logger.info("   <--- urTensorMapEncodeTiledExp({}) -> {};\n",
                     args_str.str(), result);
@@ -0,0 +1,42 @@
+/*
+ *
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+#include "backtrace.hpp"
+
+#include <vector>
+
+namespace ur_validation_layer {
+
+BacktraceId getCurrentBacktrace() { return stack_depot::capture(1); }
+
+std::vector<std::vector<BacktraceLine>>
+getBacktraceLines(const std::vector<BacktraceId> &backtraces) {
+    stack_depot::symbolizer symbolizer;
+    for (auto id : backtraces) {
+        symbolizer.add(id);
+    }
+    symbolizer.resolve();
+
+    std::vector<std::vector<BacktraceLine>> lines;
+    for (auto id : backtraces) {
+        auto &backtrace = lines.emplace_back();
+        auto frames = stack_depot::get(id);
+        if (frames.empty()) {
+            backtrace.emplace_back("Failed to acquire a backtrace");
+            continue;
+        }
+        for (void *pc : frames) {
+            backtrace.push_back(symbolizer.frame(pc).symbol);
+        }
+    }
+
+    return lines;
+}
+
+} // namespace ur_validation_layer
@@ -5,6 +5,7 @@
 #ifndef UR_BACKTRACE_H
 #define UR_BACKTRACE_H 1
 
+#include "ur_stack_depot.hpp"
 #include "ur_validation_layer.hpp"
 
 #define MAX_BACKTRACE_FRAMES 64
@@ -12,7 +13,15 @@
 namespace ur_validation_layer {
 
 using BacktraceLine = std::string;
-std::vector<BacktraceLine> getCurrentBacktrace();
+using BacktraceId = stack_depot::stack_id_t;
+
+// Records the current call stack in the stack depot, it is only symbolized
+// if it ends up being reported.
+BacktraceId getCurrentBacktrace();
+
+// Symbolizes a batch of recorded call stacks, one line per frame.
+std::vector<std::vector<BacktraceLine>>
+getBacktraceLines(const std::vector<BacktraceId> &backtraces);
 
 } // namespace ur_validation_layer
 
@@ -12,6 +12,7 @@
 #include <backtrace.h>
 #include <cxxabi.h>
 #include <limits.h>
+#include <sstream>
 #include <vector>
 
 namespace ur_validation_layer {
@@ -30,7 +31,9 @@ void filter_after_occurence(std::vector<BacktraceLine> &backtrace,
 
 int backtrace_cb(void *data, uintptr_t pc, const char *filename, int lineno,
                  const char *function) {
-    if (filename == NULL && function == NULL) {
+    auto *frame = reinterpret_cast<stack_depot::frame_t *>(data);
+    // Inlined calls report every inlining level, only the innermost is kept.
+    if (!frame->symbol.empty() || (filename == NULL && function == NULL)) {
         return 0;
     }
 
@@ -49,21 +52,15 @@ int backtrace_cb(void *data, uintptr_t pc, const char *filename, int lineno,
     }
 
     char filepath[PATH_MAX];
-    if (realpath(filename, filepath) != NULL) {
+    if (filename != NULL && realpath(filename, filepath) != NULL) {
         backtraceLine << "(" << filepath << ":" << std::dec << lineno << ")";
     } else {
         // Note: Escaping the last '?' character to avoid creation of a trigraph character
         backtraceLine << "(???????\?)";
     }
 
-    std::vector<std::string> *backtrace =
-        reinterpret_cast<std::vector<std::string> *>(data);
     try {
-        if (backtraceLine.str().empty()) {
-            backtrace->push_back("????????");
-        } else {
-            backtrace->push_back(backtraceLine.str());
-        }
+        frame->symbol = backtraceLine.str();
     } catch (std::bad_alloc &) {
     }
 
@@ -72,21 +69,50 @@ int backtrace_cb(void *data, uintptr_t pc, const char *filename, int lineno,
     return 0;
 }
 
-std::vector<BacktraceLine> getCurrentBacktrace() {
-    backtrace_state *state = backtrace_create_state(NULL, 0, NULL, NULL);
+void error_cb(void *, const char *, int) {}
+
+// Looks up every frame of a module with libbacktrace, the debug information
+// of a module is only read once per process.
+void symbolizeModule(const std::string &,
+                     std::vector<stack_depot::frame_t *> &frames) {
+    static backtrace_state *state = backtrace_create_state(NULL, 1, NULL, NULL);
     if (state == NULL) {
-        return std::vector<std::string>(1, "Failed to acquire a backtrace");
+        return;
     }
-
-    std::vector<BacktraceLine> backtrace;
-    backtrace_full(state, 0, backtrace_cb, NULL, &backtrace);
-    if (backtrace.empty()) {
-        return std::vector<std::string>(1, "Failed to acquire a backtrace");
+    for (auto *frame : frames) {
+        // The frames are return addresses, look up the call instruction.
+        backtrace_pcinfo(state, reinterpret_cast<uintptr_t>(frame->pc) - 1,
+                         backtrace_cb, error_cb, frame);
     }
+}
+
+BacktraceId getCurrentBacktrace() { return stack_depot::capture(1); }
 
-    filter_after_occurence(backtrace, "ur_libapi.cpp");
+std::vector<std::vector<BacktraceLine>>
+getBacktraceLines(const std::vector<BacktraceId> &backtraces) {
+    stack_depot::symbolizer symbolizer(symbolizeModule);
+    for (auto id : backtraces) {
+        symbolizer.add(id);
+    }
+    symbolizer.resolve();
+
+    std::vector<std::vector<BacktraceLine>> lines;
+    for (auto id : backtraces) {
+        auto &backtrace = lines.emplace_back();
+        for (void *pc : stack_depot::get(id)) {
+            auto &symbol = symbolizer.frame(pc).symbol;
+            if (!symbol.empty()) {
+                backtrace.push_back(symbol);
+            }
+        }
+        if (backtrace.empty()) {
+            backtrace.emplace_back("Failed to acquire a backtrace");
+            continue;
+        }
+        filter_after_occurence(backtrace, "ur_libapi.cpp");
+    }
 
-    return backtrace;
+    return lines;
 }
 
 } // namespace ur_validation_layer
@@ -8,7 +8,10 @@
 #include "backtrace.hpp"
 #include "ur_validation_layer.hpp"
 
+#include <array>
+#include <atomic>
 #include <mutex>
+#include <shared_mutex>
 #include <typeindex>
 #include <unordered_map>
 #include <utility>
@@ -22,10 +25,10 @@ struct RefCountContext {
     struct RefRuntimeInfo {
         int64_t refCount;
         std::type_index type;
-        std::vector<BacktraceLine> backtrace;
+        BacktraceId backtrace;
 
         RefRuntimeInfo(int64_t refCount, std::type_index type,
-                       std::vector<BacktraceLine> backtrace)
+                       BacktraceId backtrace)
             : refCount(refCount), type(type), backtrace(backtrace) {}
     };
 
@@ -36,16 +39,32 @@ struct RefCountContext {
         REFCOUNT_DECREASE,
     };
 
-    std::mutex mutex;
-    std::unordered_map<void *, struct RefRuntimeInfo> counts;
-    int64_t adapterCount = 0;
+    // Handles are spread over shards with their own reader-writer lock, so
+    // that the lifetime lookups done for every handle argument of every call
+    // run concurrently and rarely share a lock with a create or release.
+    static constexpr size_t NumShards = 16;
+
+    struct Shard {
+        std::shared_mutex mutex;
+        std::unordered_map<void *, struct RefRuntimeInfo> counts;
+    };
+
+    std::array<Shard, NumShards> shards;
+    std::atomic<int64_t> adapterCount = 0;
+
+    Shard &getShard(void *ptr) {
+        // The low bits of a handle are mostly alignment.
+        return shards[(reinterpret_cast<uintptr_t>(ptr) >> 4) % NumShards];
+    }
 
     template <typename T>
     void updateRefCount(T handle, enum RefCountUpdateType type,
                         bool isAdapterHandle = false) {
-        std::unique_lock<std::mutex> ulock(mutex);
-
         void *ptr = static_cast<void *>(handle);
+        auto &shard = getShard(ptr);
+        std::unique_lock<std::shared_mutex> ulock(shard.mutex);
+
+        auto &counts = shard.counts;
         auto it = counts.find(ptr);
 
         switch (type) {
@@ -105,11 +124,15 @@ struct RefCountContext {
         if (it->second.refCount == 0) {
             counts.erase(ptr);
         }
+        ulock.unlock();
 
         // No more active adapters, so any references still held are leaked
         if (adapterCount == 0) {
             logInvalidReferences();
-            counts.clear();
+            for (auto &other : shards) {
+                std::unique_lock<std::shared_mutex> lock(other.mutex);
+                other.counts.clear();
+            }
         }
     }
 
@@ -134,9 +157,11 @@ struct RefCountContext {
     }
 
     template <typename T> bool isReferenceValid(T handle) {
-        std::unique_lock<std::mutex> lock(mutex);
-        auto it = counts.find(static_cast<void *>(handle));
-        if (it == counts.end() || it->second.refCount < 1) {
+        void *ptr = static_cast<void *>(handle);
+        auto &shard = getShard(ptr);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        auto it = shard.counts.find(ptr);
+        if (it == shard.counts.end() || it->second.refCount < 1) {
             return false;
         }
 
@@ -144,14 +169,32 @@ struct RefCountContext {
     }
 
     void logInvalidReferences() {
-        for (auto &[ptr, refRuntimeInfo] : counts) {
+        struct Leak {
+            void *ptr;
+            int64_t refCount;
+        };
+        std::vector<Leak> leaks;
+        std::vector<BacktraceId> backtraces;
+        for (auto &shard : shards) {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            for (auto &[ptr, refRuntimeInfo] : shard.counts) {
+                leaks.push_back({ptr, refRuntimeInfo.refCount});
+                backtraces.push_back(refRuntimeInfo.backtrace);
+            }
+        }
+        if (leaks.empty()) {
+            return;
+        }
+
+        // All of the reported stacks are symbolized in a single batch.
+        auto lines = getBacktraceLines(backtraces);
+        for (size_t leak = 0; leak < leaks.size(); leak++) {
             getContext()->logger.error("Retained {} reference(s) to handle {}",
-                                       refRuntimeInfo.refCount, ptr);
+                                       leaks[leak].refCount, leaks[leak].ptr);
             getContext()->logger.error(
-                "Handle {} was recorded for first time here:", ptr);
-            for (size_t i = 0; i < refRuntimeInfo.backtrace.size(); i++) {
-                getContext()->logger.error("#{} {}", i,
-                                           refRuntimeInfo.backtrace[i].c_str());
+                "Handle {} was recorded for first time here:", leaks[leak].ptr);
+            for (size_t i = 0; i < lines[leak].size(); i++) {
+                getContext()->logger.error("#{} {}", i, lines[leak][i].c_str());
             }
         }
     }
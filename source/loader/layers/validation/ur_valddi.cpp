@@ -35,7 +35,7 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGet(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NumEntries == 0 && phAdapters != NULL) {
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
@@ -65,7 +65,7 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hAdapter) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -91,7 +91,7 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hAdapter) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -124,7 +124,7 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hAdapter) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -169,7 +169,7 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hAdapter) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -226,7 +226,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == phAdapters) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
@@ -267,7 +267,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hPlatform) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -307,7 +307,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hPlatform) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -336,7 +336,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hPlatform) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -370,7 +370,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hAdapter) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -408,7 +408,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hPlatform) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -451,7 +451,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hPlatform) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -505,7 +505,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -550,7 +550,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -577,7 +577,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -613,7 +613,7 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -658,7 +658,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -701,7 +701,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -740,7 +740,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hAdapter) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -783,7 +783,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -817,7 +817,7 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == phDevices) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
@@ -853,7 +853,7 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -880,7 +880,7 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -918,7 +918,7 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -965,7 +965,7 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1008,7 +1008,7 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hAdapter) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1050,7 +1050,7 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1087,7 +1087,7 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1177,7 +1177,7 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1240,7 +1240,7 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hMem) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1267,7 +1267,7 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hMem) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1300,7 +1300,7 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1353,7 +1353,7 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hMem) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1396,7 +1396,7 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1442,7 +1442,7 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1498,7 +1498,7 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hMemory) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1553,7 +1553,7 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hMemory) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1600,7 +1600,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1649,7 +1649,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hSampler) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1676,7 +1676,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hSampler) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1710,7 +1710,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hSampler) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1757,7 +1757,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hSampler) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1795,7 +1795,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1838,7 +1838,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1895,7 +1895,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1962,7 +1962,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2022,7 +2022,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2063,7 +2063,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2103,7 +2103,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2146,7 +2146,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == pPool) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2172,7 +2172,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == pPool) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2205,7 +2205,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hPool) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2264,7 +2264,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2322,7 +2322,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2356,7 +2356,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2396,7 +2396,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2444,7 +2444,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2480,7 +2480,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2528,7 +2528,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2572,7 +2572,7 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2623,7 +2623,7 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hPhysicalMem) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2650,7 +2650,7 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hPhysicalMem) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2682,7 +2682,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2751,7 +2751,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2817,7 +2817,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2857,7 +2857,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2903,7 +2903,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2944,7 +2944,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2971,7 +2971,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3007,7 +3007,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3063,7 +3063,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3120,7 +3120,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3177,7 +3177,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3223,7 +3223,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3262,7 +3262,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3300,7 +3300,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3339,7 +3339,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3385,7 +3385,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3422,7 +3422,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3462,7 +3462,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3516,7 +3516,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3569,7 +3569,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3610,7 +3610,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3637,7 +3637,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3669,7 +3669,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3704,7 +3704,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3744,7 +3744,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3785,7 +3785,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3827,7 +3827,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3866,7 +3866,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3906,7 +3906,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3962,7 +3962,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4020,7 +4020,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4069,7 +4069,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4130,7 +4130,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4157,7 +4157,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4187,7 +4187,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4226,7 +4226,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4267,7 +4267,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4294,7 +4294,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueFlush(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4327,7 +4327,7 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4381,7 +4381,7 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4420,7 +4420,7 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == phEventWaitList) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
@@ -4446,7 +4446,7 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4472,7 +4472,7 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4500,7 +4500,7 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4538,7 +4538,7 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4578,7 +4578,7 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4643,7 +4643,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4668,11 +4668,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -4716,7 +4718,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4729,11 +4731,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -4772,7 +4776,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4785,11 +4789,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -4832,7 +4838,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4860,11 +4866,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
             }
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -4915,7 +4923,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4943,11 +4951,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
             }
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -5009,7 +5019,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5077,11 +5087,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
             }
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -5147,7 +5159,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5215,11 +5227,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
             }
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -5270,7 +5284,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5305,11 +5319,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
             }
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -5374,7 +5390,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5445,11 +5461,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
             }
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -5504,7 +5522,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5552,11 +5570,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
             }
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -5610,7 +5630,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5642,11 +5662,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
             }
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -5701,7 +5723,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5733,11 +5755,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
             }
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -5793,7 +5817,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5832,11 +5856,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
             }
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -5892,7 +5918,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5924,11 +5950,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
             }
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -5974,7 +6002,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5995,11 +6023,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -6050,7 +6080,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6090,11 +6120,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
             }
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -6138,7 +6170,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6177,11 +6209,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
             }
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -6223,7 +6257,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6255,11 +6289,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
             }
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -6294,7 +6330,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6362,7 +6398,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6422,11 +6458,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
             }
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -6475,7 +6513,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6530,11 +6568,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
             }
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -6581,7 +6621,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6606,11 +6646,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -6662,7 +6704,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6687,11 +6729,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -6747,7 +6791,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6772,11 +6816,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -6833,7 +6879,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6858,11 +6904,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -6908,7 +6956,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6978,7 +7026,7 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7021,7 +7069,7 @@ urBindlessImagesSampledImageHandleDestroyExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7065,7 +7113,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7122,7 +7170,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7167,7 +7215,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7230,7 +7278,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7318,7 +7366,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7365,11 +7413,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
             return UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -7404,7 +7454,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7447,7 +7497,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7492,7 +7542,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7537,7 +7587,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7596,7 +7646,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7661,7 +7711,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7710,7 +7760,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7760,7 +7810,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7816,7 +7866,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7877,7 +7927,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7886,11 +7936,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -7939,7 +7991,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7948,11 +8000,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -7985,7 +8039,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCreateExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8027,7 +8081,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8051,7 +8105,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8075,7 +8129,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8137,7 +8191,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8178,11 +8232,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -8235,7 +8291,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8268,11 +8324,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -8321,7 +8379,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8362,11 +8420,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -8415,7 +8475,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8444,11 +8504,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -8507,7 +8569,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8536,11 +8598,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -8593,7 +8657,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8622,11 +8686,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -8687,7 +8753,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8716,11 +8782,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -8794,7 +8862,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8823,11 +8891,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -8893,7 +8963,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8922,11 +8992,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -8982,7 +9054,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9011,11 +9083,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -9067,7 +9141,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9100,11 +9174,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -9151,7 +9227,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9184,11 +9260,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -9225,7 +9303,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9242,11 +9320,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -9275,7 +9355,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommand) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9299,7 +9379,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommand) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9325,7 +9405,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommand) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9360,7 +9440,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateSignalEventExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommand) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9393,7 +9473,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateWaitEventsExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommand) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9406,11 +9486,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateWaitEventsExp(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -9443,7 +9525,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9493,7 +9575,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hCommand) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9558,7 +9640,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9583,11 +9665,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -9633,7 +9717,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9690,7 +9774,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9707,11 +9791,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -9769,7 +9855,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9790,11 +9876,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -9833,7 +9921,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9870,7 +9958,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9915,7 +10003,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9961,7 +10049,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9993,7 +10081,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -10027,7 +10115,7 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == commandDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -10066,7 +10154,7 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == commandDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -10116,7 +10204,7 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == commandDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -10184,7 +10272,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrierExt(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -10202,11 +10290,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrierExt(
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -10255,7 +10345,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -10269,11 +10359,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
 
-        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
-            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
-                if (phEventWaitList[i] == NULL) {
-                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
-                }
+    }
+
+    if (getContext()->enableWaitListChecks && phEventWaitList != NULL &&
+        numEventsInWaitList > 0) {
+        for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+            if (phEventWaitList[i] == NULL) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
             }
         }
     }
@@ -10333,7 +10425,7 @@ __urdlllocal ur_result_t UR_APICALL urTensorMapEncodeIm2ColExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -10446,7 +10538,7 @@ __urdlllocal ur_result_t UR_APICALL urTensorMapEncodeTiledExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableParameterChecks) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -11909,6 +12001,8 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
         return result;
     }
 
+    applyCheckOptions();
+
     if (UR_RESULT_SUCCESS == result) {
         result = ur_validation_layer::urGetGlobalProcAddrTable(
             UR_API_VERSION_CURRENT, &dditable->Global);
@@ -13,6 +13,7 @@
 #include "ur_leak_check.hpp"
 
 #include <cassert>
+#include <stdexcept>
 
 namespace ur_validation_layer {
 context_t *getContext() { return context_t::get_direct(); }
@@ -25,6 +26,55 @@ context_t::context_t()
 ///////////////////////////////////////////////////////////////////////////////
 context_t::~context_t() {}
 
+///////////////////////////////////////////////////////////////////////////////
+void context_t::applyCheckOptions() {
+    enableParameterChecks = enableParameterValidation;
+    enableWaitListChecks = enableParameterValidation;
+
+    std::optional<EnvVarMap> options;
+    try {
+        options = getenv_to_map("UR_LAYER_VALIDATION_OPTIONS");
+    } catch (const std::invalid_argument &e) {
+        logger.error("Failed to parse UR_LAYER_VALIDATION_OPTIONS: {}",
+                     e.what());
+        return;
+    }
+    if (!options.has_value()) {
+        return;
+    }
+
+    for (const auto &[name, values] : *options) {
+        bool *check = nullptr;
+        if (name == "params") {
+            check = &enableParameterChecks;
+        } else if (name == "wait_list") {
+            check = &enableWaitListChecks;
+        } else if (name == "lifetime") {
+            check = &enableLifetimeValidation;
+        } else {
+            logger.warning("Unknown UR_LAYER_VALIDATION_OPTIONS option {}",
+                           name);
+            continue;
+        }
+
+        const auto &value = values.front();
+        if (value == "1" || value == "true") {
+            *check = true;
+        } else if (value == "0" || value == "false") {
+            *check = false;
+        } else {
+            logger.error("UR_LAYER_VALIDATION_OPTIONS option {} is set to {}, "
+                         "expected 0, 1, true or false",
+                         name, value);
+        }
+    }
+
+    // Lifetime validation looks up the handles recorded by leak checking.
+    if (enableLifetimeValidation) {
+        enableLeakChecking = true;
+    }
+}
+
 // Some adapters don't support all the queries yet, we should be lenient and
 // just not attempt to validate in those cases to preserve functionality.
 #define RETURN_ON_FAILURE(result)                                              \
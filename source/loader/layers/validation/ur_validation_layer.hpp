@@ -27,6 +27,12 @@ class __urdlllocal context_t : public proxy_layer_context_t,
     bool enableBoundsChecking = false;
     bool enableLeakChecking = false;
     bool enableLifetimeValidation = false;
+
+    // Cost classes of the generated checks, enabled along with parameter
+    // validation and adjustable through UR_LAYER_VALIDATION_OPTIONS. Lifetime
+    // checks are controlled by enableLifetimeValidation.
+    bool enableParameterChecks = false;
+    bool enableWaitListChecks = false;
     logger::Logger logger;
 
     ur_dditable_t urDdiTable = {};
@@ -42,6 +48,7 @@ class __urdlllocal context_t : public proxy_layer_context_t,
                      const std::set<std::string> &enabledLayerNames,
                      codeloc_data codelocData) override;
     ur_result_t tearDown() override;
+    void applyCheckOptions();
 
     std::unique_ptr<RefCountContext> refCountContext;
 
@@ -217,7 +217,8 @@ class AdapterRegistry {
                 (strcmp(backend.c_str(), "level_zero") != 0) &&
                 (strcmp(backend.c_str(), "opencl") != 0) &&
                 (strcmp(backend.c_str(), "cuda") != 0) &&
-                (strcmp(backend.c_str(), "hip") != 0)) {
+                (strcmp(backend.c_str(), "hip") != 0) &&
+                (strcmp(backend.c_str(), "native_cpu") != 0)) {
                 logger::debug("ONEAPI_DEVICE_SELECTOR Pre-Filter with illegal "
                               "backend '{}' ",
                               backend);
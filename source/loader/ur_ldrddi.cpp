@@ -32,32 +32,47 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGet(
 
     [[maybe_unused]] auto context = getContext();
 
-    size_t adapterIndex = 0;
-    if (nullptr != phAdapters && NumEntries != 0) {
-        for (auto &platform : context->platforms) {
-            if (platform.initStatus != UR_RESULT_SUCCESS) {
-                continue;
+    // Adapters which failed to initialize are not reported, neither by the
+    // count nor by the handles.
+    context->initAdapters();
+
+    uint32_t numAdapters = 0;
+    ur_result_t initResult = UR_RESULT_SUCCESS;
+    for (auto &platform : context->platforms) {
+        if (platform.initStatus != UR_RESULT_SUCCESS) {
+            if (initResult == UR_RESULT_SUCCESS) {
+                initResult = platform.initStatus;
+            }
+            continue;
+        }
+        if (nullptr != phAdapters && numAdapters < NumEntries) {
+            auto hAdapter = context->takeInitAdapter(platform);
+            if (nullptr == hAdapter) {
+                result = platform.dditable.ur.Global.pfnAdapterGet(
+                    1, &hAdapter, nullptr);
+                if (result != UR_RESULT_SUCCESS) {
+                    break;
+                }
             }
-            platform.dditable.ur.Global.pfnAdapterGet(
-                1, &phAdapters[adapterIndex], nullptr);
             try {
-                phAdapters[adapterIndex] =
-                    reinterpret_cast<ur_adapter_handle_t>(
-                        context->factories.ur_adapter_factory.getInstance(
-                            phAdapters[adapterIndex], &platform.dditable));
+                phAdapters[numAdapters] = reinterpret_cast<ur_adapter_handle_t>(
+                    context->factories.ur_adapter_factory.getInstance(
+                        hAdapter, &platform.dditable));
             } catch (std::bad_alloc &) {
                 result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
                 break;
             }
-            adapterIndex++;
-            if (adapterIndex == NumEntries) {
-                break;
-            }
         }
+        numAdapters++;
+    }
+
+    if (nullptr != phAdapters && NumEntries != 0 && numAdapters == 0 &&
+        result == UR_RESULT_SUCCESS) {
+        result = initResult;
     }
 
     if (pNumAdapters != nullptr) {
-        *pNumAdapters = static_cast<uint32_t>(context->platforms.size());
+        *pNumAdapters = numAdapters;
     }
 
     return result;
@@ -12,10 +12,35 @@
 #include "adapters/level_zero/ur_interface_loader.hpp"
 #endif
 
+#include <chrono>
+#include <utility>
+
 namespace ur_loader {
 ///////////////////////////////////////////////////////////////////////////////
 context_t *getContext() { return context_t::get_direct(); }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Try every candidate path of a single adapter until one of them
+///        loads, logging how long the attempt took.
+static LibLoader::Lib loadAdapter(const std::vector<fs::path> &adapterPaths) {
+    auto start = std::chrono::steady_clock::now();
+    LibLoader::Lib handle;
+    for (const auto &path : adapterPaths) {
+        handle = LibLoader::loadAdapterLibrary(path.string().c_str());
+        if (handle) {
+            break;
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+    if (!adapterPaths.empty()) {
+        logger::info("adapter '{}' {} in {} us",
+                     adapterPaths.front().filename().string(),
+                     handle ? "loaded" : "not found", elapsed.count());
+    }
+    return handle;
+}
+
 ur_result_t context_t::init() {
 #ifdef _WIN32
     // Suppress system errors.
@@ -38,13 +63,13 @@ ur_result_t context_t::init() {
     }
 #endif
 
+    // The libraries are opened sequentially, dlopen serializes on the
+    // dynamic loader lock anyway. The expensive part, the initialization of
+    // the driver stacks, is done concurrently by urAdapterGet.
     for (const auto &adapterPaths : adapter_registry) {
-        for (const auto &path : adapterPaths) {
-            auto handle = LibLoader::loadAdapterLibrary(path.string().c_str());
-            if (handle) {
-                platforms.emplace_back(std::move(handle));
-                break;
-            }
+        auto handle = loadAdapter(adapterPaths);
+        if (handle) {
+            platforms.emplace_back(std::move(handle));
         }
     }
 #ifdef _WIN32
@@ -61,4 +86,62 @@ ur_result_t context_t::init() {
     return UR_RESULT_SUCCESS;
 }
 
+context_t::~context_t() {
+    // Handles which no urAdapterGet call has retrieved are still owned by the
+    // loader.
+    for (auto &platform : platforms) {
+        if (platform.initAdapter) {
+            platform.dditable.ur.Global.pfnAdapterRelease(platform.initAdapter);
+        }
+    }
+}
+
+void context_t::initAdapters() {
+    std::call_once(adaptersInitFlag, [this]() {
+        // Adapter initialization probes independent driver stacks, so the
+        // adapters are initialized concurrently when enabled.
+        auto initAdapter = [this](size_t i) {
+            auto &platform = platforms[i];
+            if (platform.initStatus != UR_RESULT_SUCCESS) {
+                return;
+            }
+            auto start = std::chrono::steady_clock::now();
+            platform.initStatus = platform.dditable.ur.Global.pfnAdapterGet(
+                1, &platform.initAdapter, nullptr);
+            auto elapsed =
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start);
+            if (platform.initStatus != UR_RESULT_SUCCESS) {
+                platform.initAdapter = nullptr;
+                logger::info("adapter {} failed to initialize in {} us: {}", i,
+                             elapsed.count(), platform.initStatus);
+            } else {
+                logger::info("adapter {} initialized in {} us", i,
+                             elapsed.count());
+            }
+        };
+
+        if (!parallelInit || platforms.size() < 2) {
+            for (size_t i = 0; i < platforms.size(); ++i) {
+                initAdapter(i);
+            }
+            return;
+        }
+
+        std::vector<std::thread> workers;
+        workers.reserve(platforms.size());
+        for (size_t i = 0; i < platforms.size(); ++i) {
+            workers.emplace_back(initAdapter, i);
+        }
+        for (auto &worker : workers) {
+            worker.join();
+        }
+    });
+}
+
+ur_adapter_handle_t context_t::takeInitAdapter(platform_t &platform) {
+    std::scoped_lock<std::mutex> lock(initAdaptersMutex);
+    return std::exchange(platform.initAdapter, nullptr);
+}
+
 } // namespace ur_loader
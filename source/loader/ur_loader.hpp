@@ -16,6 +16,9 @@
 #include "ur_ldrddi.hpp"
 #include "ur_lib_loader.hpp"
 
+#include <mutex>
+#include <thread>
+
 namespace ur_loader {
 
 struct platform_t {
@@ -25,6 +28,9 @@ struct platform_t {
     std::unique_ptr<HMODULE, LibLoader::lib_dtor> handle;
     ur_result_t initStatus = UR_RESULT_SUCCESS;
     dditable_t dditable = {};
+    // Adapter handle obtained when the adapter was initialized, handed over
+    // to the first urAdapterGet call which retrieves handles.
+    ur_adapter_handle_t initAdapter = nullptr;
 };
 
 using platform_vector_t = std::vector<platform_t>;
@@ -38,10 +44,34 @@ class context_t : public AtomicSingleton<context_t> {
 
     bool forceIntercept = false;
 
+#if defined(_WIN32)
+    bool parallelInit = getenv_tobool("UR_LOADER_PARALLEL_INIT", false);
+#else
+    bool parallelInit = getenv_tobool("UR_LOADER_PARALLEL_INIT", true);
+#endif
+
     ur_result_t init();
     bool intercept_enabled = false;
 
+    ~context_t();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Initialize every adapter on first use, using one thread per
+    ///        adapter when parallel adapter initialization is enabled.
+    ///        Adapters which fail to initialize keep the error in their
+    ///        initStatus and are no longer reported.
+    void initAdapters();
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// @brief Take the adapter handle of the platform obtained by
+    ///        initAdapters, nullptr if it has already been taken.
+    ur_adapter_handle_t takeInitAdapter(platform_t &platform);
+
     struct handle_factories factories;
+
+  private:
+    std::once_flag adaptersInitFlag;
+    std::mutex initAdaptersMutex;
 };
 
 context_t *getContext();
@@ -10,7 +10,10 @@
 //===----------------------------------------------------------------------===//
 
 #include "ur.hpp"
+#include "logger/ur_logger.hpp"
+#include <algorithm>
 #include <cassert>
+#include <map>
 
 // Controls tracing UR calls from within the UR itself.
 bool PrintTrace = [] {
@@ -31,3 +34,87 @@ bool PrintTrace = [] {
   }
   return false;
 }();
+
+namespace {
+struct lock_site_registry_t {
+  std::mutex Mutex;
+  std::map<std::string, ur_lock_site_t> Sites;
+};
+
+// Read on first use, global locks may be constructed before the globals of
+// this file are initialized.
+bool lockStatsEnabled() {
+  static const bool Enabled = getenv_tobool("UR_LOCK_STATS");
+  return Enabled;
+}
+
+// The registry is never destroyed, so that global locks can still be used
+// while static objects are being destroyed.
+lock_site_registry_t &getLockSiteRegistry() {
+  static auto *Registry = new lock_site_registry_t;
+  return *Registry;
+}
+} // namespace
+
+ur_lock_site_t *urLockSite(const char *Name) {
+  if (!LockStatsBuilt || !lockStatsEnabled()) {
+    return nullptr;
+  }
+  auto &Registry = getLockSiteRegistry();
+  std::lock_guard<std::mutex> Lock(Registry.Mutex);
+  auto It = Registry.Sites.find(Name);
+  if (It == Registry.Sites.end()) {
+    It = Registry.Sites.try_emplace(Name, nullptr).first;
+    It->second.Name = It->first.c_str();
+  }
+  return &It->second;
+}
+
+std::vector<ur_lock_stats_t> urLockStatsGet() {
+  std::vector<ur_lock_stats_t> Stats;
+  if (!LockStatsBuilt || !lockStatsEnabled()) {
+    return Stats;
+  }
+  auto &Registry = getLockSiteRegistry();
+  std::lock_guard<std::mutex> Lock(Registry.Mutex);
+  for (auto &Entry : Registry.Sites) {
+    auto &Site = Entry.second;
+    if (Site.Acquisitions.load()) {
+      Stats.push_back({Entry.first, Site.Acquisitions.load(),
+                       Site.Contended.load(), Site.WaitNs.load(),
+                       Site.HoldNs.load()});
+    }
+  }
+  std::sort(Stats.begin(), Stats.end(),
+            [](const auto &A, const auto &B) { return A.WaitNs > B.WaitNs; });
+  return Stats;
+}
+
+void urLockStatsReset() {
+  if (!LockStatsBuilt || !lockStatsEnabled()) {
+    return;
+  }
+  auto &Registry = getLockSiteRegistry();
+  std::lock_guard<std::mutex> Lock(Registry.Mutex);
+  for (auto &Entry : Registry.Sites) {
+    Entry.second.Acquisitions = 0;
+    Entry.second.Contended = 0;
+    Entry.second.WaitNs = 0;
+    Entry.second.HoldNs = 0;
+  }
+}
+
+void urLockStatsReport() {
+  if (!LockStatsBuilt || !lockStatsEnabled()) {
+    return;
+  }
+  auto Stats = urLockStatsGet();
+  logger::always("lock contention statistics of {} lock sites:",
+                 Stats.size());
+  for (const auto &Site : Stats) {
+    logger::always("lock site '{}': {} acquisitions, {} contended, {} us "
+                   "waiting, {} us held",
+                   Site.Name, Site.Acquisitions, Site.Contended,
+                   Site.WaitNs / 1000, Site.HoldNs / 1000);
+  }
+}
@@ -11,6 +11,7 @@
 
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <functional>
@@ -76,32 +77,148 @@ static const bool SingleThreadMode = [] {
   return RetVal;
 }();
 
+// Lock contention statistics. When built with UR_ENABLE_LOCK_STATS and run
+// with the UR_LOCK_STATS environment variable set, every lock site accumulates
+// how many times its locks were acquired, how many of those acquisitions had
+// to wait for another thread, the total time spent waiting and the total time
+// the locks were held exclusively. Mutexes constructed without a site name are
+// accounted under "unnamed", a SpinLock is only tracked if it is named.
+#ifdef UR_ENABLE_LOCK_STATS
+constexpr bool LockStatsBuilt = true;
+#else
+constexpr bool LockStatsBuilt = false;
+#endif
+
+struct ur_lock_site_t {
+  const char *Name;
+  std::atomic<uint64_t> Acquisitions{0};
+  std::atomic<uint64_t> Contended{0};
+  std::atomic<uint64_t> WaitNs{0};
+  std::atomic<uint64_t> HoldNs{0};
+
+  explicit ur_lock_site_t(const char *Name) : Name(Name) {}
+
+  static uint64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+  // Acquires a lock through TryLock, falling back to the blocking Lock and
+  // timing the wait if the lock is already held. Returns the time at which
+  // the lock was acquired.
+  template <class TryLockT, class LockT>
+  uint64_t acquire(TryLockT &&TryLock, LockT &&Lock) {
+    Acquisitions.fetch_add(1, std::memory_order_relaxed);
+    if (TryLock()) {
+      return now();
+    }
+    auto Start = now();
+    Lock();
+    auto Acquired = now();
+    Contended.fetch_add(1, std::memory_order_relaxed);
+    WaitNs.fetch_add(Acquired - Start, std::memory_order_relaxed);
+    return Acquired;
+  }
+
+  bool tryAcquire(bool Acquired, uint64_t &AcquiredAt) {
+    if (Acquired) {
+      Acquisitions.fetch_add(1, std::memory_order_relaxed);
+      AcquiredAt = now();
+    }
+    return Acquired;
+  }
+
+  void release(uint64_t AcquiredAt) {
+    HoldNs.fetch_add(now() - AcquiredAt, std::memory_order_relaxed);
+  }
+};
+
+// Statistics of one lock site, as returned by urLockStatsGet.
+struct ur_lock_stats_t {
+  std::string Name;
+  uint64_t Acquisitions;
+  uint64_t Contended;
+  uint64_t WaitNs;
+  uint64_t HoldNs;
+};
+
+// Returns the statistics of the named lock site, or nullptr if lock
+// statistics are disabled.
+ur_lock_site_t *urLockSite(const char *Name);
+
+// Returns the statistics of every lock site that was acquired at least once,
+// sorted by decreasing total wait time.
+std::vector<ur_lock_stats_t> urLockStatsGet();
+
+// Resets the statistics of every lock site.
+void urLockStatsReset();
+
+// Logs the statistics of every lock site that was acquired at least once.
+void urLockStatsReport();
+
 // Class which acts like shared_mutex if SingleThreadMode variable is not set.
 // If SingleThreadMode variable is set then mutex operations are turned into
-// nop.
+// nop. Only exclusive ownership is accounted in the hold time.
 class ur_shared_mutex {
   std::shared_mutex Mutex;
+  ur_lock_site_t *Site;
+  uint64_t AcquiredAt = 0;
 
 public:
+  ur_shared_mutex() : ur_shared_mutex("unnamed") {}
+  explicit ur_shared_mutex(const char *SiteName)
+      : Site(urLockSite(SiteName)) {}
+
   void lock() {
-    if (!SingleThreadMode) {
+    if (SingleThreadMode) {
+      return;
+    }
+    if (LockStatsBuilt && Site) {
+      AcquiredAt = Site->acquire([&] { return Mutex.try_lock(); },
+                                 [&] { Mutex.lock(); });
+    } else {
       Mutex.lock();
     }
   }
-  bool try_lock() { return SingleThreadMode ? true : Mutex.try_lock(); }
+  bool try_lock() {
+    if (SingleThreadMode) {
+      return true;
+    }
+    if (LockStatsBuilt && Site) {
+      return Site->tryAcquire(Mutex.try_lock(), AcquiredAt);
+    }
+    return Mutex.try_lock();
+  }
   void unlock() {
     if (!SingleThreadMode) {
+      if (LockStatsBuilt && Site) {
+        Site->release(AcquiredAt);
+      }
       Mutex.unlock();
     }
   }
 
   void lock_shared() {
-    if (!SingleThreadMode) {
+    if (SingleThreadMode) {
+      return;
+    }
+    if (LockStatsBuilt && Site) {
+      Site->acquire([&] { return Mutex.try_lock_shared(); },
+                    [&] { Mutex.lock_shared(); });
+    } else {
       Mutex.lock_shared();
     }
   }
   bool try_lock_shared() {
-    return SingleThreadMode ? true : Mutex.try_lock_shared();
+    if (SingleThreadMode) {
+      return true;
+    }
+    if (LockStatsBuilt && Site) {
+      uint64_t Unused;
+      return Site->tryAcquire(Mutex.try_lock_shared(), Unused);
+    }
+    return Mutex.try_lock_shared();
   }
   void unlock_shared() {
     if (!SingleThreadMode) {
@@ -115,31 +232,48 @@ public:
 // nop.
 class ur_mutex {
   std::mutex Mutex;
-  friend class ur_lock;
+  ur_lock_site_t *Site;
+  uint64_t AcquiredAt = 0;
 
 public:
+  ur_mutex() : ur_mutex("unnamed") {}
+  explicit ur_mutex(const char *SiteName) : Site(urLockSite(SiteName)) {}
+
   void lock() {
-    if (!SingleThreadMode) {
+    if (SingleThreadMode) {
+      return;
+    }
+    if (LockStatsBuilt && Site) {
+      AcquiredAt = Site->acquire([&] { return Mutex.try_lock(); },
+                                 [&] { Mutex.lock(); });
+    } else {
       Mutex.lock();
     }
   }
-  bool try_lock() { return SingleThreadMode ? true : Mutex.try_lock(); }
+  bool try_lock() {
+    if (SingleThreadMode) {
+      return true;
+    }
+    if (LockStatsBuilt && Site) {
+      return Site->tryAcquire(Mutex.try_lock(), AcquiredAt);
+    }
+    return Mutex.try_lock();
+  }
   void unlock() {
     if (!SingleThreadMode) {
+      if (LockStatsBuilt && Site) {
+        Site->release(AcquiredAt);
+      }
       Mutex.unlock();
     }
   }
 };
 
 class ur_lock {
-  std::unique_lock<std::mutex> Lock;
+  std::unique_lock<ur_mutex> Lock;
 
 public:
-  explicit ur_lock(ur_mutex &Mutex) {
-    if (!SingleThreadMode) {
-      Lock = std::unique_lock<std::mutex>(Mutex.Mutex);
-    }
-  }
+  explicit ur_lock(ur_mutex &Mutex) : Lock(Mutex) {}
 };
 
 /// SpinLock is a synchronization primitive, that uses atomic variable and
@@ -149,18 +283,39 @@ public:
 /// One important feature of this implementation is that std::atomic<bool> can
 /// be zero-initialized. This allows SpinLock to have trivial constructor and
 /// destructor, which makes it possible to use it in global context (unlike
-/// std::mutex, that doesn't provide such guarantees).
+/// std::mutex, that doesn't provide such guarantees). This only holds for
+/// unnamed spin locks, naming one registers it for lock statistics.
 class SpinLock {
 public:
+  SpinLock() = default;
+  explicit SpinLock(const char *SiteName) : Site(urLockSite(SiteName)) {}
+
   void lock() {
+    if (LockStatsBuilt && Site) {
+      AcquiredAt = Site->acquire(
+          [&] { return !MLock.test_and_set(std::memory_order_acquire); },
+          [&] { spin(); });
+    } else {
+      spin();
+    }
+  }
+  void unlock() {
+    if (LockStatsBuilt && Site) {
+      Site->release(AcquiredAt);
+    }
+    MLock.clear(std::memory_order_release);
+  }
+
+private:
+  void spin() {
     while (MLock.test_and_set(std::memory_order_acquire)) {
       std::this_thread::yield();
     }
   }
-  void unlock() { MLock.clear(std::memory_order_release); }
 
-private:
   std::atomic_flag MLock = ATOMIC_FLAG_INIT;
+  ur_lock_site_t *Site = nullptr;
+  uint64_t AcquiredAt = 0;
 };
 
 // The wrapper for immutable data.
@@ -6,16 +6,14 @@
 #include "ur_print.hpp"
 #include "uur/fixtures.h"
 #include "uur/raii.h"
+#include "ze_call_stats.hpp"
 
-#include <map>
 #include <string>
 
 template <typename... Args> auto combineFlags(std::tuple<Args...> tuple) {
     return std::apply([](auto... args) { return (... |= args); }, tuple);
 }
 
-extern std::map<std::string, int> *ZeCallCount;
-
 using FlagsTupleType = std::tuple<ur_queue_flags_t, ur_queue_flags_t,
                                   ur_queue_flags_t, ur_queue_flags_t>;
 
@@ -43,8 +41,8 @@ struct urEventCacheTest : uur::urContextTestWithParam<FlagsTupleType> {
         ASSERT_SUCCESS(urMemBufferCreate(context, UR_MEM_FLAG_WRITE_ONLY, size,
                                          nullptr, &buffer));
 
-        (*ZeCallCount)["zeEventCreate"] = 0;
-        (*ZeCallCount)["zeEventDestroy"] = 0;
+        ZeCallStats.resetCalls("zeEventCreate");
+        ZeCallStats.resetCalls("zeEventDestroy");
     }
 
     void TearDown() override {
@@ -96,9 +94,10 @@ TEST_P(urEventCacheTest, eventsReuseNoVisibleEvent) {
     // TODO: why events are not reused for UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE?
     if ((flags & UR_QUEUE_FLAG_DISCARD_EVENTS) &&
         !(flags & UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE)) {
-        ASSERT_EQ((*ZeCallCount)["zeEventCreate"], 2);
+        ASSERT_EQ(ZeCallStats.getCalls("zeEventCreate"), 2u);
     } else {
-        ASSERT_GE((*ZeCallCount)["zeEventCreate"], numIters * numEnqueues);
+        ASSERT_GE(ZeCallStats.getCalls("zeEventCreate"),
+                  uint64_t(numIters * numEnqueues));
     }
 }
 
@@ -115,7 +114,8 @@ TEST_P(urEventCacheTest, eventsReuseWithVisibleEvent) {
         verifyData();
     }
 
-    ASSERT_LT((*ZeCallCount)["zeEventCreate"], numIters * numEnqueues);
+    ASSERT_LT(ZeCallStats.getCalls("zeEventCreate"),
+              uint64_t(numIters * numEnqueues));
 }
 
 TEST_P(urEventCacheTest, eventsReuseWithVisibleEventAndWait) {
@@ -139,9 +139,9 @@ TEST_P(urEventCacheTest, eventsReuseWithVisibleEventAndWait) {
         UUR_ASSERT_SUCCESS_OR_EXIT_IF_UNSUPPORTED(urQueueFinish(queue));
     }
 
-    ASSERT_GE((*ZeCallCount)["zeEventCreate"], waitEveryN);
+    ASSERT_GE(ZeCallStats.getCalls("zeEventCreate"), uint64_t(waitEveryN));
     // TODO: why there are more events than this?
-    // ASSERT_LE((*ZeCallCount)["zeEventCreate"],  waitEveryN * 2 + 2);
+    // ASSERT_LE(ZeCallStats.getCalls("zeEventCreate"),  waitEveryN * 2 + 2);
 }
 
 template <typename T>
@@ -0,0 +1,139 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "ur_print.hpp"
+#include "uur/fixtures.h"
+#include "uur/raii.h"
+#include "ze_call_stats.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+// The completion of many events is found out with a few queries of fences,
+// batch barriers or of the last event, these tests count the queries of the
+// events themselves.
+struct urEventCompletionTest
+    : uur::urContextTestWithParam<ur_queue_flags_t> {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(urContextTestWithParam::SetUp());
+
+        ur_queue_properties_t props{UR_STRUCTURE_TYPE_QUEUE_PROPERTIES,
+                                    nullptr, getParam()};
+        ASSERT_SUCCESS(urQueueCreate(context, device, &props, &queue));
+        ASSERT_SUCCESS(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE,
+                                         size, nullptr, &buffer));
+        input.assign(count, 42);
+    }
+
+    void TearDown() override {
+        for (auto event : events) {
+            EXPECT_SUCCESS(urEventRelease(event));
+        }
+        if (buffer) {
+            EXPECT_SUCCESS(urMemRelease(buffer));
+        }
+        if (queue) {
+            EXPECT_SUCCESS(urQueueRelease(queue));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(urContextTestWithParam::TearDown());
+    }
+
+    void enqueueWork() {
+        events.resize(numEvents);
+        for (auto &event : events) {
+            ASSERT_SUCCESS(urEnqueueMemBufferWrite(queue, buffer, false, 0,
+                                                   size, input.data(), 0,
+                                                   nullptr, &event));
+        }
+    }
+
+    ur_event_status_t getStatus(ur_event_handle_t event) {
+        ur_event_status_t status;
+        EXPECT_SUCCESS(urEventGetInfo(event,
+                                      UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                                      sizeof(status), &status, nullptr));
+        return status;
+    }
+
+    bool isInOrder() const {
+        return !(getParam() & UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE);
+    }
+
+    static constexpr int numEvents = 64;
+    static constexpr size_t count = 1024;
+    static constexpr size_t size = sizeof(uint32_t) * count;
+
+    ur_queue_handle_t queue = nullptr;
+    ur_mem_handle_t buffer = nullptr;
+    std::vector<uint32_t> input;
+    std::vector<ur_event_handle_t> events;
+};
+
+inline std::string printFlags(
+    const testing::TestParamInfo<urEventCompletionTest::ParamType> &info) {
+    const auto device_handle = std::get<0>(info.param);
+    const auto platform_device_name =
+        uur::GetPlatformAndDeviceName(device_handle);
+
+    std::stringstream ss;
+    ur::details::printFlag<ur_queue_flag_t>(ss, std::get<1>(info.param));
+
+    auto str = ss.str();
+    std::replace(str.begin(), str.end(), ' ', '_');
+    std::replace(str.begin(), str.end(), '|', '_');
+    return platform_device_name + "__" + str;
+}
+
+UUR_TEST_SUITE_P(
+    urEventCompletionTest,
+    testing::Values(UR_QUEUE_FLAG_SUBMISSION_BATCHED,
+                    UR_QUEUE_FLAG_SUBMISSION_IMMEDIATE,
+                    UR_QUEUE_FLAG_SUBMISSION_BATCHED |
+                        UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE),
+    printFlags);
+
+TEST_P(urEventCompletionTest, WaitForManyEvents) {
+    UUR_RETURN_ON_FATAL_FAILURE(enqueueWork());
+
+    ZeCallStats.resetCalls("zeHostSynchronize");
+    ASSERT_SUCCESS(urEventWait(events.size(), events.data()));
+
+    // The last event of an in-order queue completes after all the others.
+    if (isInOrder() && (getParam() & UR_QUEUE_FLAG_SUBMISSION_IMMEDIATE)) {
+        ASSERT_EQ(ZeCallStats.getCalls("zeHostSynchronize"), 1u);
+    } else {
+        ASSERT_LE(ZeCallStats.getCalls("zeHostSynchronize"),
+                  uint64_t(numEvents));
+    }
+
+    for (auto event : events) {
+        ASSERT_EQ(getStatus(event), UR_EVENT_STATUS_COMPLETE);
+    }
+}
+
+TEST_P(urEventCompletionTest, PollManyEvents) {
+    if (getParam() & UR_QUEUE_FLAG_SUBMISSION_IMMEDIATE) {
+        GTEST_SKIP() << "Immediate command lists have no fences";
+    }
+
+    UUR_RETURN_ON_FATAL_FAILURE(enqueueWork());
+
+    // Poll as an application would, until all the events have completed.
+    ZeCallStats.resetCalls("zeEventQueryStatus");
+    size_t numCompleted = 0;
+    while (numCompleted < events.size()) {
+        numCompleted = 0;
+        for (auto event : events) {
+            if (getStatus(event) == UR_EVENT_STATUS_COMPLETE) {
+                numCompleted++;
+            }
+        }
+    }
+
+    // Querying every event until it completes would succeed at least once
+    // per event.
+    ASSERT_LT(ZeCallStats.getCalls("zeEventQueryStatus"), uint64_t(numEvents));
+}
@@ -0,0 +1,291 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "fake_driver.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <unordered_map>
+
+namespace ze_fake {
+
+const config_t &config_t::get() {
+    static const config_t config = [] {
+        config_t config;
+        if (const char *devices = std::getenv("ZE_FAKE_DEVICES")) {
+            config.deviceCount = std::strtoul(devices, nullptr, 10);
+        }
+        if (const char *latency = std::getenv("ZE_FAKE_LATENCY_NS")) {
+            config.defaultLatencyNs = std::strtoull(latency, nullptr, 10);
+        }
+        if (const char *latencies = std::getenv("ZE_FAKE_LATENCY")) {
+            std::stringstream stream(latencies);
+            std::string entry;
+            while (std::getline(stream, entry, ',')) {
+                auto colon = entry.find(':');
+                if (colon == std::string::npos) {
+                    std::fprintf(stderr,
+                                 "ze_fake: ignoring ZE_FAKE_LATENCY entry "
+                                 "'%s', expected name:nanoseconds\n",
+                                 entry.c_str());
+                    continue;
+                }
+                config.latencyNs[entry.substr(0, colon)] =
+                    std::stoull(entry.substr(colon + 1));
+            }
+        }
+        if (const char *print = std::getenv("ZE_FAKE_PRINT_CALLS")) {
+            config.printCalls = std::string(print) != "0";
+        }
+        return config;
+    }();
+    return config;
+}
+
+namespace {
+struct call_registry_t {
+    std::mutex mutex;
+    // A deque, so that registering a call does not move the others.
+    std::deque<call_t> calls;
+
+    ~call_registry_t() {
+        if (!config_t::get().printCalls) {
+            return;
+        }
+        std::fprintf(stderr, "ze_fake: %llu kernel launches\n",
+                     static_cast<unsigned long long>(
+                         engine_t::get().launches()));
+        for (const auto &call : calls) {
+            std::fprintf(stderr, "ze_fake: %s %llu\n", call.name,
+                         static_cast<unsigned long long>(call.count.load()));
+        }
+    }
+};
+
+call_registry_t &getRegistry() {
+    static call_registry_t registry;
+    return registry;
+}
+} // namespace
+
+call_t &registerCall(const char *name) {
+    const auto &config = config_t::get();
+    auto latency = config.latencyNs.find(name);
+    auto &registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto &call = registry.calls.emplace_back();
+    call.name = name;
+    call.latencyNs = latency == config.latencyNs.end() ? config.defaultLatencyNs
+                                                       : latency->second;
+    return call;
+}
+
+engine_t &engine_t::get() {
+    // Leaked, so that streams destroyed during exit can still be forgotten.
+    static engine_t *engine = new engine_t();
+    return *engine;
+}
+
+void engine_t::submit(stream_t &stream, std::vector<command_t> commands) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &command : commands) {
+        if (command.signal && command.signal->pool->counterBased) {
+            command.signal->signaled.store(false, std::memory_order_relaxed);
+        }
+        stream.pending.push_back(std::move(command));
+    }
+    progress(&stream);
+}
+
+bool engine_t::run(stream_t &stream) {
+    bool ran = false;
+    while (!stream.pending.empty()) {
+        auto &command = stream.pending.front();
+        for (auto event : command.waits) {
+            if (!event->signaled.load(std::memory_order_relaxed)) {
+                blocked.insert(&stream);
+                return ran;
+            }
+        }
+
+        uint64_t start = now();
+        switch (command.kind) {
+        case command_t::kind_t::nop:
+            break;
+        case command_t::kind_t::reset:
+            command.event->signaled.store(false, std::memory_order_relaxed);
+            break;
+        case command_t::kind_t::work:
+            command.work();
+            break;
+        case command_t::kind_t::fence:
+            command.fence->signaled = true;
+            break;
+        }
+        if (command.signal) {
+            command.signal->start = start;
+            command.signal->end = now();
+            command.signal->signaled.store(true, std::memory_order_release);
+        }
+        stream.pending.pop_front();
+        ran = true;
+    }
+    blocked.erase(&stream);
+    return ran;
+}
+
+void engine_t::progress(stream_t *stream) {
+    // Commands that complete may signal events that blocked streams wait for,
+    // so those are revisited until nothing more runs.
+    bool ran = stream ? run(*stream) : true;
+    while (ran && !blocked.empty()) {
+        ran = false;
+        for (auto it = blocked.begin(); it != blocked.end();) {
+            // run() removes the stream from blocked when it drains it.
+            stream_t *next = *it++;
+            ran |= run(*next);
+        }
+    }
+    completed.notify_all();
+}
+
+template <typename Pred>
+ze_result_t engine_t::waitFor(std::unique_lock<std::mutex> &lock,
+                              uint64_t timeout, Pred pred) {
+    if (timeout == UINT64_MAX) {
+        completed.wait(lock, pred);
+        return ZE_RESULT_SUCCESS;
+    }
+    return completed.wait_for(lock, std::chrono::nanoseconds(timeout), pred)
+               ? ZE_RESULT_SUCCESS
+               : ZE_RESULT_NOT_READY;
+}
+
+ze_result_t engine_t::waitStream(stream_t &stream, uint64_t timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    return waitFor(lock, timeout, [&] { return stream.pending.empty(); });
+}
+
+void engine_t::forget(stream_t &stream) {
+    std::lock_guard<std::mutex> lock(mutex);
+    blocked.erase(&stream);
+}
+
+void engine_t::hostSignal(ze_event_handle_t event) {
+    std::lock_guard<std::mutex> lock(mutex);
+    event->start = event->end = now();
+    event->signaled.store(true, std::memory_order_release);
+    progress(nullptr);
+}
+
+void engine_t::hostReset(ze_event_handle_t event) {
+    std::lock_guard<std::mutex> lock(mutex);
+    event->signaled.store(false, std::memory_order_relaxed);
+}
+
+ze_result_t engine_t::waitEvent(ze_event_handle_t event, uint64_t timeout) {
+    if (event->signaled.load(std::memory_order_acquire)) {
+        return ZE_RESULT_SUCCESS;
+    }
+    if (timeout == 0) {
+        return ZE_RESULT_NOT_READY;
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    return waitFor(lock, timeout, [&] {
+        return event->signaled.load(std::memory_order_relaxed);
+    });
+}
+
+ze_result_t engine_t::waitFence(ze_fence_handle_t fence, uint64_t timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    return waitFor(lock, timeout, [&] { return fence->signaled; });
+}
+
+void engine_t::resetFence(ze_fence_handle_t fence) {
+    std::lock_guard<std::mutex> lock(mutex);
+    fence->signaled = false;
+}
+
+command_t makeCommand(ze_event_handle_t signal, uint32_t numWaitEvents,
+                      ze_event_handle_t *waitEvents,
+                      std::function<void()> work) {
+    command_t command;
+    if (work) {
+        command.kind = command_t::kind_t::work;
+        command.work = std::move(work);
+    }
+    command.signal = signal;
+    if (numWaitEvents) {
+        command.waits.assign(waitEvents, waitEvents + numWaitEvents);
+    }
+    return command;
+}
+
+std::vector<kernel_info_t> parseSpirv(const uint8_t *data, size_t size) {
+    constexpr uint32_t magic = 0x07230203;
+    constexpr uint32_t opEntryPoint = 15;
+    constexpr uint32_t opFunction = 54;
+    constexpr uint32_t opFunctionParameter = 55;
+    constexpr uint32_t executionModelKernel = 6;
+    constexpr size_t headerWords = 5;
+
+    size_t count = size / sizeof(uint32_t);
+    if (count < headerWords) {
+        return {};
+    }
+    std::vector<uint32_t> words(count);
+    std::memcpy(words.data(), data, count * sizeof(uint32_t));
+    if (words[0] != magic) {
+        return {};
+    }
+
+    std::vector<std::pair<uint32_t, std::string>> entryPoints;
+    std::unordered_map<uint32_t, uint32_t> paramCounts;
+    uint32_t function = 0;
+    for (size_t i = headerWords; i < count;) {
+        uint32_t opcode = words[i] & 0xffff;
+        uint32_t length = words[i] >> 16;
+        if (length == 0 || i + length > count) {
+            break;
+        }
+        if (opcode == opEntryPoint && length > 3 &&
+            words[i + 1] == executionModelKernel) {
+            const char *name = reinterpret_cast<const char *>(&words[i + 3]);
+            size_t maxLength = (length - 3) * sizeof(uint32_t);
+            entryPoints.emplace_back(words[i + 2],
+                                     std::string(name, strnlen(name, maxLength)));
+        } else if (opcode == opFunction && length > 2) {
+            function = words[i + 2];
+            paramCounts[function] = 0;
+        } else if (opcode == opFunctionParameter) {
+            paramCounts[function]++;
+        }
+        i += length;
+    }
+
+    std::vector<kernel_info_t> kernels;
+    for (auto &[id, name] : entryPoints) {
+        kernels.push_back({std::move(name), paramCounts[id]});
+    }
+    return kernels;
+}
+
+} // namespace ze_fake
+
+void _ze_command_list_handle_t::append(ze_fake::command_t command) {
+    if (!immediate) {
+        commands.push_back(std::move(command));
+        return;
+    }
+    std::vector<ze_fake::command_t> submitted;
+    submitted.push_back(std::move(command));
+    auto &engine = ze_fake::engine_t::get();
+    engine.submit(stream, std::move(submitted));
+    if (mode == ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS) {
+        engine.waitStream(stream, UINT64_MAX);
+    }
+}
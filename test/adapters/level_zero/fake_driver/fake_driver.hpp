@@ -0,0 +1,232 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Host-only model of a Level Zero driver, exported under the name of the
+// Level Zero loader so that the adapters can run on machines without an Intel
+// GPU. Commands are executed on the host in submission order, kernels do not
+// run at all, and every entry point can be given a latency to emulate the
+// cost of the real driver.
+
+#pragma once
+
+#include <ze_api.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace ze_fake {
+
+using clock = std::chrono::steady_clock;
+
+inline uint64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               clock::now().time_since_epoch())
+        .count();
+}
+
+/// Settings read from the environment on first use:
+///   ZE_FAKE_DEVICES        number of devices of the driver (default 1)
+///   ZE_FAKE_LATENCY_NS     latency of every entry point (default 0)
+///   ZE_FAKE_LATENCY        per entry point latencies, as a list of
+///                          name:nanoseconds separated by commas
+///   ZE_FAKE_PRINT_CALLS    print the entry point call counts at exit
+struct config_t {
+    uint32_t deviceCount = 1;
+    uint64_t defaultLatencyNs = 0;
+    std::map<std::string, uint64_t> latencyNs;
+    bool printCalls = false;
+
+    static const config_t &get();
+};
+
+/// Statistics and latency of one entry point.
+struct call_t {
+    const char *name;
+    uint64_t latencyNs;
+    std::atomic<uint64_t> count{0};
+
+    /// Counts the call and spins for the configured latency. Spinning rather
+    /// than sleeping keeps the calling thread busy, like a real driver.
+    void enter() {
+        count.fetch_add(1, std::memory_order_relaxed);
+        if (latencyNs) {
+            auto end = clock::now() + std::chrono::nanoseconds(latencyNs);
+            while (clock::now() < end) {
+            }
+        }
+    }
+};
+
+call_t &registerCall(const char *name);
+
+/// Counts a call of the enclosing entry point and applies its latency.
+#define ZE_FAKE_ENTER()                                                        \
+    static ze_fake::call_t &fakeCall = ze_fake::registerCall(__func__);       \
+    fakeCall.enter()
+
+struct command_t {
+    enum class kind_t { nop, reset, work, fence };
+    kind_t kind = kind_t::nop;
+    std::vector<ze_event_handle_t> waits;
+    /// Signaled once the command has completed.
+    ze_event_handle_t signal = nullptr;
+    /// The event that a reset command resets.
+    ze_event_handle_t event = nullptr;
+    ze_fence_handle_t fence = nullptr;
+    std::function<void()> work;
+};
+
+/// Commands of an immediate command list or of a command queue.
+struct stream_t {
+    std::deque<command_t> pending;
+};
+
+/// Executes the commands of all streams. A command runs as soon as its wait
+/// events are signaled, and blocks the commands behind it in its stream until
+/// then. Only a host signal can unblock a stream, so streams are only
+/// revisited when that happens.
+class engine_t {
+  public:
+    static engine_t &get();
+
+    void submit(stream_t &stream, std::vector<command_t> commands);
+    ze_result_t waitStream(stream_t &stream, uint64_t timeout);
+    void forget(stream_t &stream);
+
+    void hostSignal(ze_event_handle_t event);
+    void hostReset(ze_event_handle_t event);
+    ze_result_t waitEvent(ze_event_handle_t event, uint64_t timeout);
+
+    ze_result_t waitFence(ze_fence_handle_t fence, uint64_t timeout);
+    void resetFence(ze_fence_handle_t fence);
+
+    uint64_t launches() const { return launchCount.load(); }
+    void countLaunch() { launchCount.fetch_add(1, std::memory_order_relaxed); }
+
+  private:
+    /// Runs the commands of a stream until it is drained or blocked, returns
+    /// whether any command ran.
+    bool run(stream_t &stream);
+    /// Runs a stream, if any, and then the blocked streams.
+    void progress(stream_t *stream);
+    template <typename Pred>
+    ze_result_t waitFor(std::unique_lock<std::mutex> &lock, uint64_t timeout,
+                        Pred pred);
+
+    std::mutex mutex;
+    std::condition_variable completed;
+    std::set<stream_t *> blocked;
+    std::atomic<uint64_t> launchCount{0};
+};
+
+/// Builds a command that waits for events, signals one when done and
+/// optionally runs some work on the host.
+command_t makeCommand(ze_event_handle_t signal, uint32_t numWaitEvents,
+                      ze_event_handle_t *waitEvents,
+                      std::function<void()> work = nullptr);
+
+struct kernel_info_t {
+    std::string name;
+    uint32_t numArgs;
+};
+
+/// Entry points of a SPIR-V module, empty if it cannot be parsed.
+std::vector<kernel_info_t> parseSpirv(const uint8_t *data, size_t size);
+
+} // namespace ze_fake
+
+struct _ze_driver_handle_t {
+    std::vector<std::unique_ptr<_ze_device_handle_t>> devices;
+};
+
+struct _ze_device_handle_t {
+    _ze_driver_handle_t *driver;
+    uint32_t index;
+};
+
+struct _ze_context_handle_t {
+    struct allocation_t {
+        size_t size;
+        ze_memory_type_t type;
+        ze_device_handle_t device;
+    };
+
+    _ze_driver_handle_t *driver;
+    std::mutex mutex;
+    std::map<uintptr_t, allocation_t> allocations;
+};
+
+struct _ze_command_queue_handle_t {
+    ze_context_handle_t context;
+    ze_device_handle_t device;
+    ze_command_queue_mode_t mode;
+    ze_fake::stream_t stream;
+};
+
+struct _ze_command_list_handle_t {
+    ze_context_handle_t context;
+    ze_device_handle_t device;
+    bool immediate;
+    ze_command_queue_mode_t mode;
+    /// Commands recorded by a regular command list.
+    std::vector<ze_fake::command_t> commands;
+    /// Where an immediate command list submits its commands.
+    ze_fake::stream_t stream;
+
+    void append(ze_fake::command_t command);
+};
+
+struct _ze_fence_handle_t {
+    ze_command_queue_handle_t queue;
+    bool signaled = false;
+};
+
+struct _ze_event_pool_handle_t {
+    ze_context_handle_t context;
+    uint32_t count;
+    ze_event_pool_flags_t flags;
+    /// Events of counter based pools are not reset by the host, appending a
+    /// command that signals them makes them unsignaled until it completes.
+    bool counterBased;
+};
+
+struct _ze_event_handle_t {
+    ze_event_pool_handle_t pool;
+    std::atomic<bool> signaled{false};
+    uint64_t start = 0;
+    uint64_t end = 0;
+};
+
+struct _ze_module_build_log_handle_t {
+    std::string log;
+};
+
+struct _ze_module_handle_t {
+    ze_context_handle_t context;
+    ze_device_handle_t device;
+    std::vector<uint8_t> binary;
+    /// Kernels found in the module. Native binaries are not parsed, any
+    /// kernel name is accepted for them.
+    std::vector<ze_fake::kernel_info_t> kernels;
+    bool native;
+};
+
+struct _ze_kernel_handle_t {
+    ze_module_handle_t module;
+    std::string name;
+    uint32_t numArgs;
+    uint32_t groupSize[3] = {1, 1, 1};
+    std::vector<std::vector<uint8_t>> args;
+};
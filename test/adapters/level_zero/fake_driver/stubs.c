@@ -0,0 +1,54 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Entry points that the adapters reference but that the fake driver does not
+// model. The adapters are linked with -z now, so every one of them has to be
+// defined for the adapters to load at all. They all fail with
+// ZE_RESULT_ERROR_UNSUPPORTED_FEATURE and ignore their arguments, so they are
+// defined without prototypes instead of with the exact signatures of the
+// headers, which the calling convention allows for functions that do not
+// read their parameters.
+
+#define ZE_FAKE_RESULT_ERROR_UNSUPPORTED_FEATURE 0x78000003
+
+#define ZE_FAKE_STUB(name)                                                     \
+    __attribute__((visibility("default"))) int name() {                       \
+        return ZE_FAKE_RESULT_ERROR_UNSUPPORTED_FEATURE;                       \
+    }
+
+// Images and samplers
+ZE_FAKE_STUB(zeImageCreate)
+ZE_FAKE_STUB(zeImageDestroy)
+ZE_FAKE_STUB(zeImageViewCreateExt)
+ZE_FAKE_STUB(zeContextMakeImageResident)
+ZE_FAKE_STUB(zeCommandListAppendImageCopyFromMemory)
+ZE_FAKE_STUB(zeCommandListAppendImageCopyFromMemoryExt)
+ZE_FAKE_STUB(zeCommandListAppendImageCopyRegion)
+ZE_FAKE_STUB(zeCommandListAppendImageCopyToMemory)
+ZE_FAKE_STUB(zeCommandListAppendImageCopyToMemoryExt)
+ZE_FAKE_STUB(zeSamplerCreate)
+ZE_FAKE_STUB(zeSamplerDestroy)
+
+// Inter-process memory
+ZE_FAKE_STUB(zeMemGetIpcHandle)
+ZE_FAKE_STUB(zeMemPutIpcHandle)
+ZE_FAKE_STUB(zeMemOpenIpcHandle)
+ZE_FAKE_STUB(zeMemCloseIpcHandle)
+
+// Virtual and physical memory
+ZE_FAKE_STUB(zeVirtualMemReserve)
+ZE_FAKE_STUB(zeVirtualMemFree)
+ZE_FAKE_STUB(zeVirtualMemQueryPageSize)
+ZE_FAKE_STUB(zeVirtualMemMap)
+ZE_FAKE_STUB(zeVirtualMemUnmap)
+ZE_FAKE_STUB(zeVirtualMemSetAccessAttribute)
+ZE_FAKE_STUB(zeVirtualMemGetAccessAttribute)
+ZE_FAKE_STUB(zePhysicalMemCreate)
+ZE_FAKE_STUB(zePhysicalMemDestroy)
+
+// Sysman, which the adapters only use after zesInit has succeeded
+ZE_FAKE_STUB(zesDeviceEnumMemoryModules)
+ZE_FAKE_STUB(zesMemoryGetProperties)
+ZE_FAKE_STUB(zesMemoryGetState)
@@ -0,0 +1,1277 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Entry points of the fake driver that model the driver on the host. The
+// ones the adapters reference but that are not modelled are in stubs.c.
+
+#include "fake_driver.hpp"
+
+#include <loader/ze_loader.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <tuple>
+
+using ze_fake::engine_t;
+using ze_fake::makeCommand;
+
+namespace {
+
+constexpr uint32_t fakeVendorId = 0x8086;
+// Not the id of a real device, so that the adapters do not take paths meant
+// for a specific GPU.
+constexpr uint32_t fakeDeviceId = 0xfa4e;
+constexpr uint64_t fakeMemorySize = 16ull << 30;
+// Argument count of the kernels of native binaries, which are not parsed.
+constexpr uint32_t unknownArgCount = 64;
+
+_ze_driver_handle_t &getDriver() {
+    // Leaked, like the handles of a real driver.
+    static _ze_driver_handle_t *driver = [] {
+        auto *driver = new _ze_driver_handle_t();
+        for (uint32_t i = 0; i < ze_fake::config_t::get().deviceCount; i++) {
+            driver->devices.push_back(std::unique_ptr<_ze_device_handle_t>(
+                new _ze_device_handle_t{driver, i}));
+        }
+        return driver;
+    }();
+    return *driver;
+}
+
+/// Copies up to *pCount items to an optional output array, or returns the
+/// number of items in *pCount when there is none.
+template <typename T>
+ze_result_t returnArray(uint32_t *pCount, T *pItems, const T *items,
+                        uint32_t count) {
+    if (!pCount) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    if (*pCount == 0 || !pItems) {
+        *pCount = count;
+        return ZE_RESULT_SUCCESS;
+    }
+    *pCount = std::min(*pCount, count);
+    std::copy(items, items + *pCount, pItems);
+    return ZE_RESULT_SUCCESS;
+}
+
+void *allocate(ze_context_handle_t hContext, size_t size, size_t alignment,
+               ze_memory_type_t type, ze_device_handle_t hDevice) {
+    alignment = std::max<size_t>(alignment, 64);
+    // aligned_alloc wants a size that is a multiple of the alignment.
+    size_t allocSize = (std::max<size_t>(size, 1) + alignment - 1) /
+                       alignment * alignment;
+    void *ptr = std::aligned_alloc(alignment, allocSize);
+    if (ptr) {
+        std::lock_guard<std::mutex> lock(hContext->mutex);
+        hContext->allocations[reinterpret_cast<uintptr_t>(ptr)] = {size, type,
+                                                                    hDevice};
+    }
+    return ptr;
+}
+
+/// The allocation holding ptr, nullptr if it is not a USM pointer. Must be
+/// called with the context locked.
+const std::pair<const uintptr_t, _ze_context_handle_t::allocation_t> *
+findAllocation(ze_context_handle_t hContext, const void *ptr) {
+    auto addr = reinterpret_cast<uintptr_t>(ptr);
+    auto it = hContext->allocations.upper_bound(addr);
+    if (it == hContext->allocations.begin()) {
+        return nullptr;
+    }
+    --it;
+    if (addr >= it->first + std::max<size_t>(it->second.size, 1)) {
+        return nullptr;
+    }
+    return &*it;
+}
+
+void writeKernelTimestamp(ze_event_handle_t hEvent,
+                          ze_kernel_timestamp_result_t *dst) {
+    dst->global.kernelStart = dst->context.kernelStart = hEvent->start;
+    dst->global.kernelEnd = dst->context.kernelEnd = hEvent->end;
+}
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// Loader
+
+ze_result_t ZE_APICALL zelLoaderGetVersions(size_t *num_elems,
+                                            zel_component_version_t *versions) {
+    ZE_FAKE_ENTER();
+    if (!versions) {
+        *num_elems = 1;
+        return ZE_RESULT_SUCCESS;
+    }
+    if (*num_elems < 1) {
+        return ZE_RESULT_ERROR_INVALID_SIZE;
+    }
+    *num_elems = 1;
+    std::memset(&versions[0], 0, sizeof(versions[0]));
+    std::strncpy(versions[0].component_name, "loader",
+                 ZEL_COMPONENT_STRING_SIZE - 1);
+    versions[0].spec_version = ZE_API_VERSION_CURRENT;
+    versions[0].component_lib_version = {1, 19, 2};
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zelLoaderTranslateHandle(zel_handle_type_t handleType,
+                                                void *handleIn,
+                                                void **handleOut) {
+    ZE_FAKE_ENTER();
+    std::ignore = handleType;
+    // There is no driver behind the loader to translate the handles for.
+    *handleOut = handleIn;
+    return ZE_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Driver
+
+ze_result_t ZE_APICALL zeInit(ze_init_flags_t flags) {
+    ZE_FAKE_ENTER();
+    std::ignore = flags;
+    getDriver();
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeInitDrivers(uint32_t *pCount,
+                                     ze_driver_handle_t *phDrivers,
+                                     ze_init_driver_type_desc_t *desc) {
+    ZE_FAKE_ENTER();
+    if (!desc || !(desc->flags & ZE_INIT_DRIVER_TYPE_FLAG_GPU)) {
+        *pCount = 0;
+        return ZE_RESULT_SUCCESS;
+    }
+    ze_driver_handle_t driver = &getDriver();
+    return returnArray(pCount, phDrivers, &driver, 1);
+}
+
+ze_result_t ZE_APICALL zeDriverGet(uint32_t *pCount,
+                                   ze_driver_handle_t *phDrivers) {
+    ZE_FAKE_ENTER();
+    ze_driver_handle_t driver = &getDriver();
+    return returnArray(pCount, phDrivers, &driver, 1);
+}
+
+ze_result_t ZE_APICALL zeDriverGetApiVersion(ze_driver_handle_t hDriver,
+                                             ze_api_version_t *version) {
+    ZE_FAKE_ENTER();
+    std::ignore = hDriver;
+    *version = ZE_API_VERSION_CURRENT;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL
+zeDriverGetProperties(ze_driver_handle_t hDriver,
+                      ze_driver_properties_t *pDriverProperties) {
+    ZE_FAKE_ENTER();
+    std::ignore = hDriver;
+    std::memset(&pDriverProperties->uuid, 0, sizeof(pDriverProperties->uuid));
+    std::memcpy(pDriverProperties->uuid.id, "ze_fake", 7);
+    // Major, minor and build, as the Intel driver encodes them.
+    pDriverProperties->driverVersion = (1u << 24) | 1u;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeDriverGetExtensionProperties(
+    ze_driver_handle_t hDriver, uint32_t *pCount,
+    ze_driver_extension_properties_t *pExtensionProperties) {
+    ZE_FAKE_ENTER();
+    std::ignore = hDriver;
+    static const auto extensions = [] {
+        std::vector<ze_driver_extension_properties_t> extensions(2);
+        std::strncpy(extensions[0].name, ZE_GLOBAL_OFFSET_EXP_NAME,
+                     ZE_MAX_EXTENSION_NAME - 1);
+        extensions[0].version = ZE_GLOBAL_OFFSET_EXP_VERSION_1_0;
+        std::strncpy(extensions[1].name, ZE_EVENT_POOL_COUNTER_BASED_EXP_NAME,
+                     ZE_MAX_EXTENSION_NAME - 1);
+        extensions[1].version = ZE_EVENT_POOL_COUNTER_BASED_EXP_VERSION_CURRENT;
+        return extensions;
+    }();
+    return returnArray(pCount, pExtensionProperties, extensions.data(),
+                       static_cast<uint32_t>(extensions.size()));
+}
+
+ze_result_t ZE_APICALL zeDriverGetExtensionFunctionAddress(
+    ze_driver_handle_t hDriver, const char *name, void **ppFunctionAddress) {
+    ZE_FAKE_ENTER();
+    std::ignore = hDriver;
+    std::ignore = name;
+    *ppFunctionAddress = nullptr;
+    return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Device
+
+ze_result_t ZE_APICALL zeDeviceGet(ze_driver_handle_t hDriver, uint32_t *pCount,
+                                   ze_device_handle_t *phDevices) {
+    ZE_FAKE_ENTER();
+    std::vector<ze_device_handle_t> devices;
+    for (auto &device : hDriver->devices) {
+        devices.push_back(device.get());
+    }
+    return returnArray(pCount, phDevices, devices.data(),
+                       static_cast<uint32_t>(devices.size()));
+}
+
+ze_result_t ZE_APICALL zeDeviceGetRootDevice(ze_device_handle_t hDevice,
+                                             ze_device_handle_t *phRootDevice) {
+    ZE_FAKE_ENTER();
+    std::ignore = hDevice;
+    *phRootDevice = nullptr;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeDeviceGetSubDevices(ze_device_handle_t hDevice,
+                                             uint32_t *pCount,
+                                             ze_device_handle_t *phSubdevices) {
+    ZE_FAKE_ENTER();
+    std::ignore = hDevice;
+    std::ignore = phSubdevices;
+    *pCount = 0;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL
+zeDeviceGetProperties(ze_device_handle_t hDevice,
+                      ze_device_properties_t *pDeviceProperties) {
+    ZE_FAKE_ENTER();
+    auto *props = pDeviceProperties;
+    props->type = ZE_DEVICE_TYPE_GPU;
+    props->vendorId = fakeVendorId;
+    props->deviceId = fakeDeviceId;
+    props->flags = 0;
+    props->subdeviceId = 0;
+    props->coreClockRate = 1000;
+    props->maxMemAllocSize = fakeMemorySize / 4;
+    props->maxHardwareContexts = 64;
+    props->maxCommandQueuePriority = 0;
+    props->numThreadsPerEU = 8;
+    props->physicalEUSimdWidth = 8;
+    props->numEUsPerSubslice = 8;
+    props->numSubslicesPerSlice = 8;
+    props->numSlices = 1;
+    // Timestamps are host nanoseconds, the unit depends on the version of
+    // the structure.
+    props->timerResolution =
+        props->stype == ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES_1_2 ? 1000000000
+                                                                : 1;
+    props->timestampValidBits = 64;
+    props->kernelTimestampValidBits = 64;
+    std::memset(&props->uuid, 0, sizeof(props->uuid));
+    std::memcpy(props->uuid.id, &hDevice->index, sizeof(hDevice->index));
+    std::snprintf(props->name, ZE_MAX_DEVICE_NAME, "Fake Level Zero GPU %u",
+                  hDevice->index);
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL
+zeDeviceGetComputeProperties(ze_device_handle_t hDevice,
+                             ze_device_compute_properties_t *pComputeProps) {
+    ZE_FAKE_ENTER();
+    std::ignore = hDevice;
+    pComputeProps->maxTotalGroupSize = 1024;
+    pComputeProps->maxGroupSizeX = 1024;
+    pComputeProps->maxGroupSizeY = 1024;
+    pComputeProps->maxGroupSizeZ = 1024;
+    pComputeProps->maxGroupCountX = UINT32_MAX;
+    pComputeProps->maxGroupCountY = UINT32_MAX;
+    pComputeProps->maxGroupCountZ = UINT32_MAX;
+    pComputeProps->maxSharedLocalMemory = 64 * 1024;
+    pComputeProps->numSubGroupSizes = 3;
+    pComputeProps->subGroupSizes[0] = 8;
+    pComputeProps->subGroupSizes[1] = 16;
+    pComputeProps->subGroupSizes[2] = 32;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL
+zeDeviceGetModuleProperties(ze_device_handle_t hDevice,
+                            ze_device_module_properties_t *pModuleProps) {
+    ZE_FAKE_ENTER();
+    std::ignore = hDevice;
+    pModuleProps->spirvVersionSupported = ZE_MAKE_VERSION(1, 2);
+    pModuleProps->flags = ZE_DEVICE_MODULE_FLAG_FP16 |
+                          ZE_DEVICE_MODULE_FLAG_FP64 |
+                          ZE_DEVICE_MODULE_FLAG_INT64_ATOMICS;
+    pModuleProps->fp16flags = 0;
+    pModuleProps->fp32flags = 0;
+    pModuleProps->fp64flags = 0;
+    pModuleProps->maxArgumentsSize = 2048;
+    pModuleProps->printfBufferSize = 4 * 1024 * 1024;
+    std::memset(&pModuleProps->nativeKernelSupported, 0,
+                sizeof(pModuleProps->nativeKernelSupported));
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeDeviceGetCommandQueueGroupProperties(
+    ze_device_handle_t hDevice, uint32_t *pCount,
+    ze_command_queue_group_properties_t *pCommandQueueGroupProperties) {
+    ZE_FAKE_ENTER();
+    std::ignore = hDevice;
+    if (!pCommandQueueGroupProperties || *pCount == 0) {
+        *pCount = 2;
+        return ZE_RESULT_SUCCESS;
+    }
+    // A compute group and a copy group, with one queue each.
+    const ze_command_queue_group_property_flags_t flags[] = {
+        ZE_COMMAND_QUEUE_GROUP_PROPERTY_FLAG_COMPUTE |
+            ZE_COMMAND_QUEUE_GROUP_PROPERTY_FLAG_COPY |
+            ZE_COMMAND_QUEUE_GROUP_PROPERTY_FLAG_COOPERATIVE_KERNELS,
+        ZE_COMMAND_QUEUE_GROUP_PROPERTY_FLAG_COPY};
+    *pCount = std::min(*pCount, 2u);
+    for (uint32_t i = 0; i < *pCount; i++) {
+        pCommandQueueGroupProperties[i].flags = flags[i];
+        pCommandQueueGroupProperties[i].maxMemoryFillPatternSize = 128;
+        pCommandQueueGroupProperties[i].numQueues = 1;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL
+zeDeviceGetMemoryProperties(ze_device_handle_t hDevice, uint32_t *pCount,
+                            ze_device_memory_properties_t *pMemProperties) {
+    ZE_FAKE_ENTER();
+    std::ignore = hDevice;
+    if (!pMemProperties || *pCount == 0) {
+        *pCount = 1;
+        return ZE_RESULT_SUCCESS;
+    }
+    *pCount = 1;
+    pMemProperties->flags = 0;
+    pMemProperties->maxClockRate = 1000;
+    pMemProperties->maxBusWidth = 64;
+    pMemProperties->totalSize = fakeMemorySize;
+    std::strncpy(pMemProperties->name, "host", ZE_MAX_DEVICE_NAME - 1);
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeDeviceGetMemoryAccessProperties(
+    ze_device_handle_t hDevice,
+    ze_device_memory_access_properties_t *pMemAccessProperties) {
+    ZE_FAKE_ENTER();
+    std::ignore = hDevice;
+    // All allocations are host memory, so every kind of access works.
+    const ze_memory_access_cap_flags_t all =
+        ZE_MEMORY_ACCESS_CAP_FLAG_RW | ZE_MEMORY_ACCESS_CAP_FLAG_ATOMIC |
+        ZE_MEMORY_ACCESS_CAP_FLAG_CONCURRENT |
+        ZE_MEMORY_ACCESS_CAP_FLAG_CONCURRENT_ATOMIC;
+    pMemAccessProperties->hostAllocCapabilities = all;
+    pMemAccessProperties->deviceAllocCapabilities = all;
+    pMemAccessProperties->sharedSingleDeviceAllocCapabilities = all;
+    pMemAccessProperties->sharedCrossDeviceAllocCapabilities = all;
+    pMemAccessProperties->sharedSystemAllocCapabilities = 0;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL
+zeDeviceGetCacheProperties(ze_device_handle_t hDevice, uint32_t *pCount,
+                           ze_device_cache_properties_t *pCacheProperties) {
+    ZE_FAKE_ENTER();
+    std::ignore = hDevice;
+    if (!pCacheProperties || *pCount == 0) {
+        *pCount = 1;
+        return ZE_RESULT_SUCCESS;
+    }
+    *pCount = 1;
+    pCacheProperties->flags = 0;
+    pCacheProperties->cacheSize = 4 * 1024 * 1024;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL
+zeDeviceGetImageProperties(ze_device_handle_t hDevice,
+                           ze_device_image_properties_t *pImageProperties) {
+    ZE_FAKE_ENTER();
+    std::ignore = hDevice;
+    // Images are not modelled, so report none.
+    pImageProperties->maxImageDims1D = 0;
+    pImageProperties->maxImageDims2D = 0;
+    pImageProperties->maxImageDims3D = 0;
+    pImageProperties->maxImageBufferSize = 0;
+    pImageProperties->maxImageArraySlices = 0;
+    pImageProperties->maxSamplers = 0;
+    pImageProperties->maxReadImageArgs = 0;
+    pImageProperties->maxWriteImageArgs = 0;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL
+zeDeviceGetP2PProperties(ze_device_handle_t hDevice,
+                         ze_device_handle_t hPeerDevice,
+                         ze_device_p2p_properties_t *pP2PProperties) {
+    ZE_FAKE_ENTER();
+    std::ignore = hDevice;
+    std::ignore = hPeerDevice;
+    pP2PProperties->flags = 0;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeDeviceCanAccessPeer(ze_device_handle_t hDevice,
+                                             ze_device_handle_t hPeerDevice,
+                                             ze_bool_t *value) {
+    ZE_FAKE_ENTER();
+    *value = hDevice == hPeerDevice;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeDeviceGetGlobalTimestamps(ze_device_handle_t hDevice,
+                                                   uint64_t *hostTimestamp,
+                                                   uint64_t *deviceTimestamp) {
+    ZE_FAKE_ENTER();
+    std::ignore = hDevice;
+    *hostTimestamp = *deviceTimestamp = ze_fake::now();
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL
+zeDevicePciGetPropertiesExt(ze_device_handle_t hDevice,
+                            ze_pci_ext_properties_t *pPciProperties) {
+    ZE_FAKE_ENTER();
+    pPciProperties->address = {0, hDevice->index, 0, 0};
+    pPciProperties->maxSpeed = {-1, -1, -1};
+    return ZE_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Context
+
+ze_result_t ZE_APICALL zeContextCreate(ze_driver_handle_t hDriver,
+                                       const ze_context_desc_t *desc,
+                                       ze_context_handle_t *phContext) {
+    ZE_FAKE_ENTER();
+    std::ignore = desc;
+    auto *context = new _ze_context_handle_t();
+    context->driver = hDriver;
+    *phContext = context;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeContextDestroy(ze_context_handle_t hContext) {
+    ZE_FAKE_ENTER();
+    delete hContext;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeContextMakeMemoryResident(ze_context_handle_t hContext,
+                                                   ze_device_handle_t hDevice,
+                                                   void *ptr, size_t size) {
+    ZE_FAKE_ENTER();
+    std::ignore = hContext;
+    std::ignore = hDevice;
+    std::ignore = ptr;
+    std::ignore = size;
+    return ZE_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Memory
+
+ze_result_t ZE_APICALL
+zeMemAllocShared(ze_context_handle_t hContext,
+                 const ze_device_mem_alloc_desc_t *device_desc,
+                 const ze_host_mem_alloc_desc_t *host_desc, size_t size,
+                 size_t alignment, ze_device_handle_t hDevice, void **pptr) {
+    ZE_FAKE_ENTER();
+    std::ignore = device_desc;
+    std::ignore = host_desc;
+    *pptr = allocate(hContext, size, alignment, ZE_MEMORY_TYPE_SHARED, hDevice);
+    return *pptr ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+}
+
+ze_result_t ZE_APICALL zeMemAllocDevice(ze_context_handle_t hContext,
+                                        const ze_device_mem_alloc_desc_t *desc,
+                                        size_t size, size_t alignment,
+                                        ze_device_handle_t hDevice,
+                                        void **pptr) {
+    ZE_FAKE_ENTER();
+    std::ignore = desc;
+    *pptr = allocate(hContext, size, alignment, ZE_MEMORY_TYPE_DEVICE, hDevice);
+    return *pptr ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+}
+
+ze_result_t ZE_APICALL zeMemAllocHost(ze_context_handle_t hContext,
+                                      const ze_host_mem_alloc_desc_t *host_desc,
+                                      size_t size, size_t alignment,
+                                      void **pptr) {
+    ZE_FAKE_ENTER();
+    std::ignore = host_desc;
+    *pptr = allocate(hContext, size, alignment, ZE_MEMORY_TYPE_HOST, nullptr);
+    return *pptr ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+}
+
+ze_result_t ZE_APICALL zeMemFree(ze_context_handle_t hContext, void *ptr) {
+    ZE_FAKE_ENTER();
+    {
+        std::lock_guard<std::mutex> lock(hContext->mutex);
+        if (!hContext->allocations.erase(reinterpret_cast<uintptr_t>(ptr))) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+    std::free(ptr);
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeMemFreeExt(
+    ze_context_handle_t hContext,
+    const ze_memory_free_ext_desc_t *pMemFreeDesc, void *ptr) {
+    ZE_FAKE_ENTER();
+    std::ignore = pMemFreeDesc;
+    return zeMemFree(hContext, ptr);
+}
+
+ze_result_t ZE_APICALL
+zeMemGetAllocProperties(ze_context_handle_t hContext, const void *ptr,
+                        ze_memory_allocation_properties_t *pMemAllocProperties,
+                        ze_device_handle_t *phDevice) {
+    ZE_FAKE_ENTER();
+    std::lock_guard<std::mutex> lock(hContext->mutex);
+    auto *allocation = findAllocation(hContext, ptr);
+    pMemAllocProperties->type =
+        allocation ? allocation->second.type : ZE_MEMORY_TYPE_UNKNOWN;
+    pMemAllocProperties->id = allocation ? allocation->first : 0;
+    pMemAllocProperties->pageSize = allocation ? 4096 : 0;
+    if (phDevice) {
+        *phDevice = allocation ? allocation->second.device : nullptr;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeMemGetAddressRange(ze_context_handle_t hContext,
+                                            const void *ptr, void **pBase,
+                                            size_t *pSize) {
+    ZE_FAKE_ENTER();
+    std::lock_guard<std::mutex> lock(hContext->mutex);
+    auto *allocation = findAllocation(hContext, ptr);
+    if (!allocation) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (pBase) {
+        *pBase = reinterpret_cast<void *>(allocation->first);
+    }
+    if (pSize) {
+        *pSize = allocation->second.size;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Command queue
+
+ze_result_t ZE_APICALL zeCommandQueueCreate(
+    ze_context_handle_t hContext, ze_device_handle_t hDevice,
+    const ze_command_queue_desc_t *desc,
+    ze_command_queue_handle_t *phCommandQueue) {
+    ZE_FAKE_ENTER();
+    auto *queue = new _ze_command_queue_handle_t();
+    queue->context = hContext;
+    queue->device = hDevice;
+    queue->mode = desc->mode;
+    *phCommandQueue = queue;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL
+zeCommandQueueDestroy(ze_command_queue_handle_t hCommandQueue) {
+    ZE_FAKE_ENTER();
+    engine_t::get().forget(hCommandQueue->stream);
+    delete hCommandQueue;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandQueueExecuteCommandLists(
+    ze_command_queue_handle_t hCommandQueue, uint32_t numCommandLists,
+    ze_command_list_handle_t *phCommandLists, ze_fence_handle_t hFence) {
+    ZE_FAKE_ENTER();
+    std::vector<ze_fake::command_t> commands;
+    for (uint32_t i = 0; i < numCommandLists; i++) {
+        auto &listCommands = phCommandLists[i]->commands;
+        commands.insert(commands.end(), listCommands.begin(),
+                        listCommands.end());
+    }
+    if (hFence) {
+        ze_fake::command_t fence;
+        fence.kind = ze_fake::command_t::kind_t::fence;
+        fence.fence = hFence;
+        commands.push_back(std::move(fence));
+    }
+    engine_t::get().submit(hCommandQueue->stream, std::move(commands));
+    if (hCommandQueue->mode == ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS) {
+        return engine_t::get().waitStream(hCommandQueue->stream, UINT64_MAX);
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandQueueSynchronize(
+    ze_command_queue_handle_t hCommandQueue, uint64_t timeout) {
+    ZE_FAKE_ENTER();
+    return engine_t::get().waitStream(hCommandQueue->stream, timeout);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Command list
+
+ze_result_t ZE_APICALL zeCommandListCreate(ze_context_handle_t hContext,
+                                           ze_device_handle_t hDevice,
+                                           const ze_command_list_desc_t *desc,
+                                           ze_command_list_handle_t *phList) {
+    ZE_FAKE_ENTER();
+    std::ignore = desc;
+    auto *list = new _ze_command_list_handle_t();
+    list->context = hContext;
+    list->device = hDevice;
+    list->immediate = false;
+    list->mode = ZE_COMMAND_QUEUE_MODE_DEFAULT;
+    *phList = list;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListCreateImmediate(
+    ze_context_handle_t hContext, ze_device_handle_t hDevice,
+    const ze_command_queue_desc_t *altdesc, ze_command_list_handle_t *phList) {
+    ZE_FAKE_ENTER();
+    auto *list = new _ze_command_list_handle_t();
+    list->context = hContext;
+    list->device = hDevice;
+    list->immediate = true;
+    list->mode = altdesc->mode;
+    *phList = list;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListDestroy(ze_command_list_handle_t hList) {
+    ZE_FAKE_ENTER();
+    engine_t::get().forget(hList->stream);
+    delete hList;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListClose(ze_command_list_handle_t hList) {
+    ZE_FAKE_ENTER();
+    std::ignore = hList;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListReset(ze_command_list_handle_t hList) {
+    ZE_FAKE_ENTER();
+    hList->commands.clear();
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListHostSynchronize(
+    ze_command_list_handle_t hCommandList, uint64_t timeout) {
+    ZE_FAKE_ENTER();
+    if (!hCommandList->immediate) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return engine_t::get().waitStream(hCommandList->stream, timeout);
+}
+
+ze_result_t ZE_APICALL zeCommandListAppendBarrier(
+    ze_command_list_handle_t hCommandList, ze_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    ZE_FAKE_ENTER();
+    hCommandList->append(
+        makeCommand(hSignalEvent, numWaitEvents, phWaitEvents));
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListAppendMemoryCopy(
+    ze_command_list_handle_t hCommandList, void *dstptr, const void *srcptr,
+    size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents) {
+    ZE_FAKE_ENTER();
+    hCommandList->append(makeCommand(
+        hSignalEvent, numWaitEvents, phWaitEvents,
+        [=] { std::memmove(dstptr, srcptr, size); }));
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListAppendMemoryCopyRegion(
+    ze_command_list_handle_t hCommandList, void *dstptr,
+    const ze_copy_region_t *dstRegion, uint32_t dstPitch,
+    uint32_t dstSlicePitch, const void *srcptr,
+    const ze_copy_region_t *srcRegion, uint32_t srcPitch,
+    uint32_t srcSlicePitch, ze_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    ZE_FAKE_ENTER();
+    ze_copy_region_t dst = *dstRegion;
+    ze_copy_region_t src = *srcRegion;
+    hCommandList->append(makeCommand(
+        hSignalEvent, numWaitEvents, phWaitEvents, [=] {
+            auto *dstBytes = static_cast<uint8_t *>(dstptr);
+            auto *srcBytes = static_cast<const uint8_t *>(srcptr);
+            for (uint32_t z = 0; z < src.depth; z++) {
+                for (uint32_t y = 0; y < src.height; y++) {
+                    std::memmove(
+                        dstBytes + size_t(dst.originZ + z) * dstSlicePitch +
+                            size_t(dst.originY + y) * dstPitch + dst.originX,
+                        srcBytes + size_t(src.originZ + z) * srcSlicePitch +
+                            size_t(src.originY + y) * srcPitch + src.originX,
+                        src.width);
+                }
+            }
+        }));
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListAppendMemoryFill(
+    ze_command_list_handle_t hCommandList, void *ptr, const void *pattern,
+    size_t pattern_size, size_t size, ze_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    ZE_FAKE_ENTER();
+    if (pattern_size == 0 || size % pattern_size != 0) {
+        return ZE_RESULT_ERROR_INVALID_SIZE;
+    }
+    // The pattern only has to live until the append returns.
+    auto *first = static_cast<const uint8_t *>(pattern);
+    std::vector<uint8_t> bytes(first, first + pattern_size);
+    hCommandList->append(makeCommand(
+        hSignalEvent, numWaitEvents, phWaitEvents,
+        [=, bytes = std::move(bytes)] {
+            auto *dst = static_cast<uint8_t *>(ptr);
+            for (size_t offset = 0; offset < size; offset += bytes.size()) {
+                std::memcpy(dst + offset, bytes.data(), bytes.size());
+            }
+        }));
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListAppendMemoryPrefetch(
+    ze_command_list_handle_t hCommandList, const void *ptr, size_t size) {
+    ZE_FAKE_ENTER();
+    std::ignore = hCommandList;
+    std::ignore = ptr;
+    std::ignore = size;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListAppendMemAdvise(
+    ze_command_list_handle_t hCommandList, ze_device_handle_t hDevice,
+    const void *ptr, size_t size, ze_memory_advice_t advice) {
+    ZE_FAKE_ENTER();
+    std::ignore = hCommandList;
+    std::ignore = hDevice;
+    std::ignore = ptr;
+    std::ignore = size;
+    std::ignore = advice;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListAppendSignalEvent(
+    ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent) {
+    ZE_FAKE_ENTER();
+    hCommandList->append(makeCommand(hEvent, 0, nullptr));
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListAppendWaitOnEvents(
+    ze_command_list_handle_t hCommandList, uint32_t numEvents,
+    ze_event_handle_t *phEvents) {
+    ZE_FAKE_ENTER();
+    hCommandList->append(makeCommand(nullptr, numEvents, phEvents));
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListAppendEventReset(
+    ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent) {
+    ZE_FAKE_ENTER();
+    ze_fake::command_t command;
+    command.kind = ze_fake::command_t::kind_t::reset;
+    command.event = hEvent;
+    hCommandList->append(std::move(command));
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListAppendWriteGlobalTimestamp(
+    ze_command_list_handle_t hCommandList, uint64_t *dstptr,
+    ze_event_handle_t hSignalEvent, uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents) {
+    ZE_FAKE_ENTER();
+    hCommandList->append(makeCommand(hSignalEvent, numWaitEvents,
+                                     phWaitEvents,
+                                     [=] { *dstptr = ze_fake::now(); }));
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListAppendQueryKernelTimestamps(
+    ze_command_list_handle_t hCommandList, uint32_t numEvents,
+    ze_event_handle_t *phEvents, void *dstptr, const size_t *pOffsets,
+    ze_event_handle_t hSignalEvent, uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents) {
+    ZE_FAKE_ENTER();
+    std::vector<ze_event_handle_t> events(phEvents, phEvents + numEvents);
+    std::vector<size_t> offsets;
+    if (pOffsets) {
+        offsets.assign(pOffsets, pOffsets + numEvents);
+    }
+    hCommandList->append(makeCommand(
+        hSignalEvent, numWaitEvents, phWaitEvents, [=] {
+            auto *dst = static_cast<uint8_t *>(dstptr);
+            for (size_t i = 0; i < events.size(); i++) {
+                size_t offset = offsets.empty()
+                                    ? i * sizeof(ze_kernel_timestamp_result_t)
+                                    : offsets[i];
+                writeKernelTimestamp(
+                    events[i], reinterpret_cast<ze_kernel_timestamp_result_t *>(
+                                   dst + offset));
+            }
+        }));
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListAppendLaunchKernel(
+    ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel,
+    const ze_group_count_t *pLaunchFuncArgs, ze_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    ZE_FAKE_ENTER();
+    std::ignore = hKernel;
+    std::ignore = pLaunchFuncArgs;
+    // Kernels do not run, only the launch is counted.
+    hCommandList->append(makeCommand(hSignalEvent, numWaitEvents,
+                                     phWaitEvents,
+                                     [] { engine_t::get().countLaunch(); }));
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeCommandListAppendLaunchCooperativeKernel(
+    ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel,
+    const ze_group_count_t *pLaunchFuncArgs, ze_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    ZE_FAKE_ENTER();
+    return zeCommandListAppendLaunchKernel(hCommandList, hKernel,
+                                           pLaunchFuncArgs, hSignalEvent,
+                                           numWaitEvents, phWaitEvents);
+}
+
+ze_result_t ZE_APICALL zeCommandListImmediateAppendCommandListsExp(
+    ze_command_list_handle_t hCommandListImmediate, uint32_t numCommandLists,
+    ze_command_list_handle_t *phCommandLists, ze_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    ZE_FAKE_ENTER();
+    if (!hCommandListImmediate->immediate) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    std::vector<ze_fake::command_t> commands;
+    commands.push_back(makeCommand(nullptr, numWaitEvents, phWaitEvents));
+    for (uint32_t i = 0; i < numCommandLists; i++) {
+        auto &listCommands = phCommandLists[i]->commands;
+        commands.insert(commands.end(), listCommands.begin(),
+                        listCommands.end());
+    }
+    commands.push_back(makeCommand(hSignalEvent, 0, nullptr));
+    engine_t::get().submit(hCommandListImmediate->stream, std::move(commands));
+    return ZE_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Fence
+
+ze_result_t ZE_APICALL zeFenceCreate(ze_command_queue_handle_t hCommandQueue,
+                                     const ze_fence_desc_t *desc,
+                                     ze_fence_handle_t *phFence) {
+    ZE_FAKE_ENTER();
+    auto *fence = new _ze_fence_handle_t();
+    fence->queue = hCommandQueue;
+    fence->signaled = desc && (desc->flags & ZE_FENCE_FLAG_SIGNALED);
+    *phFence = fence;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeFenceDestroy(ze_fence_handle_t hFence) {
+    ZE_FAKE_ENTER();
+    delete hFence;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeFenceHostSynchronize(ze_fence_handle_t hFence,
+                                              uint64_t timeout) {
+    ZE_FAKE_ENTER();
+    return engine_t::get().waitFence(hFence, timeout);
+}
+
+ze_result_t ZE_APICALL zeFenceQueryStatus(ze_fence_handle_t hFence) {
+    ZE_FAKE_ENTER();
+    return engine_t::get().waitFence(hFence, 0);
+}
+
+ze_result_t ZE_APICALL zeFenceReset(ze_fence_handle_t hFence) {
+    ZE_FAKE_ENTER();
+    engine_t::get().resetFence(hFence);
+    return ZE_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Event
+
+ze_result_t ZE_APICALL zeEventPoolCreate(ze_context_handle_t hContext,
+                                         const ze_event_pool_desc_t *desc,
+                                         uint32_t numDevices,
+                                         ze_device_handle_t *phDevices,
+                                         ze_event_pool_handle_t *phEventPool) {
+    ZE_FAKE_ENTER();
+    std::ignore = numDevices;
+    std::ignore = phDevices;
+    auto *pool = new _ze_event_pool_handle_t();
+    pool->context = hContext;
+    pool->count = desc->count;
+    pool->flags = desc->flags;
+    pool->counterBased = false;
+    for (auto *ext = static_cast<const ze_base_desc_t *>(desc->pNext); ext;
+         ext = static_cast<const ze_base_desc_t *>(ext->pNext)) {
+        if (ext->stype == ZE_STRUCTURE_TYPE_COUNTER_BASED_EVENT_POOL_EXP_DESC) {
+            pool->counterBased =
+                reinterpret_cast<const ze_event_pool_counter_based_exp_desc_t *>(
+                    ext)
+                    ->flags != 0;
+        }
+    }
+    *phEventPool = pool;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeEventPoolDestroy(ze_event_pool_handle_t hEventPool) {
+    ZE_FAKE_ENTER();
+    delete hEventPool;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeEventCreate(ze_event_pool_handle_t hEventPool,
+                                     const ze_event_desc_t *desc,
+                                     ze_event_handle_t *phEvent) {
+    ZE_FAKE_ENTER();
+    if (desc->index >= hEventPool->count) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto *event = new _ze_event_handle_t();
+    event->pool = hEventPool;
+    *phEvent = event;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeEventDestroy(ze_event_handle_t hEvent) {
+    ZE_FAKE_ENTER();
+    delete hEvent;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeEventHostSignal(ze_event_handle_t hEvent) {
+    ZE_FAKE_ENTER();
+    engine_t::get().hostSignal(hEvent);
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeEventHostSynchronize(ze_event_handle_t hEvent,
+                                              uint64_t timeout) {
+    ZE_FAKE_ENTER();
+    return engine_t::get().waitEvent(hEvent, timeout);
+}
+
+ze_result_t ZE_APICALL zeEventQueryStatus(ze_event_handle_t hEvent) {
+    ZE_FAKE_ENTER();
+    return engine_t::get().waitEvent(hEvent, 0);
+}
+
+ze_result_t ZE_APICALL zeEventHostReset(ze_event_handle_t hEvent) {
+    ZE_FAKE_ENTER();
+    engine_t::get().hostReset(hEvent);
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeEventQueryKernelTimestamp(
+    ze_event_handle_t hEvent, ze_kernel_timestamp_result_t *dstptr) {
+    ZE_FAKE_ENTER();
+    if (!hEvent->signaled.load(std::memory_order_acquire)) {
+        return ZE_RESULT_NOT_READY;
+    }
+    writeKernelTimestamp(hEvent, dstptr);
+    return ZE_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Module
+
+ze_result_t ZE_APICALL zeModuleCreate(ze_context_handle_t hContext,
+                                      ze_device_handle_t hDevice,
+                                      const ze_module_desc_t *desc,
+                                      ze_module_handle_t *phModule,
+                                      ze_module_build_log_handle_t *phBuildLog) {
+    ZE_FAKE_ENTER();
+    auto *module = new _ze_module_handle_t();
+    module->context = hContext;
+    module->device = hDevice;
+    module->binary.assign(desc->pInputModule,
+                          desc->pInputModule + desc->inputSize);
+    module->native = desc->format == ZE_MODULE_FORMAT_NATIVE;
+    if (!module->native) {
+        module->kernels =
+            ze_fake::parseSpirv(desc->pInputModule, desc->inputSize);
+    }
+    if (phBuildLog) {
+        *phBuildLog = new _ze_module_build_log_handle_t();
+    }
+    *phModule = module;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeModuleDestroy(ze_module_handle_t hModule) {
+    ZE_FAKE_ENTER();
+    delete hModule;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeModuleDynamicLink(
+    uint32_t numModules, ze_module_handle_t *phModules,
+    ze_module_build_log_handle_t *phLinkLog) {
+    ZE_FAKE_ENTER();
+    std::ignore = numModules;
+    std::ignore = phModules;
+    if (phLinkLog) {
+        *phLinkLog = new _ze_module_build_log_handle_t();
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL
+zeModuleBuildLogDestroy(ze_module_build_log_handle_t hModuleBuildLog) {
+    ZE_FAKE_ENTER();
+    delete hModuleBuildLog;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeModuleBuildLogGetString(
+    ze_module_build_log_handle_t hModuleBuildLog, size_t *pSize,
+    char *pBuildLog) {
+    ZE_FAKE_ENTER();
+    const auto &log = hModuleBuildLog->log;
+    if (pBuildLog) {
+        std::memcpy(pBuildLog, log.c_str(), std::min(*pSize, log.size() + 1));
+    }
+    *pSize = log.size() + 1;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeModuleGetNativeBinary(ze_module_handle_t hModule,
+                                               size_t *pSize,
+                                               uint8_t *pModuleNativeBinary) {
+    ZE_FAKE_ENTER();
+    if (pModuleNativeBinary) {
+        std::memcpy(pModuleNativeBinary, hModule->binary.data(),
+                    std::min(*pSize, hModule->binary.size()));
+    }
+    *pSize = hModule->binary.size();
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeModuleGetGlobalPointer(ze_module_handle_t hModule,
+                                                const char *pGlobalName,
+                                                size_t *pSize, void **pptr) {
+    ZE_FAKE_ENTER();
+    std::ignore = hModule;
+    std::ignore = pGlobalName;
+    std::ignore = pSize;
+    std::ignore = pptr;
+    return ZE_RESULT_ERROR_INVALID_GLOBAL_NAME;
+}
+
+ze_result_t ZE_APICALL zeModuleGetKernelNames(ze_module_handle_t hModule,
+                                              uint32_t *pCount,
+                                              const char **pNames) {
+    ZE_FAKE_ENTER();
+    std::vector<const char *> names;
+    for (const auto &kernel : hModule->kernels) {
+        names.push_back(kernel.name.c_str());
+    }
+    return returnArray(pCount, pNames, names.data(),
+                       static_cast<uint32_t>(names.size()));
+}
+
+ze_result_t ZE_APICALL
+zeModuleGetProperties(ze_module_handle_t hModule,
+                      ze_module_properties_t *pModuleProperties) {
+    ZE_FAKE_ENTER();
+    std::ignore = hModule;
+    pModuleProperties->flags = 0;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeModuleGetFunctionPointer(ze_module_handle_t hModule,
+                                                  const char *pFunctionName,
+                                                  void **pfnFunction) {
+    ZE_FAKE_ENTER();
+    std::ignore = hModule;
+    std::ignore = pFunctionName;
+    std::ignore = pfnFunction;
+    return ZE_RESULT_ERROR_INVALID_FUNCTION_NAME;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Kernel
+
+ze_result_t ZE_APICALL zeKernelCreate(ze_module_handle_t hModule,
+                                      const ze_kernel_desc_t *desc,
+                                      ze_kernel_handle_t *phKernel) {
+    ZE_FAKE_ENTER();
+    uint32_t numArgs = unknownArgCount;
+    if (!hModule->native) {
+        auto kernel = std::find_if(
+            hModule->kernels.begin(), hModule->kernels.end(),
+            [&](const auto &info) { return info.name == desc->pKernelName; });
+        if (kernel == hModule->kernels.end()) {
+            return ZE_RESULT_ERROR_INVALID_KERNEL_NAME;
+        }
+        numArgs = kernel->numArgs;
+    }
+    auto *kernel = new _ze_kernel_handle_t();
+    kernel->module = hModule;
+    kernel->name = desc->pKernelName;
+    kernel->numArgs = numArgs;
+    kernel->args.resize(numArgs);
+    *phKernel = kernel;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeKernelDestroy(ze_kernel_handle_t hKernel) {
+    ZE_FAKE_ENTER();
+    delete hKernel;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeKernelSetGroupSize(ze_kernel_handle_t hKernel,
+                                            uint32_t groupSizeX,
+                                            uint32_t groupSizeY,
+                                            uint32_t groupSizeZ) {
+    ZE_FAKE_ENTER();
+    hKernel->groupSize[0] = groupSizeX;
+    hKernel->groupSize[1] = groupSizeY;
+    hKernel->groupSize[2] = groupSizeZ;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeKernelSuggestGroupSize(
+    ze_kernel_handle_t hKernel, uint32_t globalSizeX, uint32_t globalSizeY,
+    uint32_t globalSizeZ, uint32_t *groupSizeX, uint32_t *groupSizeY,
+    uint32_t *groupSizeZ) {
+    ZE_FAKE_ENTER();
+    std::ignore = hKernel;
+    // The largest group sizes that divide the global sizes and fit in 256
+    // work-items.
+    auto largestDivisor = [](uint32_t size, uint32_t limit) {
+        for (uint32_t divisor = std::min(size, limit); divisor > 1;
+             divisor--) {
+            if (size % divisor == 0) {
+                return divisor;
+            }
+        }
+        return 1u;
+    };
+    *groupSizeX = largestDivisor(globalSizeX, 256);
+    *groupSizeY = largestDivisor(globalSizeY, 256 / *groupSizeX);
+    *groupSizeZ =
+        largestDivisor(globalSizeZ, 256 / (*groupSizeX * *groupSizeY));
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeKernelSuggestMaxCooperativeGroupCount(
+    ze_kernel_handle_t hKernel, uint32_t *totalGroupCount) {
+    ZE_FAKE_ENTER();
+    std::ignore = hKernel;
+    *totalGroupCount = 64;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeKernelSetArgumentValue(ze_kernel_handle_t hKernel,
+                                                uint32_t argIndex,
+                                                size_t argSize,
+                                                const void *pArgValue) {
+    ZE_FAKE_ENTER();
+    if (argIndex >= hKernel->numArgs) {
+        return ZE_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
+    }
+    // A null value sets a local memory size or a null pointer.
+    auto *value = static_cast<const uint8_t *>(pArgValue);
+    auto &arg = hKernel->args[argIndex];
+    if (value) {
+        arg.assign(value, value + argSize);
+    } else {
+        arg.clear();
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeKernelSetIndirectAccess(
+    ze_kernel_handle_t hKernel, ze_kernel_indirect_access_flags_t flags) {
+    ZE_FAKE_ENTER();
+    std::ignore = hKernel;
+    std::ignore = flags;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeKernelSetCacheConfig(ze_kernel_handle_t hKernel,
+                                              ze_cache_config_flags_t flags) {
+    ZE_FAKE_ENTER();
+    std::ignore = hKernel;
+    std::ignore = flags;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeKernelSetGlobalOffsetExp(ze_kernel_handle_t hKernel,
+                                                  uint32_t offsetX,
+                                                  uint32_t offsetY,
+                                                  uint32_t offsetZ) {
+    ZE_FAKE_ENTER();
+    std::ignore = hKernel;
+    std::ignore = offsetX;
+    std::ignore = offsetY;
+    std::ignore = offsetZ;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL
+zeKernelGetProperties(ze_kernel_handle_t hKernel,
+                      ze_kernel_properties_t *pKernelProperties) {
+    ZE_FAKE_ENTER();
+    auto *props = pKernelProperties;
+    props->numKernelArgs = hKernel->numArgs;
+    props->requiredGroupSizeX = 0;
+    props->requiredGroupSizeY = 0;
+    props->requiredGroupSizeZ = 0;
+    props->requiredNumSubGroups = 0;
+    props->requiredSubgroupSize = 0;
+    props->maxSubgroupSize = 32;
+    props->maxNumSubgroups = 32;
+    props->localMemSize = 0;
+    props->privateMemSize = 0;
+    props->spillMemSize = 0;
+    std::memset(&props->uuid, 0, sizeof(props->uuid));
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeKernelGetName(ze_kernel_handle_t hKernel,
+                                       size_t *pSize, char *pName) {
+    ZE_FAKE_ENTER();
+    const auto &name = hKernel->name;
+    if (pName) {
+        std::memcpy(pName, name.c_str(), std::min(*pSize, name.size() + 1));
+    }
+    *pSize = name.size() + 1;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL zeKernelGetSourceAttributes(ze_kernel_handle_t hKernel,
+                                                   uint32_t *pSize,
+                                                   char **pString) {
+    ZE_FAKE_ENTER();
+    std::ignore = hKernel;
+    if (pString && *pString && *pSize) {
+        (*pString)[0] = '\0';
+    }
+    *pSize = 1;
+    return ZE_RESULT_SUCCESS;
+}
@@ -6,11 +6,7 @@
 #include "ur_print.hpp"
 #include "uur/fixtures.h"
 #include "uur/raii.h"
-
-#include <map>
-#include <string>
-
-extern std::map<std::string, int> *ZeCallCount;
+#include "ze_call_stats.hpp"
 
 using urMultiQueueMultiDeviceEventCacheTest = uur::urAllDevicesTest;
 TEST_F(urMultiQueueMultiDeviceEventCacheTest,
@@ -54,7 +50,7 @@ TEST_F(urMultiQueueMultiDeviceEventCacheTest,
     uur::raii::Event event = nullptr;
     uur::raii::Event eventWait = nullptr;
     uur::raii::Event eventWaitDummy = nullptr;
-    (*ZeCallCount)["zeCommandListAppendWaitOnEvents"] = 0;
+    ZeCallStats.resetCalls("zeCommandListAppendWaitOnEvents");
     EXPECT_SUCCESS(
         urEventCreateWithNativeHandle(0, context2, nullptr, eventWait.ptr()));
     EXPECT_SUCCESS(urEventCreateWithNativeHandle(0, context1, nullptr,
@@ -63,7 +59,7 @@ TEST_F(urMultiQueueMultiDeviceEventCacheTest,
         urEnqueueEventsWait(queue1, 1, eventWaitDummy.ptr(), eventWait.ptr()));
     EXPECT_SUCCESS(
         urEnqueueEventsWait(queue2, 1, eventWait.ptr(), event.ptr()));
-    EXPECT_EQ((*ZeCallCount)["zeCommandListAppendWaitOnEvents"], 2);
+    EXPECT_EQ(ZeCallStats.getCalls("zeCommandListAppendWaitOnEvents"), 2u);
     ASSERT_SUCCESS(urEventRelease(eventWaitDummy.get()));
     ASSERT_SUCCESS(urEventRelease(eventWait.get()));
     ASSERT_SUCCESS(urEventRelease(event.get()));
@@ -89,7 +85,7 @@ TEST_F(urMultiQueueMultiDeviceEventCacheTest,
     uur::raii::Event event = nullptr;
     uur::raii::Event eventWait = nullptr;
     uur::raii::Event eventWaitDummy = nullptr;
-    (*ZeCallCount)["zeCommandListAppendWaitOnEvents"] = 0;
+    ZeCallStats.resetCalls("zeCommandListAppendWaitOnEvents");
     EXPECT_SUCCESS(
         urEventCreateWithNativeHandle(0, context2, nullptr, eventWait.ptr()));
     EXPECT_SUCCESS(urEventCreateWithNativeHandle(0, context1, nullptr,
@@ -98,7 +94,7 @@ TEST_F(urMultiQueueMultiDeviceEventCacheTest,
         urEnqueueEventsWait(queue1, 1, eventWaitDummy.ptr(), eventWait.ptr()));
     EXPECT_SUCCESS(
         urEnqueueEventsWait(queue2, 1, eventWait.ptr(), event.ptr()));
-    EXPECT_EQ((*ZeCallCount)["zeCommandListAppendWaitOnEvents"], 3);
+    EXPECT_EQ(ZeCallStats.getCalls("zeCommandListAppendWaitOnEvents"), 3u);
     ASSERT_SUCCESS(urEventRelease(eventWaitDummy.get()));
     ASSERT_SUCCESS(urEventRelease(eventWait.get()));
     ASSERT_SUCCESS(urEventRelease(event.get()));
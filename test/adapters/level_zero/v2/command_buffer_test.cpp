@@ -0,0 +1,132 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "uur/fixtures.h"
+#include "uur/raii.h"
+
+#include <algorithm>
+
+struct urCommandBufferTest : uur::urContextTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(urContextTest::SetUp());
+
+        ASSERT_SUCCESS(urQueueCreate(context, device, nullptr, &queue));
+        ASSERT_SUCCESS(
+            urCommandBufferCreateExp(context, device, nullptr, &cmdBuf));
+
+        ASSERT_SUCCESS(urUSMHostAlloc(context, nullptr, nullptr, allocSize,
+                                      reinterpret_cast<void **>(&src)));
+        ASSERT_SUCCESS(urUSMHostAlloc(context, nullptr, nullptr, allocSize,
+                                      reinterpret_cast<void **>(&dst)));
+        std::fill(src, src + allocSize, 0);
+        std::fill(dst, dst + allocSize, 0);
+    }
+
+    void TearDown() override {
+        if (src) {
+            EXPECT_SUCCESS(urUSMFree(context, src));
+        }
+        if (dst) {
+            EXPECT_SUCCESS(urUSMFree(context, dst));
+        }
+        if (cmdBuf) {
+            EXPECT_SUCCESS(urCommandBufferReleaseExp(cmdBuf));
+        }
+        if (queue) {
+            EXPECT_SUCCESS(urQueueRelease(queue));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(urContextTest::TearDown());
+    }
+
+    // Records a fill of src followed by a copy of src to dst.
+    void appendFillAndCopy(uint8_t pattern) {
+        ur_exp_command_buffer_sync_point_t filled;
+        ASSERT_SUCCESS(urCommandBufferAppendUSMFillExp(
+            cmdBuf, src, &pattern, sizeof(pattern), allocSize, 0, nullptr, 0,
+            nullptr, &filled, nullptr, nullptr));
+        ASSERT_SUCCESS(urCommandBufferAppendUSMMemcpyExp(
+            cmdBuf, dst, src, allocSize, 1, &filled, 0, nullptr, nullptr,
+            nullptr, nullptr));
+    }
+
+    void checkDst(uint8_t pattern) {
+        for (size_t i = 0; i < allocSize; i++) {
+            ASSERT_EQ(dst[i], pattern) << "at offset " << i;
+        }
+    }
+
+    static constexpr size_t allocSize = 1024 * 1024;
+
+    ur_queue_handle_t queue = nullptr;
+    ur_exp_command_buffer_handle_t cmdBuf = nullptr;
+    uint8_t *src = nullptr;
+    uint8_t *dst = nullptr;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urCommandBufferTest);
+
+TEST_P(urCommandBufferTest, EnqueueTwice) {
+    UUR_RETURN_ON_FATAL_FAILURE(appendFillAndCopy(1));
+    ASSERT_SUCCESS(urCommandBufferFinalizeExp(cmdBuf));
+
+    ASSERT_SUCCESS(
+        urCommandBufferEnqueueExp(cmdBuf, queue, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+    UUR_RETURN_ON_FATAL_FAILURE(checkDst(1));
+
+    // The commands are executed again, not only recorded once.
+    std::fill(dst, dst + allocSize, 0);
+    uur::raii::Event event;
+    ASSERT_SUCCESS(
+        urCommandBufferEnqueueExp(cmdBuf, queue, 0, nullptr, event.ptr()));
+    ASSERT_SUCCESS(urEventWait(1, event.ptr()));
+    UUR_RETURN_ON_FATAL_FAILURE(checkDst(1));
+}
+
+TEST_P(urCommandBufferTest, EnqueueWaitsForEvents) {
+    UUR_RETURN_ON_FATAL_FAILURE(appendFillAndCopy(2));
+    ASSERT_SUCCESS(urCommandBufferFinalizeExp(cmdBuf));
+
+    uur::raii::Queue otherQueue;
+    ASSERT_SUCCESS(urQueueCreate(context, device, nullptr, otherQueue.ptr()));
+
+    uint8_t pattern = 3;
+    uur::raii::Event filled;
+    ASSERT_SUCCESS(urEnqueueUSMFill(otherQueue, dst, sizeof(pattern), &pattern,
+                                    allocSize, 0, nullptr, filled.ptr()));
+
+    // The copy of the command-buffer has to overwrite the fill.
+    ASSERT_SUCCESS(
+        urCommandBufferEnqueueExp(cmdBuf, queue, 1, filled.ptr(), nullptr));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+    UUR_RETURN_ON_FATAL_FAILURE(checkDst(2));
+}
+
+TEST_P(urCommandBufferTest, InvalidSyncPoint) {
+    uint8_t pattern = 4;
+    ur_exp_command_buffer_sync_point_t syncPoint = 0;
+    ASSERT_EQ_RESULT(
+        UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP,
+        urCommandBufferAppendUSMFillExp(cmdBuf, src, &pattern, sizeof(pattern),
+                                        allocSize, 1, &syncPoint, 0, nullptr,
+                                        nullptr, nullptr, nullptr));
+}
+
+TEST_P(urCommandBufferTest, AppendAfterFinalize) {
+    UUR_RETURN_ON_FATAL_FAILURE(appendFillAndCopy(5));
+    ASSERT_SUCCESS(urCommandBufferFinalizeExp(cmdBuf));
+
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_OPERATION,
+                     urCommandBufferAppendUSMMemcpyExp(
+                         cmdBuf, src, dst, allocSize, 0, nullptr, 0, nullptr,
+                         nullptr, nullptr, nullptr));
+}
+
+TEST_P(urCommandBufferTest, EnqueueWithoutFinalize) {
+    UUR_RETURN_ON_FATAL_FAILURE(appendFillAndCopy(6));
+
+    ASSERT_EQ_RESULT(
+        UR_RESULT_ERROR_INVALID_OPERATION,
+        urCommandBufferEnqueueExp(cmdBuf, queue, 0, nullptr, nullptr));
+}
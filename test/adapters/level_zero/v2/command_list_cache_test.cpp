@@ -14,6 +14,7 @@
 
 #include <gtest/gtest.h>
 #include <map>
+#include <optional>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -250,3 +251,186 @@ TEST_P(CommandListCacheTest, CommandListsCacheIsThreadSafe) {
     ASSERT_LE(context->commandListCache.getNumImmediateCommandLists(),
               NumThreads);
 }
+
+TEST_P(CommandListCacheTest, CacheIsBounded) {
+    static constexpr size_t MaxCachedLists = 2;
+    static constexpr size_t NumLists = 4;
+    v2::command_list_cache_t cache(context->getZeHandle(), MaxCachedLists, 1);
+
+    {
+        std::vector<v2::raii::command_list_unique_handle> CmdLists;
+        for (size_t I = 0; I < NumLists; I++) {
+            CmdLists.emplace_back(cache.getImmediateCommandList(
+                device->ZeDevice, true, 0, true, ZE_COMMAND_QUEUE_MODE_DEFAULT,
+                ZE_COMMAND_QUEUE_PRIORITY_NORMAL));
+        }
+    }
+
+    ASSERT_EQ(cache.getNumImmediateCommandLists(), MaxCachedLists);
+
+    auto Stats = cache.getStats();
+    ASSERT_EQ(Stats.Hits, 0);
+    ASSERT_EQ(Stats.Misses, NumLists);
+    ASSERT_EQ(Stats.Evictions, NumLists - MaxCachedLists);
+}
+
+TEST_P(CommandListCacheTest, BoundIsSharedByShards) {
+    static constexpr size_t MaxCachedLists = 8;
+    v2::command_list_cache_t cache(context->getZeHandle(), MaxCachedLists);
+
+    // All the lists of one descriptor go to the same shard, which can hold
+    // the whole bound.
+    {
+        std::vector<v2::raii::command_list_unique_handle> CmdLists;
+        for (size_t I = 0; I < MaxCachedLists + 1; I++) {
+            CmdLists.emplace_back(cache.getImmediateCommandList(
+                device->ZeDevice, true, 0, true, ZE_COMMAND_QUEUE_MODE_DEFAULT,
+                ZE_COMMAND_QUEUE_PRIORITY_NORMAL));
+        }
+    }
+
+    ASSERT_EQ(cache.getNumImmediateCommandLists(), MaxCachedLists);
+    ASSERT_EQ(cache.getStats().Evictions, 1);
+}
+
+TEST_P(CommandListCacheTest, EvictsLeastRecentlyUsedDescriptor) {
+    v2::command_list_cache_t cache(context->getZeHandle(), 2, 1);
+
+    auto getCmdList = [&](ze_command_queue_priority_t Priority) {
+        return cache.getImmediateCommandList(device->ZeDevice, true, 0, true,
+                                             ZE_COMMAND_QUEUE_MODE_DEFAULT,
+                                             Priority);
+    };
+
+    // Return a list of each of the first two descriptors, the high priority
+    // one last.
+    {
+        auto Low = getCmdList(ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_LOW);
+        auto High = getCmdList(ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_HIGH);
+        Low.reset();
+    }
+    ASSERT_EQ(cache.getNumImmediateCommandLists(), 2);
+
+    // Returning a third descriptor evicts the low priority list.
+    getCmdList(ZE_COMMAND_QUEUE_PRIORITY_NORMAL).reset();
+    ASSERT_EQ(cache.getNumImmediateCommandLists(), 2);
+    ASSERT_EQ(cache.getStats().Evictions, 1);
+
+    auto Misses = cache.getStats().Misses;
+    auto High = getCmdList(ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_HIGH);
+    ASSERT_EQ(cache.getStats().Misses, Misses);
+    auto Low = getCmdList(ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_LOW);
+    ASSERT_EQ(cache.getStats().Misses, Misses + 1);
+}
+
+TEST_P(CommandListCacheTest, EvictsAcrossShards) {
+    static constexpr size_t MaxCachedLists = 4;
+    static constexpr size_t NumShards = 2;
+    v2::command_list_cache_t cache(context->getZeHandle(), MaxCachedLists,
+                                   NumShards);
+
+    auto makeDesc = [&](ze_command_queue_mode_t Mode,
+                        ze_command_queue_priority_t Priority) {
+        v2::immediate_command_list_descriptor_t Desc;
+        Desc.ZeDevice = device->ZeDevice;
+        Desc.IsInOrder = true;
+        Desc.Ordinal = 0;
+        Desc.CopyOffloadEnabled = true;
+        Desc.Mode = Mode;
+        Desc.Priority = Priority;
+        return Desc;
+    };
+    auto getShard = [](const v2::immediate_command_list_descriptor_t &Desc) {
+        return v2::command_list_descriptor_hash_t{}(Desc) % NumShards;
+    };
+    auto getCmdList = [&](const v2::immediate_command_list_descriptor_t &Desc) {
+        return cache.getImmediateCommandList(Desc.ZeDevice, Desc.IsInOrder,
+                                             Desc.Ordinal,
+                                             Desc.CopyOffloadEnabled,
+                                             Desc.Mode, Desc.Priority);
+    };
+
+    // Find a descriptor which lands in another shard than the first one.
+    auto DescA = makeDesc(ZE_COMMAND_QUEUE_MODE_DEFAULT,
+                          ZE_COMMAND_QUEUE_PRIORITY_NORMAL);
+    std::optional<v2::immediate_command_list_descriptor_t> DescB;
+    for (auto Mode :
+         {ZE_COMMAND_QUEUE_MODE_DEFAULT, ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS,
+          ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS}) {
+        for (auto Priority : {ZE_COMMAND_QUEUE_PRIORITY_NORMAL,
+                              ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_LOW,
+                              ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_HIGH}) {
+            auto Desc = makeDesc(Mode, Priority);
+            if (!DescB && getShard(Desc) != getShard(DescA)) {
+                DescB = Desc;
+            }
+        }
+    }
+    if (!DescB) {
+        GTEST_SKIP() << "All the descriptors map to the same shard";
+    }
+
+    // Fill the cache with the lists of shard A.
+    {
+        std::vector<v2::raii::command_list_unique_handle> CmdLists;
+        for (size_t I = 0; I < MaxCachedLists; I++) {
+            CmdLists.emplace_back(getCmdList(DescA));
+        }
+    }
+    ASSERT_EQ(cache.getNumImmediateCommandLists(), MaxCachedLists);
+
+    // Returning lists to shard B evicts the older lists of shard A, not the
+    // lists which were just returned.
+    static constexpr size_t NumListsB = 2;
+    {
+        std::vector<v2::raii::command_list_unique_handle> CmdLists;
+        for (size_t I = 0; I < NumListsB; I++) {
+            CmdLists.emplace_back(getCmdList(*DescB));
+        }
+    }
+    ASSERT_EQ(cache.getNumImmediateCommandLists(), MaxCachedLists);
+    ASSERT_EQ(cache.getStats().Evictions, NumListsB);
+
+    auto Misses = cache.getStats().Misses;
+    std::vector<v2::raii::command_list_unique_handle> CmdLists;
+    for (size_t I = 0; I < NumListsB; I++) {
+        CmdLists.emplace_back(getCmdList(*DescB));
+    }
+    for (size_t I = 0; I < MaxCachedLists - NumListsB; I++) {
+        CmdLists.emplace_back(getCmdList(DescA));
+    }
+    ASSERT_EQ(cache.getStats().Misses, Misses);
+    CmdLists.emplace_back(getCmdList(DescA));
+    ASSERT_EQ(cache.getStats().Misses, Misses + 1);
+}
+
+TEST_P(CommandListCacheTest, CountsHitsAndMisses) {
+    v2::command_list_cache_t cache(context->getZeHandle());
+
+    for (int I = 0; I < 3; I++) {
+        auto CmdList =
+            cache.getRegularCommandList(device->ZeDevice, true, 0, true);
+        ASSERT_TRUE(CmdList != nullptr);
+    }
+
+    auto Stats = cache.getStats();
+    ASSERT_EQ(Stats.Hits, 2);
+    ASSERT_EQ(Stats.Misses, 1);
+    ASSERT_EQ(Stats.Evictions, 0);
+}
+
+TEST_P(CommandListCacheTest, ZeroSizeDisablesCaching) {
+    v2::command_list_cache_t cache(context->getZeHandle(), 0);
+
+    for (int I = 0; I < 2; I++) {
+        auto CmdList =
+            cache.getRegularCommandList(device->ZeDevice, true, 0, true);
+        ASSERT_TRUE(CmdList != nullptr);
+    }
+
+    ASSERT_EQ(cache.getNumRegularCommandLists(), 0);
+    auto Stats = cache.getStats();
+    ASSERT_EQ(Stats.Hits, 0);
+    ASSERT_EQ(Stats.Misses, 2);
+    ASSERT_EQ(Stats.Evictions, 2);
+}
@@ -0,0 +1,80 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef UR_TEST_ADAPTERS_LEVEL_ZERO_V2_FIXTURES_H_INCLUDED
+#define UR_TEST_ADAPTERS_LEVEL_ZERO_V2_FIXTURES_H_INCLUDED
+
+#include <uur/fixtures.h>
+
+#include <algorithm>
+
+namespace uur {
+// A queue and two zeroed USM host allocations, src and dst, which the tests
+// fill and copy chunk by chunk.
+struct urQueueHostMemTest : urContextTest {
+    explicit urQueueHostMemTest(ur_queue_flags_t queueFlags = 0)
+        : queueFlags(queueFlags) {}
+
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(urContextTest::SetUp());
+
+        ur_queue_properties_t props = {UR_STRUCTURE_TYPE_QUEUE_PROPERTIES,
+                                       nullptr, queueFlags};
+        ASSERT_SUCCESS(urQueueCreate(context, device, &props, &queue));
+
+        ASSERT_SUCCESS(urUSMHostAlloc(context, nullptr, nullptr, allocSize,
+                                      reinterpret_cast<void **>(&src)));
+        ASSERT_SUCCESS(urUSMHostAlloc(context, nullptr, nullptr, allocSize,
+                                      reinterpret_cast<void **>(&dst)));
+        std::fill(src, src + allocSize, 0);
+        std::fill(dst, dst + allocSize, 0);
+    }
+
+    void TearDown() override {
+        if (src) {
+            EXPECT_SUCCESS(urUSMFree(context, src));
+        }
+        if (dst) {
+            EXPECT_SUCCESS(urUSMFree(context, dst));
+        }
+        if (queue) {
+            EXPECT_SUCCESS(urQueueRelease(queue));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(urContextTest::TearDown());
+    }
+
+    // Fills every chunk of src with its index, one command per chunk.
+    void fillChunks() {
+        for (uint8_t i = 0; i < numChunks; i++) {
+            ASSERT_SUCCESS(urEnqueueUSMFill(queue, src + i * chunkSize,
+                                            sizeof(i), &i, chunkSize, 0,
+                                            nullptr, nullptr));
+        }
+    }
+
+    void checkChunks(const uint8_t *data) {
+        for (size_t i = 0; i < allocSize; i++) {
+            ASSERT_EQ(data[i], i / chunkSize) << "at offset " << i;
+        }
+    }
+
+    void checkPattern(const uint8_t *data, uint8_t pattern) {
+        for (size_t i = 0; i < allocSize; i++) {
+            ASSERT_EQ(data[i], pattern) << "at offset " << i;
+        }
+    }
+
+    static constexpr uint8_t numChunks = 16;
+    static constexpr size_t chunkSize = 64 * 1024;
+    static constexpr size_t allocSize = numChunks * chunkSize;
+
+    const ur_queue_flags_t queueFlags;
+    ur_queue_handle_t queue = nullptr;
+    uint8_t *src = nullptr;
+    uint8_t *dst = nullptr;
+};
+} // namespace uur
+
+#endif // UR_TEST_ADAPTERS_LEVEL_ZERO_V2_FIXTURES_H_INCLUDED
@@ -0,0 +1,81 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "fixtures.h"
+#include "uur/raii.h"
+
+#include <vector>
+
+// The host memory of a mapping is only returned to the pool once the copy
+// back to the device has completed, these tests check that the staging
+// memory is not reused while it is still being read.
+struct urQueueMapTest : uur::urQueueHostMemTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(urQueueHostMemTest::SetUp());
+        ASSERT_SUCCESS(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE,
+                                         allocSize, nullptr, &buffer));
+    }
+
+    void TearDown() override {
+        if (buffer) {
+            EXPECT_SUCCESS(urMemRelease(buffer));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(urQueueHostMemTest::TearDown());
+    }
+
+    // Maps a chunk of the buffer, writes the pattern to it and unmaps it.
+    void writeChunk(size_t offset, uint8_t pattern,
+                    ur_event_handle_t *phEvent) {
+        uint8_t *mapped = nullptr;
+        ASSERT_SUCCESS(urEnqueueMemBufferMap(
+            queue, buffer, true, UR_MAP_FLAG_WRITE_INVALIDATE_REGION, offset,
+            chunkSize, 0, nullptr, nullptr,
+            reinterpret_cast<void **>(&mapped)));
+        std::fill(mapped, mapped + chunkSize, pattern);
+        ASSERT_SUCCESS(
+            urEnqueueMemUnmap(queue, buffer, mapped, 0, nullptr, phEvent));
+    }
+
+    void checkBuffer() {
+        ASSERT_SUCCESS(urEnqueueMemBufferRead(queue, buffer, true, 0,
+                                              allocSize, dst, 0, nullptr,
+                                              nullptr));
+        UUR_RETURN_ON_FATAL_FAILURE(checkChunks(dst));
+    }
+
+    ur_mem_handle_t buffer = nullptr;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urQueueMapTest);
+
+TEST_P(urQueueMapTest, UnmapWithoutEvents) {
+    for (size_t i = 0; i < numChunks; i++) {
+        UUR_RETURN_ON_FATAL_FAILURE(writeChunk(i * chunkSize, i, nullptr));
+    }
+    UUR_RETURN_ON_FATAL_FAILURE(checkBuffer());
+}
+
+TEST_P(urQueueMapTest, UnmapWithEvents) {
+    std::vector<uur::raii::Event> events(numChunks);
+    for (size_t i = 0; i < numChunks; i++) {
+        UUR_RETURN_ON_FATAL_FAILURE(
+            writeChunk(i * chunkSize, i, events[i].ptr()));
+    }
+
+    ASSERT_SUCCESS(urEventWait(1, events.back().ptr()));
+    UUR_RETURN_ON_FATAL_FAILURE(checkBuffer());
+}
+
+TEST_P(urQueueMapTest, ReleaseQueueWithPendingUnmaps) {
+    for (size_t i = 0; i < numChunks; i++) {
+        UUR_RETURN_ON_FATAL_FAILURE(writeChunk(i * chunkSize, i, nullptr));
+    }
+
+    // Releasing the queue waits for the copies of the unmaps.
+    ASSERT_SUCCESS(urQueueRelease(queue));
+    queue = nullptr;
+
+    ASSERT_SUCCESS(urQueueCreate(context, device, nullptr, &queue));
+    UUR_RETURN_ON_FATAL_FAILURE(checkBuffer());
+}
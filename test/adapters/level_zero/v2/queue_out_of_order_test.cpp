@@ -0,0 +1,89 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "fixtures.h"
+#include "uur/raii.h"
+
+#include <vector>
+
+// Every chunk is filled by its own command, so that the commands are spread
+// over the lanes of the queue.
+struct urQueueOutOfOrderTest : uur::urQueueHostMemTest {
+    urQueueOutOfOrderTest()
+        : urQueueHostMemTest(UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE) {}
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urQueueOutOfOrderTest);
+
+TEST_P(urQueueOutOfOrderTest, ReportsOutOfOrderFlag) {
+    ur_queue_flags_t flags = 0;
+    ASSERT_SUCCESS(urQueueGetInfo(queue, UR_QUEUE_INFO_FLAGS, sizeof(flags),
+                                  &flags, nullptr));
+    ASSERT_TRUE(flags & UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE);
+}
+
+TEST_P(urQueueOutOfOrderTest, EventsBelongToTheQueue) {
+    uur::raii::Event event;
+    uint8_t pattern = 1;
+    ASSERT_SUCCESS(urEnqueueUSMFill(queue, src, sizeof(pattern), &pattern,
+                                    allocSize, 0, nullptr, event.ptr()));
+    ASSERT_SUCCESS(urEventWait(1, event.ptr()));
+
+    ur_queue_handle_t eventQueue = nullptr;
+    ASSERT_SUCCESS(urEventGetInfo(event, UR_EVENT_INFO_COMMAND_QUEUE,
+                                  sizeof(eventQueue), &eventQueue, nullptr));
+    ASSERT_EQ(eventQueue, queue);
+}
+
+TEST_P(urQueueOutOfOrderTest, BarrierOrdersCommands) {
+    UUR_RETURN_ON_FATAL_FAILURE(fillChunks());
+    ASSERT_SUCCESS(urEnqueueEventsWaitWithBarrier(queue, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, false, dst, src, allocSize, 0,
+                                      nullptr, nullptr));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+
+    UUR_RETURN_ON_FATAL_FAILURE(checkChunks(dst));
+}
+
+TEST_P(urQueueOutOfOrderTest, BarrierWithoutCommands) {
+    uur::raii::Event first;
+    ASSERT_SUCCESS(
+        urEnqueueEventsWaitWithBarrier(queue, 0, nullptr, first.ptr()));
+    uur::raii::Event second;
+    ASSERT_SUCCESS(
+        urEnqueueEventsWaitWithBarrier(queue, 0, nullptr, second.ptr()));
+    ASSERT_SUCCESS(urEventWait(1, second.ptr()));
+    ASSERT_SUCCESS(urEventWait(1, first.ptr()));
+}
+
+TEST_P(urQueueOutOfOrderTest, EventsWaitWithoutWaitListWaitsForAll) {
+    UUR_RETURN_ON_FATAL_FAILURE(fillChunks());
+    uur::raii::Event event;
+    ASSERT_SUCCESS(urEnqueueEventsWait(queue, 0, nullptr, event.ptr()));
+    ASSERT_SUCCESS(urEventWait(1, event.ptr()));
+
+    UUR_RETURN_ON_FATAL_FAILURE(checkChunks(src));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+}
+
+TEST_P(urQueueOutOfOrderTest, DependenciesAcrossLanes) {
+    std::vector<ur_event_handle_t> fills(numChunks);
+    for (uint8_t i = 0; i < numChunks; i++) {
+        ASSERT_SUCCESS(urEnqueueUSMFill(queue, src + i * chunkSize, sizeof(i),
+                                        &i, chunkSize, 0, nullptr, &fills[i]));
+    }
+    // Each copy depends on the fill of its chunk only, which usually ran on
+    // a different lane.
+    for (uint8_t i = 0; i < numChunks; i++) {
+        ASSERT_SUCCESS(urEnqueueUSMMemcpy(
+            queue, false, dst + i * chunkSize, src + i * chunkSize, chunkSize,
+            1, &fills[i], nullptr));
+    }
+    ASSERT_SUCCESS(urQueueFinish(queue));
+    for (auto event : fills) {
+        ASSERT_SUCCESS(urEventRelease(event));
+    }
+
+    UUR_RETURN_ON_FATAL_FAILURE(checkChunks(dst));
+}
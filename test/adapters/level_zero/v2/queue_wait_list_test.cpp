@@ -0,0 +1,91 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "fixtures.h"
+#include "uur/raii.h"
+
+// The in-order queue drops duplicates, its own events and completed events
+// from wait lists, these tests check that commands are still ordered.
+struct urQueueWaitListTest : uur::urQueueHostMemTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(urQueueHostMemTest::SetUp());
+        ASSERT_SUCCESS(urQueueCreate(context, device, nullptr, &otherQueue));
+    }
+
+    void TearDown() override {
+        if (otherQueue) {
+            EXPECT_SUCCESS(urQueueRelease(otherQueue));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(urQueueHostMemTest::TearDown());
+    }
+
+    void fill(ur_queue_handle_t hQueue, uint8_t pattern,
+              ur_event_handle_t *phEvent) {
+        ASSERT_SUCCESS(urEnqueueUSMFill(hQueue, src, sizeof(pattern), &pattern,
+                                        allocSize, 0, nullptr, phEvent));
+    }
+
+    ur_queue_handle_t otherQueue = nullptr;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urQueueWaitListTest);
+
+TEST_P(urQueueWaitListTest, DuplicateEvents) {
+    uur::raii::Event filled;
+    UUR_RETURN_ON_FATAL_FAILURE(fill(otherQueue, 1, filled.ptr()));
+
+    ur_event_handle_t waitList[] = {filled, filled, filled};
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, false, dst, src, allocSize, 3,
+                                      waitList, nullptr));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+
+    UUR_RETURN_ON_FATAL_FAILURE(checkPattern(dst, 1));
+}
+
+TEST_P(urQueueWaitListTest, EventsOfTheSameQueue) {
+    uur::raii::Event filled;
+    UUR_RETURN_ON_FATAL_FAILURE(fill(queue, 2, filled.ptr()));
+
+    uur::raii::Event copied;
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, false, dst, src, allocSize, 1,
+                                      filled.ptr(), copied.ptr()));
+    ASSERT_SUCCESS(urEventWait(1, copied.ptr()));
+
+    UUR_RETURN_ON_FATAL_FAILURE(checkPattern(dst, 2));
+}
+
+TEST_P(urQueueWaitListTest, CompletedEvents) {
+    uur::raii::Event filled;
+    UUR_RETURN_ON_FATAL_FAILURE(fill(otherQueue, 3, filled.ptr()));
+    ASSERT_SUCCESS(urEventWait(1, filled.ptr()));
+
+    // Only completed events, nothing is left to wait for.
+    uur::raii::Event waited;
+    ur_event_handle_t waitList[] = {filled, filled};
+    ASSERT_SUCCESS(urEnqueueEventsWait(queue, 2, waitList, waited.ptr()));
+    ASSERT_SUCCESS(urEventWait(1, waited.ptr()));
+
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, true, dst, src, allocSize, 2,
+                                      waitList, nullptr));
+
+    UUR_RETURN_ON_FATAL_FAILURE(checkPattern(dst, 3));
+}
+
+TEST_P(urQueueWaitListTest, MixedEvents) {
+    uint8_t pattern = 4;
+    uur::raii::Event ownEvent;
+    ASSERT_SUCCESS(urEnqueueUSMFill(queue, src, sizeof(pattern), &pattern,
+                                    allocSize / 2, 0, nullptr, ownEvent.ptr()));
+    uur::raii::Event otherEvent;
+    ASSERT_SUCCESS(urEnqueueUSMFill(otherQueue, src + allocSize / 2,
+                                    sizeof(pattern), &pattern, allocSize / 2,
+                                    0, nullptr, otherEvent.ptr()));
+
+    ur_event_handle_t waitList[] = {otherEvent, ownEvent, otherEvent, ownEvent};
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, false, dst, src, allocSize, 4,
+                                      waitList, nullptr));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+
+    UUR_RETURN_ON_FATAL_FAILURE(checkPattern(dst, 4));
+}
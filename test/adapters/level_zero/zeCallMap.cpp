@@ -3,11 +3,9 @@
 // See LICENSE.TXT
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
-#include <map>
-#include <string>
+#include "ze_call_stats.hpp"
 
-// Map used by L0 adapter to count the number of calls to each L0 function
-// Lifetime is managed by the adapter, this variable is defined here
-// only so that we can read it from the tests.
-__attribute__((visibility("default"))) std::map<std::string, int> *ZeCallCount =
-    nullptr;
+// Counters used by L0 adapter to count the number of calls to each L0
+// function, this variable is defined here only so that we can read it from
+// the tests.
+__attribute__((visibility("default"))) ze_call_stats_t ZeCallStats;
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <uur/fixtures.h>
+#include <uur/raii.h>
 
 struct urEnqueueKernelLaunchTest : uur::urKernelExecutionTest {
     void SetUp() override {
@@ -69,6 +70,32 @@ TEST_P(urEnqueueKernelLaunchTest, Success) {
     ValidateBuffer(buffer, sizeof(val) * global_size, val);
 }
 
+TEST_P(urEnqueueKernelLaunchTest, SuccessArgChangedBetweenLaunches) {
+    ur_mem_handle_t buffer = nullptr;
+    size_t buffer_index = 0;
+    AddBuffer1DArg(sizeof(val) * global_size, &buffer, &buffer_index);
+    AddPodArg(val);
+    ASSERT_SUCCESS(urEnqueueKernelLaunch(queue, kernel, n_dimensions,
+                                         &global_offset, &global_size, nullptr,
+                                         0, nullptr, nullptr));
+
+    // The second launch writes to another buffer, the first launch must not
+    // see it even though it may not have started yet.
+    uur::raii::Mem other_buffer;
+    ASSERT_SUCCESS(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE,
+                                     sizeof(val) * global_size, nullptr,
+                                     other_buffer.ptr()));
+    ASSERT_SUCCESS(urKernelSetArgMemObj(kernel, buffer_index, nullptr,
+                                        other_buffer));
+    ASSERT_SUCCESS(urEnqueueKernelLaunch(queue, kernel, n_dimensions,
+                                         &global_offset, &global_size, nullptr,
+                                         0, nullptr, nullptr));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+
+    ValidateBuffer(buffer, sizeof(val) * global_size, val);
+    ValidateBuffer(other_buffer.get(), sizeof(val) * global_size, val);
+}
+
 TEST_P(urEnqueueKernelLaunchTest, InvalidNullHandleQueue) {
     ASSERT_EQ_RESULT(urEnqueueKernelLaunch(nullptr, kernel, n_dimensions,
                                            &global_offset, &global_size,
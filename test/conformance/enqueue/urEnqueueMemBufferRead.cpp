@@ -151,3 +151,56 @@ TEST_F(urEnqueueMemBufferReadMultiDeviceTest, WriteReadDifferentQueues) {
             << "Result on queue " << i << " did not match!";
     }
 }
+
+TEST_F(urEnqueueMemBufferReadMultiDeviceTest,
+       NonBlockingWriteReadDifferentQueues) {
+    // First queue does a non-blocking write of 42 into the buffer.
+    std::vector<uint32_t> input(count, 42);
+    ur_event_handle_t writeEvent = nullptr;
+    ASSERT_SUCCESS(urEnqueueMemBufferWrite(queues[0], buffer, false, 0, size,
+                                           input.data(), 0, nullptr,
+                                           &writeEvent));
+
+    // Then the remaining queues do blocking reads from the buffer which only
+    // wait for the write through its event, so the memory of the other
+    // devices has to be synchronized after the write completes.
+    for (unsigned i = 1; i < queues.size(); ++i) {
+        const auto queue = queues[i];
+        std::vector<uint32_t> output(count, 0);
+        ASSERT_SUCCESS(urEnqueueMemBufferRead(queue, buffer, true, 0, size,
+                                              output.data(), 1, &writeEvent,
+                                              nullptr));
+        ASSERT_EQ(input, output)
+            << "Result on queue " << i << " did not match!";
+    }
+
+    ASSERT_SUCCESS(urQueueFinish(queues[0]));
+    ASSERT_SUCCESS(urEventRelease(writeEvent));
+}
+
+TEST_F(urEnqueueMemBufferReadMultiDeviceTest, WriteSlicesReadDifferentQueues) {
+    // Each queue does a blocking write of its index into its own slice of the
+    // buffer, which only partially overwrites what the other queues wrote.
+    const size_t sliceCount = count / queues.size();
+    const size_t sliceSize = sliceCount * sizeof(uint32_t);
+    const size_t writtenCount = sliceCount * queues.size();
+    std::vector<uint32_t> expected(writtenCount);
+    for (unsigned i = 0; i < queues.size(); ++i) {
+        std::vector<uint32_t> input(sliceCount, i);
+        std::fill_n(expected.begin() + i * sliceCount, sliceCount, i);
+        ASSERT_SUCCESS(urEnqueueMemBufferWrite(queues[i], buffer, true,
+                                               i * sliceSize, sliceSize,
+                                               input.data(), 0, nullptr,
+                                               nullptr));
+    }
+
+    // Then every queue reads back the slices written on all the devices.
+    for (unsigned i = 0; i < queues.size(); ++i) {
+        std::vector<uint32_t> output(writtenCount, 0);
+        ASSERT_SUCCESS(urEnqueueMemBufferRead(
+            queues[i], buffer, true, 0, writtenCount * sizeof(uint32_t),
+            output.data(), 0, nullptr, nullptr));
+        ASSERT_EQ(expected, output)
+            << "Result on queue " << i << " did not match!";
+    }
+}
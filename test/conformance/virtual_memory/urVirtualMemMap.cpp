@@ -3,6 +3,7 @@
 // See LICENSE.TXT
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 #include <uur/fixtures.h>
+#include <uur/raii.h>
 
 using urVirtualMemMapTest = uur::urVirtualMemTest;
 UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urVirtualMemMapTest);
@@ -37,3 +38,72 @@ TEST_P(urVirtualMemMapTest, InvalidEnumerationFlags) {
                                      UR_VIRTUAL_MEM_ACCESS_FLAG_FORCE_UINT32),
                      UR_RESULT_ERROR_INVALID_ENUMERATION);
 }
+
+TEST_P(urVirtualMemMapTest, InvalidSizeOffsetUnaligned) {
+    if (granularity < 2) {
+        GTEST_SKIP() << "Every offset is aligned to the granularity.";
+    }
+    ASSERT_EQ_RESULT(urVirtualMemMap(context, virtual_ptr, granularity,
+                                     physical_mem, granularity / 2,
+                                     UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE),
+                     UR_RESULT_ERROR_INVALID_SIZE);
+}
+
+TEST_P(urVirtualMemMapTest, SuccessSharedBetweenMappings) {
+    void *second_ptr = nullptr;
+    ASSERT_SUCCESS(urVirtualMemReserve(context, nullptr, size, &second_ptr));
+    ASSERT_SUCCESS(urVirtualMemMap(context, virtual_ptr, size, physical_mem, 0,
+                                   UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE));
+    ASSERT_SUCCESS(urVirtualMemMap(context, second_ptr, size, physical_mem, 0,
+                                   UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE));
+
+    uur::raii::Queue queue = nullptr;
+    ASSERT_SUCCESS(urQueueCreate(context, device, nullptr, queue.ptr()));
+
+    // Write through the first mapping and read through the second one.
+    const uint32_t pattern = 0xC0FFEE;
+    ASSERT_SUCCESS(urEnqueueUSMFill(queue, virtual_ptr, sizeof(pattern),
+                                    &pattern, size, 0, nullptr, nullptr));
+    std::vector<uint32_t> result(size / sizeof(uint32_t));
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, true, result.data(), second_ptr,
+                                      size, 0, nullptr, nullptr));
+    for (auto value : result) {
+        ASSERT_EQ(value, pattern);
+    }
+
+    EXPECT_SUCCESS(urVirtualMemUnmap(context, second_ptr, size));
+    EXPECT_SUCCESS(urVirtualMemUnmap(context, virtual_ptr, size));
+    EXPECT_SUCCESS(urVirtualMemFree(context, second_ptr, size));
+}
+
+TEST_P(urVirtualMemMapTest, SuccessRemapAtOffset) {
+    ASSERT_SUCCESS(urVirtualMemMap(context, virtual_ptr, size, physical_mem, 0,
+                                   UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE));
+
+    uur::raii::Queue queue = nullptr;
+    ASSERT_SUCCESS(urQueueCreate(context, device, nullptr, queue.ptr()));
+
+    // Give the first two granules of the physical memory different content.
+    const uint32_t first = 1;
+    const uint32_t second = 2;
+    ASSERT_SUCCESS(urEnqueueUSMFill(queue, virtual_ptr, sizeof(first), &first,
+                                    granularity, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urEnqueueUSMFill(
+        queue, static_cast<char *>(virtual_ptr) + granularity, sizeof(second),
+        &second, granularity, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+    ASSERT_SUCCESS(urVirtualMemUnmap(context, virtual_ptr, size));
+
+    // The start of the range now maps the second granule.
+    ASSERT_SUCCESS(urVirtualMemMap(context, virtual_ptr, granularity,
+                                   physical_mem, granularity,
+                                   UR_VIRTUAL_MEM_ACCESS_FLAG_READ_ONLY));
+    std::vector<uint32_t> result(granularity / sizeof(uint32_t));
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, true, result.data(), virtual_ptr,
+                                      granularity, 0, nullptr, nullptr));
+    for (auto value : result) {
+        ASSERT_EQ(value, second);
+    }
+
+    EXPECT_SUCCESS(urVirtualMemUnmap(context, virtual_ptr, granularity));
+}
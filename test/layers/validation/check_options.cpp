@@ -0,0 +1,43 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Runs with UR_LAYER_VALIDATION_OPTIONS=params:0, which leaves only the wait
+// list and lifetime checks enabled.
+
+#include "fixtures.hpp"
+
+struct valQueueTest : valDeviceTest {
+    void SetUp() override {
+        valDeviceTest::SetUp();
+        ASSERT_EQ(urContextCreate(1, &device, nullptr, &context),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urQueueCreate(context, device, nullptr, &queue),
+                  UR_RESULT_SUCCESS);
+    }
+
+    void TearDown() override {
+        ASSERT_EQ(urQueueRelease(queue), UR_RESULT_SUCCESS);
+        ASSERT_EQ(urContextRelease(context), UR_RESULT_SUCCESS);
+        valDeviceTest::TearDown();
+    }
+
+    ur_context_handle_t context = nullptr;
+    ur_queue_handle_t queue = nullptr;
+};
+
+TEST_F(valQueueTest, testParameterChecksDisabled) {
+    // An invalid flag and a null pointer reach the mock adapter, which
+    // accepts anything.
+    ASSERT_EQ(urEnqueueUSMPrefetch(queue, nullptr, 0,
+                                   UR_USM_MIGRATION_FLAG_FORCE_UINT32, 0,
+                                   nullptr, nullptr),
+              UR_RESULT_SUCCESS);
+}
+
+TEST_F(valQueueTest, testWaitListChecksEnabled) {
+    ur_event_handle_t event = nullptr;
+    ASSERT_EQ(urEnqueueEventsWait(queue, 1, &event, nullptr),
+              UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+}
@@ -106,6 +106,17 @@ struct adapterPreFilterTest : ::testing::Test {
             return std::any_of(paths.cbegin(), paths.cend(), isCudaLibName);
         };
 
+    const fs::path nativeCpuLibName =
+        MAKE_LIBRARY_NAME("ur_adapter_native_cpu", "0");
+    std::function<bool(const fs::path &)> isNativeCpuLibName =
+        [this](const fs::path &path) { return path == nativeCpuLibName; };
+
+    std::function<bool(const std::vector<fs::path> &)> hasNativeCpuLibName =
+        [this](const std::vector<fs::path> &paths) {
+            return std::any_of(paths.cbegin(), paths.cend(),
+                               isNativeCpuLibName);
+        };
+
     void SetUp(std::string filter) {
         try {
             setenv("ONEAPI_DEVICE_SELECTOR", filter.c_str(), 1);
@@ -33,6 +33,19 @@ TEST_F(adapterPreFilterTest, testPrefilterAcceptFilterMultipleBackends) {
     EXPECT_FALSE(cudaExists);
 }
 
+TEST_F(adapterPreFilterTest, testPrefilterAcceptFilterNativeCpu) {
+    SetUp("native_cpu:*");
+    auto nativeCpuExists =
+        std::any_of(registry->cbegin(), registry->cend(), hasNativeCpuLibName);
+    EXPECT_TRUE(nativeCpuExists);
+    auto levelZeroExists =
+        std::any_of(registry->cbegin(), registry->cend(), haslevelzeroLibName);
+    EXPECT_FALSE(levelZeroExists);
+    auto openclExists =
+        std::any_of(registry->cbegin(), registry->cend(), hasOpenclLibName);
+    EXPECT_FALSE(openclExists);
+}
+
 TEST_F(adapterPreFilterTest, testPrefilterDiscardFilterSingleBackend) {
     SetUp("!level_zero:*");
     auto levelZeroExists =
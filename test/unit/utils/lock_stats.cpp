@@ -0,0 +1,108 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include "ur/ur.hpp"
+
+#include <shared_mutex>
+
+// The test is run with UR_LOCK_STATS=1.
+struct lockStatsTest : ::testing::Test {
+    void SetUp() override {
+        if (!LockStatsBuilt) {
+            GTEST_SKIP() << "built with UR_ENABLE_LOCK_STATS=OFF";
+        }
+        urLockStatsReset();
+    }
+
+    static std::optional<ur_lock_stats_t> getSite(const std::string &name) {
+        for (auto &stats : urLockStatsGet()) {
+            if (stats.Name == name) {
+                return stats;
+            }
+        }
+        return std::nullopt;
+    }
+};
+
+TEST_F(lockStatsTest, CountsAcquisitions) {
+    ur_mutex mutex{"test.mutex"};
+    for (int i = 0; i < 3; i++) {
+        std::lock_guard<ur_mutex> lock(mutex);
+    }
+    {
+        ur_lock lock(mutex);
+    }
+    ASSERT_TRUE(mutex.try_lock());
+    mutex.unlock();
+
+    auto stats = getSite("test.mutex");
+    ASSERT_TRUE(stats);
+    EXPECT_EQ(stats->Acquisitions, 5);
+    EXPECT_EQ(stats->Contended, 0);
+    EXPECT_EQ(stats->WaitNs, 0);
+}
+
+TEST_F(lockStatsTest, SharedAndSpinLocks) {
+    ur_shared_mutex shared{"test.shared"};
+    {
+        std::shared_lock<ur_shared_mutex> lock(shared);
+    }
+    {
+        std::scoped_lock<ur_shared_mutex> lock(shared);
+    }
+
+    SpinLock spin{"test.spin"};
+    spin.lock();
+    spin.unlock();
+
+    // Unnamed spin locks are not tracked.
+    SpinLock unnamed;
+    unnamed.lock();
+    unnamed.unlock();
+
+    auto sharedStats = getSite("test.shared");
+    ASSERT_TRUE(sharedStats);
+    EXPECT_EQ(sharedStats->Acquisitions, 2);
+
+    auto spinStats = getSite("test.spin");
+    ASSERT_TRUE(spinStats);
+    EXPECT_EQ(spinStats->Acquisitions, 1);
+}
+
+TEST_F(lockStatsTest, CountsContention) {
+    ur_mutex mutex{"test.contended"};
+    std::atomic<bool> started{false};
+
+    mutex.lock();
+    std::thread waiter([&]() {
+        started = true;
+        std::lock_guard<ur_mutex> lock(mutex);
+    });
+    while (!started) {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    mutex.unlock();
+    waiter.join();
+
+    auto stats = getSite("test.contended");
+    ASSERT_TRUE(stats);
+    EXPECT_EQ(stats->Acquisitions, 2);
+    EXPECT_EQ(stats->Contended, 1);
+    EXPECT_GT(stats->WaitNs, 0);
+    EXPECT_GE(stats->HoldNs, 20'000'000);
+}
+
+TEST_F(lockStatsTest, Reset) {
+    ur_mutex mutex{"test.reset"};
+    mutex.lock();
+    mutex.unlock();
+    ASSERT_TRUE(getSite("test.reset"));
+
+    urLockStatsReset();
+    EXPECT_FALSE(getSite("test.reset"));
+}
@@ -5,8 +5,10 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <sstream>
 
 #include "print.h"
+#include "ur_print.hpp"
 
 TEST(Print, KernelInfo) {
     constexpr size_t BUFF_SIZE = 1024;
@@ -34,3 +36,87 @@ TYPED_TEST(ParamsTest, GetParams) {
     EXPECT_THAT(std::string(buffer), MatchesRegex(this->params.get_expected()));
     EXPECT_EQ(out_len, strlen(buffer) + 1);
 }
+
+TEST(PrintWriter, Enum) {
+    char data[64];
+    ur::writer::buffer_t buf(data, sizeof(data));
+    ur::writer::print(buf, UR_KERNEL_INFO_FUNCTION_NAME);
+    ASSERT_TRUE(buf.terminate());
+    EXPECT_STREQ(data, "UR_KERNEL_INFO_FUNCTION_NAME");
+    EXPECT_EQ(ur::writer::toString(UR_RESULT_SUCCESS), "UR_RESULT_SUCCESS");
+    EXPECT_TRUE(ur::writer::toString(UR_RESULT_FORCE_UINT32).empty());
+}
+
+TEST(PrintWriter, Flags) {
+    char data[256];
+    ur::writer::buffer_t buf(data, sizeof(data));
+    ur::writer::printFlag<ur_device_init_flag_t>(
+        buf, UR_DEVICE_INIT_FLAG_GPU | UR_DEVICE_INIT_FLAG_FPGA | UR_BIT(30));
+    ASSERT_TRUE(buf.terminate());
+
+    std::ostringstream os;
+    ur::details::printFlag<ur_device_init_flag_t>(
+        os, UR_DEVICE_INIT_FLAG_GPU | UR_DEVICE_INIT_FLAG_FPGA | UR_BIT(30));
+    EXPECT_EQ(std::string(data), os.str());
+}
+
+TEST(PrintWriter, Integers) {
+    char data[128];
+    ur::writer::buffer_t buf(data, sizeof(data));
+    ur::writer::writeUnsigned(buf, 0);
+    buf.put(' ');
+    ur::writer::writeUnsigned(buf, UINT64_MAX);
+    buf.put(' ');
+    ur::writer::writeSigned(buf, INT64_MIN);
+    buf.put(' ');
+    ur::writer::writeHex(buf, 0xdeadbeef);
+    buf.put(' ');
+    ur::writer::writePtr(buf, nullptr);
+    ASSERT_TRUE(buf.terminate());
+    EXPECT_STREQ(data,
+                 "0 18446744073709551615 -9223372036854775808 0xdeadbeef "
+                 "nullptr");
+}
+
+TEST(PrintWriter, Struct) {
+    ur_usm_desc_t desc = {UR_STRUCTURE_TYPE_USM_DESC, nullptr,
+                          UR_USM_ADVICE_FLAG_DEFAULT, 64};
+    char data[256];
+    ur::writer::buffer_t buf(data, sizeof(data));
+    ur::writer::print(buf, desc);
+    ASSERT_TRUE(buf.terminate());
+    EXPECT_STREQ(data, "(struct ur_usm_desc_t){.stype = "
+                       "UR_STRUCTURE_TYPE_USM_DESC, .pNext = nullptr, .hints "
+                       "= UR_USM_ADVICE_FLAG_DEFAULT, .align = 64}");
+
+    std::ostringstream os;
+    os << desc;
+    EXPECT_EQ(std::string(data), os.str());
+}
+
+TEST(PrintWriter, Truncated) {
+    char data[8];
+    ur::writer::buffer_t buf(data, sizeof(data));
+    ur::writer::print(buf, UR_KERNEL_INFO_FUNCTION_NAME);
+    EXPECT_TRUE(buf.truncated());
+    EXPECT_FALSE(buf.terminate());
+    EXPECT_EQ(buf.size(), strlen("UR_KERNEL_INFO_FUNCTION_NAME"));
+    EXPECT_EQ(buf.str(), "UR_KERNE");
+
+    size_t out_len = 0;
+    EXPECT_EQ(urPrintKernelInfo(UR_KERNEL_INFO_FUNCTION_NAME, data,
+                                sizeof(data), &out_len),
+              UR_RESULT_ERROR_INVALID_SIZE);
+    EXPECT_EQ(out_len, strlen("UR_KERNEL_INFO_FUNCTION_NAME") + 1);
+}
+
+TEST(PrintWriter, GrowString) {
+    std::string storage;
+    auto buf = ur::writer::stringBuffer(storage);
+    for (int i = 0; i < 100; i++) {
+        ur::writer::print(buf, UR_KERNEL_INFO_FUNCTION_NAME);
+    }
+    EXPECT_FALSE(buf.truncated());
+    EXPECT_EQ(buf.size(), 100 * strlen("UR_KERNEL_INFO_FUNCTION_NAME"));
+    EXPECT_EQ(buf.str().substr(0, 28), "UR_KERNEL_INFO_FUNCTION_NAME");
+}
@@ -0,0 +1,103 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include "ur_stack_depot.hpp"
+
+#include <map>
+#include <thread>
+
+static std::vector<void *> makeFrames(uintptr_t seed, size_t count) {
+    std::vector<void *> frames;
+    for (size_t i = 0; i < count; i++) {
+        frames.push_back(reinterpret_cast<void *>(seed + i * 16));
+    }
+    return frames;
+}
+
+TEST(StackDepot, DeduplicatesStacks) {
+    auto frames = makeFrames(0x10000, 8);
+    auto id = stack_depot::put(frames.data(), frames.size());
+    ASSERT_NE(id, stack_depot::invalid_stack_id);
+    ASSERT_EQ(stack_depot::put(frames.data(), frames.size()), id);
+
+    auto stored = stack_depot::get(id);
+    ASSERT_EQ(std::vector<void *>(stored.begin(), stored.end()), frames);
+
+    // A prefix is a different stack.
+    ASSERT_NE(stack_depot::put(frames.data(), frames.size() - 1), id);
+}
+
+TEST(StackDepot, InvalidStacks) {
+    ASSERT_EQ(stack_depot::put(nullptr, 0), stack_depot::invalid_stack_id);
+    ASSERT_TRUE(stack_depot::get(stack_depot::invalid_stack_id).empty());
+    ASSERT_TRUE(stack_depot::get(~stack_depot::stack_id_t(0)).empty());
+}
+
+TEST(StackDepot, TruncatesDeepStacks) {
+    auto frames = makeFrames(0x20000, stack_depot::max_frames + 8);
+    auto id = stack_depot::put(frames.data(), frames.size());
+    ASSERT_EQ(stack_depot::get(id).size, stack_depot::max_frames);
+}
+
+TEST(StackDepot, ConcurrentInsertion) {
+    constexpr size_t numThreads = 8;
+    constexpr size_t numStacks = 256;
+
+    std::vector<std::vector<stack_depot::stack_id_t>> ids(numThreads);
+    std::vector<std::thread> threads;
+    size_t before = stack_depot::size();
+    for (size_t t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, t] {
+            for (size_t i = 0; i < numStacks; i++) {
+                auto frames = makeFrames(0x100000 + i * 0x1000, 4);
+                ids[t].push_back(stack_depot::put(frames.data(), 4));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    // Every thread inserted the same stacks, so they must agree on the ids.
+    for (size_t t = 1; t < numThreads; t++) {
+        ASSERT_EQ(ids[t], ids[0]);
+    }
+    ASSERT_EQ(stack_depot::size() - before, numStacks);
+}
+
+TEST(StackDepot, CaptureAndSymbolize) {
+    auto id = stack_depot::capture();
+    ASSERT_NE(id, stack_depot::invalid_stack_id);
+    auto frames = stack_depot::get(id);
+    ASSERT_FALSE(frames.empty());
+
+    std::map<std::string, size_t> calls;
+    stack_depot::symbolizer symbolizer(
+        [&](const std::string &module,
+            std::vector<stack_depot::frame_t *> &moduleFrames) {
+            calls[module]++;
+            stack_depot::symbolizeModule(module, moduleFrames);
+        });
+    symbolizer.add(id);
+    symbolizer.add(id);
+    symbolizer.resolve();
+
+    // Frames are handed over once per module.
+    for (auto &[module, count] : calls) {
+        ASSERT_EQ(count, 1) << module;
+    }
+    for (void *pc : frames) {
+        ASSERT_FALSE(symbolizer.frame(pc).symbol.empty());
+    }
+    ASSERT_FALSE(symbolizer.frame(frames.data[0]).module.empty());
+
+    // Nothing is left to symbolize for a stack seen before.
+    calls.clear();
+    symbolizer.add(id);
+    symbolizer.resolve();
+    ASSERT_TRUE(calls.empty());
+}
@@ -0,0 +1,189 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures the per-call cost of hot Unified Runtime entry points through the
+// full loader stack. Layers are selected with UR_ENABLE_LAYERS, so running the
+// same binary with different layer combinations shows the dispatch overhead
+// each layer adds.
+
+#include "bench_utils.hpp"
+
+#include <benchmark/benchmark.h>
+
+namespace urbench {
+
+static device_env_t env;
+static ur_queue_handle_t queue = nullptr;
+static void *src = nullptr;
+static void *dst = nullptr;
+
+constexpr size_t allocSize = 4096;
+constexpr size_t copySize = 64;
+
+// Commands are submitted without events, so the queue is drained periodically
+// outside of the timed region to keep its depth bounded.
+constexpr int64_t drainInterval = 256;
+
+static void drainQueue(benchmark::State &state) {
+    if (state.iterations() % drainInterval == 0) {
+        state.PauseTiming();
+        UR_CHECK(urQueueFinish(queue));
+        state.ResumeTiming();
+    }
+}
+
+static void BM_EnqueueKernelLaunch(benchmark::State &state) {
+    if (!env.kernel) {
+        state.SkipWithError("no kernel, pass --il or --binary");
+        return;
+    }
+    size_t globalOffset = 0;
+    size_t globalSize = 1;
+    for (auto _ : state) {
+        UR_CHECK(urEnqueueKernelLaunch(queue, env.kernel, 1, &globalOffset,
+                                       &globalSize, nullptr, 0, nullptr,
+                                       nullptr));
+        drainQueue(state);
+    }
+    UR_CHECK(urQueueFinish(queue));
+}
+BENCHMARK(BM_EnqueueKernelLaunch);
+
+static void BM_EnqueueUSMMemcpy(benchmark::State &state) {
+    for (auto _ : state) {
+        UR_CHECK(urEnqueueUSMMemcpy(queue, false, dst, src, copySize, 0,
+                                    nullptr, nullptr));
+        drainQueue(state);
+    }
+    UR_CHECK(urQueueFinish(queue));
+}
+BENCHMARK(BM_EnqueueUSMMemcpy);
+
+static void BM_EnqueueUSMFill(benchmark::State &state) {
+    uint32_t pattern = 42;
+    for (auto _ : state) {
+        UR_CHECK(urEnqueueUSMFill(queue, dst, sizeof(pattern), &pattern,
+                                  copySize, 0, nullptr, nullptr));
+        drainQueue(state);
+    }
+    UR_CHECK(urQueueFinish(queue));
+}
+BENCHMARK(BM_EnqueueUSMFill);
+
+static void BM_EnqueueWithEvent(benchmark::State &state) {
+    uint32_t pattern = 42;
+    for (auto _ : state) {
+        ur_event_handle_t event = nullptr;
+        UR_CHECK(urEnqueueUSMFill(queue, dst, sizeof(pattern), &pattern,
+                                  copySize, 0, nullptr, &event));
+        UR_CHECK(urEventRelease(event));
+        drainQueue(state);
+    }
+    UR_CHECK(urQueueFinish(queue));
+}
+BENCHMARK(BM_EnqueueWithEvent);
+
+static void BM_EventWaitCompleted(benchmark::State &state) {
+    uint32_t pattern = 42;
+    ur_event_handle_t event = nullptr;
+    UR_CHECK(urEnqueueUSMFill(queue, dst, sizeof(pattern), &pattern, copySize,
+                              0, nullptr, &event));
+    UR_CHECK(urQueueFinish(queue));
+    for (auto _ : state) {
+        UR_CHECK(urEventWait(1, &event));
+    }
+    UR_CHECK(urEventRelease(event));
+}
+BENCHMARK(BM_EventWaitCompleted);
+
+static void BM_ContextRetainRelease(benchmark::State &state) {
+    for (auto _ : state) {
+        UR_CHECK(urContextRetain(env.context));
+        UR_CHECK(urContextRelease(env.context));
+    }
+}
+BENCHMARK(BM_ContextRetainRelease);
+
+static void BM_QueueRetainRelease(benchmark::State &state) {
+    for (auto _ : state) {
+        UR_CHECK(urQueueRetain(queue));
+        UR_CHECK(urQueueRelease(queue));
+    }
+}
+BENCHMARK(BM_QueueRetainRelease);
+
+static void BM_DeviceGetInfo(benchmark::State &state) {
+    ur_device_type_t type;
+    for (auto _ : state) {
+        UR_CHECK(urDeviceGetInfo(env.device, UR_DEVICE_INFO_TYPE, sizeof(type),
+                                 &type, nullptr));
+        benchmark::DoNotOptimize(type);
+    }
+}
+BENCHMARK(BM_DeviceGetInfo);
+
+static void BM_EventGetInfoStatus(benchmark::State &state) {
+    uint32_t pattern = 42;
+    ur_event_handle_t event = nullptr;
+    UR_CHECK(urEnqueueUSMFill(queue, dst, sizeof(pattern), &pattern, copySize,
+                              0, nullptr, &event));
+    UR_CHECK(urQueueFinish(queue));
+    ur_event_status_t status;
+    for (auto _ : state) {
+        UR_CHECK(urEventGetInfo(event, UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                                sizeof(status), &status, nullptr));
+        benchmark::DoNotOptimize(status);
+    }
+    UR_CHECK(urEventRelease(event));
+}
+BENCHMARK(BM_EventGetInfoStatus);
+
+static device_options_t parseArgs(int argc, const char **argv) {
+    static const char *usage = "usage: %s [benchmark options] [options]\n"
+                               "\n"
+                               "Measures the per-call overhead of Unified "
+                               "Runtime entry points through the\n"
+                               "loader. Layers are enabled with the "
+                               "UR_ENABLE_LAYERS environment variable.\n"
+                               "Google Benchmark options such as "
+                               "--benchmark_format=json are also accepted.\n"
+                               "\n"
+                               "options:\n"
+                               "  -h, --help            show this help "
+                               "message and exit\n" URBENCH_DEVICE_OPTIONS_USAGE;
+    device_options_t opts;
+    parseOptions(argc, argv, usage,
+                 [&](std::string_view arg, const option_value_fn_t &value) {
+                     return parseDeviceOption(opts, arg, value);
+                 });
+    return opts;
+}
+
+} // namespace urbench
+
+int main(int argc, char **argv) {
+    benchmark::Initialize(&argc, argv);
+    auto opts =
+        urbench::parseArgs(argc, const_cast<const char **>(argv));
+
+    urbench::env.init(opts);
+    UR_CHECK(urQueueCreate(urbench::env.context, urbench::env.device, nullptr,
+                           &urbench::queue));
+    UR_CHECK(urUSMSharedAlloc(urbench::env.context, urbench::env.device,
+                              nullptr, nullptr, urbench::allocSize,
+                              &urbench::src));
+    UR_CHECK(urUSMSharedAlloc(urbench::env.context, urbench::env.device,
+                              nullptr, nullptr, urbench::allocSize,
+                              &urbench::dst));
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    UR_CHECK(urUSMFree(urbench::env.context, urbench::src));
+    UR_CHECK(urUSMFree(urbench::env.context, urbench::dst));
+    UR_CHECK(urQueueRelease(urbench::queue));
+    urbench::env.teardown();
+    return 0;
+}
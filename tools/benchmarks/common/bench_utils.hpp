@@ -0,0 +1,254 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include "ur_api.h"
+#include "ur_print.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#define UR_CHECK(ACTION)                                                       \
+    if (auto error = ACTION) {                                                 \
+        std::cerr << "error: " #ACTION " failed: " << error << "\n";           \
+        std::exit(1);                                                          \
+    }                                                                          \
+    (void)0
+
+namespace urbench {
+
+using clock = std::chrono::steady_clock;
+
+inline double elapsedUs(clock::time_point start, clock::time_point end) {
+    return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+/// Summary statistics of a set of samples, in the unit of the samples.
+struct stats_t {
+    double mean = 0.0;
+    double median = 0.0;
+    double stddev = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+    size_t count = 0;
+};
+
+inline stats_t computeStats(std::vector<double> samples) {
+    stats_t stats;
+    stats.count = samples.size();
+    if (samples.empty()) {
+        return stats;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    stats.min = samples.front();
+    stats.max = samples.back();
+    stats.median = samples[samples.size() / 2];
+    stats.mean = std::accumulate(samples.begin(), samples.end(), 0.0) /
+                 static_cast<double>(samples.size());
+    if (samples.size() > 1) {
+        double sq = 0.0;
+        for (auto sample : samples) {
+            sq += (sample - stats.mean) * (sample - stats.mean);
+        }
+        stats.stddev = std::sqrt(sq / static_cast<double>(samples.size() - 1));
+    }
+    return stats;
+}
+
+inline ur_device_type_t parseDeviceType(const std::string &name) {
+    if (name == "cpu") {
+        return UR_DEVICE_TYPE_CPU;
+    } else if (name == "gpu") {
+        return UR_DEVICE_TYPE_GPU;
+    } else if (name == "fpga") {
+        return UR_DEVICE_TYPE_FPGA;
+    }
+    return UR_DEVICE_TYPE_ALL;
+}
+
+inline std::vector<uint8_t> readFile(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "error: unable to open " << path << "\n";
+        std::exit(1);
+    }
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), {});
+}
+
+/// Options shared by the benchmarks which run against a single device.
+struct device_options_t {
+    bool mock = false;
+    std::string deviceType = "all";
+    std::string ilPath;
+    std::string binaryPath;
+    std::string kernelName;
+};
+
+using option_value_fn_t = std::function<std::string()>;
+
+/// Calls handler(name, value) for every command line option, where value()
+/// returns the option value given as either "--opt value" or "--opt=value".
+/// The handler returns false for unknown options, which prints the usage.
+template <typename F>
+void parseOptions(int argc, const char **argv, const char *usage, F &&handler) {
+    for (int argi = 1; argi < argc; argi++) {
+        std::string_view arg{argv[argi]};
+        std::optional<std::string> inlineValue;
+        if (auto eq = arg.find('='); eq != std::string_view::npos) {
+            inlineValue = std::string(arg.substr(eq + 1));
+            arg = arg.substr(0, eq);
+        }
+        option_value_fn_t value = [&]() -> std::string {
+            if (inlineValue) {
+                return *inlineValue;
+            }
+            if (argi + 1 >= argc) {
+                std::fprintf(stderr, "error: missing value for %s\n",
+                             argv[argi]);
+                std::exit(1);
+            }
+            return argv[++argi];
+        };
+        if (arg == "-h" || arg == "--help") {
+            std::printf(usage, argv[0]);
+            std::exit(0);
+        } else if (!handler(arg, value)) {
+            std::fprintf(stderr, "error: invalid argument: %s\n", argv[argi]);
+            std::fprintf(stderr, usage, argv[0]);
+            std::exit(1);
+        }
+    }
+}
+
+/// Help text of the options handled by parseDeviceOption.
+#define URBENCH_DEVICE_OPTIONS_USAGE                                           \
+    "  --mock                use the mock adapter\n"                           \
+    "  --device-type TYPE    device type to select: all, cpu, gpu or fpga\n"   \
+    "  --il FILE             SPIR-V module containing the benchmark kernel\n"  \
+    "  --binary FILE         native binary containing the benchmark kernel\n"  \
+    "  --kernel NAME         name of the argument-less benchmark kernel\n"
+
+inline bool parseDeviceOption(device_options_t &opts, std::string_view arg,
+                              const option_value_fn_t &value) {
+    if (arg == "--mock") {
+        opts.mock = true;
+    } else if (arg == "--device-type") {
+        opts.deviceType = value();
+    } else if (arg == "--il") {
+        opts.ilPath = value();
+    } else if (arg == "--binary") {
+        opts.binaryPath = value();
+    } else if (arg == "--kernel") {
+        opts.kernelName = value();
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/// A loader, context and queue for one device, set up once per benchmark
+/// process. Layers are selected through UR_ENABLE_LAYERS.
+struct device_env_t {
+    ur_loader_config_handle_t loaderConfig = nullptr;
+    std::vector<ur_adapter_handle_t> adapters;
+    ur_device_handle_t device = nullptr;
+    ur_context_handle_t context = nullptr;
+    ur_program_handle_t program = nullptr;
+    ur_kernel_handle_t kernel = nullptr;
+
+    void init(const device_options_t &opts) {
+        UR_CHECK(urLoaderConfigCreate(&loaderConfig));
+        if (opts.mock) {
+            UR_CHECK(urLoaderConfigSetMockingEnabled(loaderConfig, true));
+        }
+        UR_CHECK(urLoaderInit(0, loaderConfig));
+
+        uint32_t numAdapters = 0;
+        UR_CHECK(urAdapterGet(0, nullptr, &numAdapters));
+        adapters.resize(numAdapters);
+        UR_CHECK(urAdapterGet(numAdapters, adapters.data(), nullptr));
+
+        uint32_t numPlatforms = 0;
+        UR_CHECK(urPlatformGet(adapters.data(), numAdapters, 0, nullptr,
+                               &numPlatforms));
+        std::vector<ur_platform_handle_t> platforms(numPlatforms);
+        UR_CHECK(urPlatformGet(adapters.data(), numAdapters, numPlatforms,
+                               platforms.data(), nullptr));
+
+        auto type = parseDeviceType(opts.deviceType);
+        for (auto platform : platforms) {
+            uint32_t numDevices = 0;
+            if (urDeviceGet(platform, type, 0, nullptr, &numDevices) ==
+                    UR_RESULT_SUCCESS &&
+                numDevices > 0) {
+                UR_CHECK(urDeviceGet(platform, type, 1, &device, nullptr));
+                break;
+            }
+        }
+        if (!device) {
+            std::cerr << "error: no " << opts.deviceType << " device found\n";
+            std::exit(1);
+        }
+
+        UR_CHECK(urContextCreate(1, &device, nullptr, &context));
+
+        // Kernels are only available when a program for the device is
+        // provided, the mock adapter accepts any input.
+        if (opts.mock || !opts.ilPath.empty() || !opts.binaryPath.empty()) {
+            if (!opts.binaryPath.empty()) {
+                auto binary = readFile(opts.binaryPath);
+                size_t length = binary.size();
+                const uint8_t *data = binary.data();
+                UR_CHECK(urProgramCreateWithBinary(context, 1, &device,
+                                                   &length, &data, nullptr,
+                                                   &program));
+            } else {
+                std::vector<uint8_t> il{0x03, 0x02, 0x23, 0x07};
+                if (!opts.ilPath.empty()) {
+                    il = readFile(opts.ilPath);
+                }
+                UR_CHECK(urProgramCreateWithIL(context, il.data(), il.size(),
+                                               nullptr, &program));
+            }
+            UR_CHECK(urProgramBuild(context, program, nullptr));
+            auto kernelName = opts.kernelName.empty() ? std::string("empty")
+                                                      : opts.kernelName;
+            UR_CHECK(urKernelCreate(program, kernelName.c_str(), &kernel));
+        }
+    }
+
+    void teardown() {
+        if (kernel) {
+            UR_CHECK(urKernelRelease(kernel));
+        }
+        if (program) {
+            UR_CHECK(urProgramRelease(program));
+        }
+        if (context) {
+            UR_CHECK(urContextRelease(context));
+        }
+        for (auto adapter : adapters) {
+            UR_CHECK(urAdapterRelease(adapter));
+        }
+        if (loaderConfig) {
+            UR_CHECK(urLoaderConfigRelease(loaderConfig));
+        }
+        UR_CHECK(urLoaderTearDown());
+    }
+};
+
+} // namespace urbench
@@ -0,0 +1,172 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures how many tiny kernels a queue completes per second when they are
+// submitted back to back, which is dominated by the per-launch cost of the
+// adapter rather than by the kernels. With --native-cpu the kernel comes from
+// a program built into this binary, so no device compiler is needed.
+
+#include "bench_utils.hpp"
+
+#include <atomic>
+#include <sstream>
+
+namespace urbench {
+
+struct throughput_options_t : device_options_t {
+    std::vector<size_t> counts = {1000, 10000};
+    size_t repetitions = 5;
+    size_t workItems = 1;
+    bool outOfOrder = false;
+    bool nativeCpu = false;
+};
+
+// Kernel invocations, reported at exit as a check that the kernels ran.
+static std::atomic<size_t> invocations{0};
+
+// Native CPU kernels receive their arguments and the work-item state, which
+// a tiny kernel does not need.
+static void tinyKernel(void *const *, void *) {
+    invocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Program binary of the native CPU adapter: a table of kernel names and
+// entry points, terminated by a null entry.
+struct native_cpu_entry_t {
+    const char *name;
+    const unsigned char *kernel;
+};
+
+static const native_cpu_entry_t nativeCpuProgram[] = {
+    {"empty", reinterpret_cast<const unsigned char *>(&tinyKernel)},
+    {nullptr, nullptr},
+};
+
+static void createNativeCpuKernel(device_env_t &env) {
+    const auto *binary = reinterpret_cast<const uint8_t *>(nativeCpuProgram);
+    size_t length = sizeof(nativeCpuProgram);
+    UR_CHECK(urProgramCreateWithBinary(env.context, 1, &env.device, &length,
+                                       &binary, nullptr, &env.program));
+    UR_CHECK(urProgramBuild(env.context, env.program, nullptr));
+    UR_CHECK(urKernelCreate(env.program, "empty", &env.kernel));
+}
+
+/// Enqueues count launches without events and waits for the queue, returns
+/// the elapsed time in seconds.
+static double runLaunches(const device_env_t &env, ur_queue_handle_t queue,
+                          size_t count, size_t workItems) {
+    size_t globalOffset = 0;
+    auto begin = clock::now();
+    for (size_t i = 0; i < count; i++) {
+        UR_CHECK(urEnqueueKernelLaunch(queue, env.kernel, 1, &globalOffset,
+                                       &workItems, nullptr, 0, nullptr,
+                                       nullptr));
+    }
+    UR_CHECK(urQueueFinish(queue));
+    return elapsedUs(begin, clock::now()) / 1e6;
+}
+
+static std::vector<size_t> parseCounts(const std::string &list) {
+    std::vector<size_t> counts;
+    std::stringstream stream(list);
+    std::string count;
+    while (std::getline(stream, count, ',')) {
+        counts.push_back(std::stoul(count));
+    }
+    return counts;
+}
+
+static throughput_options_t parseArgs(int argc, const char **argv) {
+    static const char *usage =
+        "usage: %s [-h] [options]\n"
+        "\n"
+        "Measures the number of tiny kernels per second a queue completes "
+        "when they are\n"
+        "submitted back to back. The results are printed as CSV with one row "
+        "per\n"
+        "launch count.\n"
+        "\n"
+        "options:\n"
+        "  -h, --help            show this help message and exit\n"
+        "  --counts N,...        launches per run (default 1000,10000)\n"
+        "  --repetitions N       runs per launch count (default 5)\n"
+        "  --work-items N        global size of each launch (default 1)\n"
+        "  --out-of-order        use an out-of-order queue\n"
+        "  --native-cpu          use a kernel built into this binary, for the "
+        "native CPU\n"
+        "                        adapter\n" URBENCH_DEVICE_OPTIONS_USAGE;
+    throughput_options_t opts;
+    parseOptions(argc, argv, usage,
+                 [&](std::string_view arg, const option_value_fn_t &value) {
+                     if (arg == "--counts") {
+                         opts.counts = parseCounts(value());
+                     } else if (arg == "--repetitions") {
+                         opts.repetitions =
+                             std::max(1ul, std::stoul(value()));
+                     } else if (arg == "--work-items") {
+                         opts.workItems = std::max(1ul, std::stoul(value()));
+                     } else if (arg == "--out-of-order") {
+                         opts.outOfOrder = true;
+                     } else if (arg == "--native-cpu") {
+                         opts.nativeCpu = true;
+                     } else {
+                         return parseDeviceOption(opts, arg, value);
+                     }
+                     return true;
+                 });
+    return opts;
+}
+
+} // namespace urbench
+
+int main(int argc, const char **argv) {
+    auto opts = urbench::parseArgs(argc, argv);
+
+    urbench::device_env_t env;
+    env.init(opts);
+    if (opts.nativeCpu && !env.kernel) {
+        urbench::createNativeCpuKernel(env);
+    }
+    if (!env.kernel) {
+        std::cerr << "error: no kernel, pass --native-cpu, --il or --binary\n";
+        return 1;
+    }
+
+    ur_queue_properties_t props{UR_STRUCTURE_TYPE_QUEUE_PROPERTIES, nullptr,
+                                0};
+    if (opts.outOfOrder) {
+        props.flags = UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE;
+    }
+    ur_queue_handle_t queue = nullptr;
+    UR_CHECK(urQueueCreate(env.context, env.device, &props, &queue));
+
+    // Warms up the adapter, so that the first run does not pay for lazy
+    // initialization.
+    urbench::runLaunches(env, queue, 100, opts.workItems);
+
+    std::printf("queue,kernels,work_items,median_seconds,min_seconds,"
+                "throughput,unit\n");
+    for (auto count : opts.counts) {
+        std::vector<double> samples;
+        for (size_t rep = 0; rep < opts.repetitions; rep++) {
+            samples.push_back(
+                urbench::runLaunches(env, queue, count, opts.workItems));
+        }
+        auto stats = urbench::computeStats(samples);
+        std::printf("%s,%zu,%zu,%f,%f,%f,kernels/s\n",
+                    opts.outOfOrder ? "out-of-order" : "in-order", count,
+                    opts.workItems, stats.median, stats.min,
+                    static_cast<double>(count) / stats.median);
+        std::fflush(stdout);
+    }
+
+    if (opts.nativeCpu) {
+        std::fprintf(stderr, "kernel invocations: %zu\n",
+                     urbench::invocations.load());
+    }
+    UR_CHECK(urQueueRelease(queue));
+    env.teardown();
+    return 0;
+}
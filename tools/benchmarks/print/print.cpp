@@ -0,0 +1,137 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Compares the iostream printers of ur_print.hpp with the allocation-free
+// writer printers, and the C print API used by tools that cannot include the
+// C++ header. No adapter is needed, everything is formatted on the host.
+
+#include "bench_utils.hpp"
+#include "ur_print.h"
+
+#include <benchmark/benchmark.h>
+#include <sstream>
+
+namespace urbench {
+
+constexpr ur_function_t function = UR_FUNCTION_ENQUEUE_USM_FILL;
+constexpr uint32_t flags = UR_DEVICE_AFFINITY_DOMAIN_FLAG_NUMA |
+                           UR_DEVICE_AFFINITY_DOMAIN_FLAG_L2_CACHE |
+                           UR_DEVICE_AFFINITY_DOMAIN_FLAG_NEXT_PARTITIONABLE;
+
+// Parameters of a typical traced call, the handles are never dereferenced.
+struct fill_call_t {
+    ur_queue_handle_t queue = reinterpret_cast<ur_queue_handle_t>(0x1000);
+    void *mem = reinterpret_cast<void *>(0x2000);
+    uint32_t pattern = 42;
+    size_t patternSize = sizeof(pattern);
+    const void *patternPtr = &pattern;
+    size_t size = 4096;
+    uint32_t numEvents = 0;
+    const ur_event_handle_t *waitList = nullptr;
+    ur_event_handle_t *event = nullptr;
+    ur_enqueue_usm_fill_params_t params;
+
+    fill_call_t() {
+        params.phQueue = &queue;
+        params.ppMem = &mem;
+        params.ppatternSize = &patternSize;
+        params.ppPattern = &patternPtr;
+        params.psize = &size;
+        params.pnumEventsInWaitList = &numEvents;
+        params.pphEventWaitList = &waitList;
+        params.pphEvent = &event;
+    }
+};
+
+static void BM_EnumIostream(benchmark::State &state) {
+    for (auto _ : state) {
+        std::ostringstream os;
+        os << function;
+        benchmark::DoNotOptimize(os.str());
+    }
+}
+BENCHMARK(BM_EnumIostream);
+
+static void BM_EnumWriter(benchmark::State &state) {
+    char data[128];
+    for (auto _ : state) {
+        ur::writer::buffer_t buf(data, sizeof(data));
+        ur::writer::print(buf, function);
+        benchmark::DoNotOptimize(buf.terminate());
+    }
+}
+BENCHMARK(BM_EnumWriter);
+
+static void BM_FlagIostream(benchmark::State &state) {
+    for (auto _ : state) {
+        std::ostringstream os;
+        ur::details::printFlag<ur_device_affinity_domain_flag_t>(os, flags);
+        benchmark::DoNotOptimize(os.str());
+    }
+}
+BENCHMARK(BM_FlagIostream);
+
+static void BM_FlagWriter(benchmark::State &state) {
+    char data[256];
+    for (auto _ : state) {
+        ur::writer::buffer_t buf(data, sizeof(data));
+        ur::writer::printFlag<ur_device_affinity_domain_flag_t>(buf, flags);
+        benchmark::DoNotOptimize(buf.terminate());
+    }
+}
+BENCHMARK(BM_FlagWriter);
+
+static void BM_ParamsIostream(benchmark::State &state) {
+    fill_call_t call;
+    for (auto _ : state) {
+        std::ostringstream os;
+        ur::extras::printFunctionParams(os, function, &call.params);
+        benchmark::DoNotOptimize(os.str());
+    }
+}
+BENCHMARK(BM_ParamsIostream);
+
+static void BM_ParamsWriter(benchmark::State &state) {
+    fill_call_t call;
+    std::string storage;
+    for (auto _ : state) {
+        auto buf = ur::writer::stringBuffer(storage);
+        ur::writer::printFunctionParams(buf, function, &call.params);
+        benchmark::DoNotOptimize(buf.str());
+    }
+}
+BENCHMARK(BM_ParamsWriter);
+
+// The usual C API pattern of asking for the size first and then printing.
+static void BM_CApiTwoCalls(benchmark::State &state) {
+    fill_call_t call;
+    char data[1024];
+    for (auto _ : state) {
+        size_t size = 0;
+        UR_CHECK(urPrintFunctionParams(function, &call.params, nullptr, 0,
+                                       &size));
+        UR_CHECK(urPrintFunctionParams(function, &call.params, data, size,
+                                       nullptr));
+        benchmark::DoNotOptimize(data);
+    }
+}
+BENCHMARK(BM_CApiTwoCalls);
+
+// A large enough buffer makes the size query unnecessary.
+static void BM_CApiOneCall(benchmark::State &state) {
+    fill_call_t call;
+    char data[1024];
+    for (auto _ : state) {
+        size_t size = 0;
+        UR_CHECK(urPrintFunctionParams(function, &call.params, data,
+                                       sizeof(data), &size));
+        benchmark::DoNotOptimize(data);
+    }
+}
+BENCHMARK(BM_CApiOneCall);
+
+} // namespace urbench
+
+BENCHMARK_MAIN();
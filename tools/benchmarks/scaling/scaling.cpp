@@ -0,0 +1,224 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures how the throughput of a mix of Unified Runtime calls scales with
+// the number of threads issuing them, either all through one shared queue or
+// through one queue per thread. With --lock-report the adapters also log the
+// contention of their lock sites when they are torn down.
+
+#include "bench_utils.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace urbench {
+
+struct scaling_options_t : device_options_t {
+    size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    size_t iterations = 10000;
+    std::vector<std::string> modes = {"shared", "per-thread"};
+    bool lockReport = false;
+};
+
+constexpr size_t allocSize = 4096;
+constexpr size_t copySize = 64;
+constexpr size_t drainInterval = 256;
+
+// Number of UR calls issued by a single iteration of runMix, excluding the
+// kernel launch.
+constexpr size_t callsPerIteration = 7;
+
+/// Issues a mix of the calls made by a typical multi-threaded application:
+/// submissions with and without events, event queries and handle
+/// retain/release.
+static size_t runMix(const device_env_t &env, ur_queue_handle_t queue,
+                     void *src, void *dst, size_t iterations) {
+    size_t globalOffset = 0;
+    size_t globalSize = 1;
+    uint32_t pattern = 42;
+    size_t calls = 0;
+    for (size_t i = 0; i < iterations; i++) {
+        UR_CHECK(urEnqueueUSMFill(queue, dst, sizeof(pattern), &pattern,
+                                  copySize, 0, nullptr, nullptr));
+
+        ur_event_handle_t event = nullptr;
+        UR_CHECK(urEnqueueUSMMemcpy(queue, false, dst, src, copySize, 0,
+                                    nullptr, &event));
+        ur_event_status_t status;
+        UR_CHECK(urEventGetInfo(event, UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                                sizeof(status), &status, nullptr));
+        UR_CHECK(urEventRelease(event));
+
+        UR_CHECK(urContextRetain(env.context));
+        UR_CHECK(urContextRelease(env.context));
+        UR_CHECK(urQueueRetain(queue));
+        UR_CHECK(urQueueRelease(queue));
+        calls += callsPerIteration;
+
+        if (env.kernel) {
+            UR_CHECK(urEnqueueKernelLaunch(queue, env.kernel, 1, &globalOffset,
+                                           &globalSize, nullptr, 0, nullptr,
+                                           nullptr));
+            calls++;
+        }
+
+        if ((i + 1) % drainInterval == 0) {
+            UR_CHECK(urQueueFinish(queue));
+        }
+    }
+    UR_CHECK(urQueueFinish(queue));
+    return calls;
+}
+
+struct sample_t {
+    size_t calls;
+    double seconds;
+};
+
+/// Runs the call mix on numThreads threads, which start together once all of
+/// them have finished their setup.
+static sample_t runThreads(const device_env_t &env,
+                           const scaling_options_t &opts, bool sharedQueue,
+                           size_t numThreads) {
+    ur_queue_handle_t sharedHandle = nullptr;
+    if (sharedQueue) {
+        UR_CHECK(urQueueCreate(env.context, env.device, nullptr,
+                               &sharedHandle));
+    }
+
+    std::atomic<size_t> ready{0};
+    std::atomic<bool> start{false};
+    std::atomic<size_t> calls{0};
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < numThreads; t++) {
+        threads.emplace_back([&]() {
+            ur_queue_handle_t queue = sharedHandle;
+            if (!sharedQueue) {
+                UR_CHECK(
+                    urQueueCreate(env.context, env.device, nullptr, &queue));
+            }
+            void *src = nullptr;
+            void *dst = nullptr;
+            UR_CHECK(urUSMSharedAlloc(env.context, env.device, nullptr,
+                                      nullptr, allocSize, &src));
+            UR_CHECK(urUSMSharedAlloc(env.context, env.device, nullptr,
+                                      nullptr, allocSize, &dst));
+
+            ready++;
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            calls += runMix(env, queue, src, dst, opts.iterations);
+
+            UR_CHECK(urUSMFree(env.context, src));
+            UR_CHECK(urUSMFree(env.context, dst));
+            if (!sharedQueue) {
+                UR_CHECK(urQueueRelease(queue));
+            }
+        });
+    }
+
+    while (ready.load() != numThreads) {
+        std::this_thread::yield();
+    }
+    auto begin = clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    auto seconds = elapsedUs(begin, clock::now()) / 1e6;
+
+    if (sharedHandle) {
+        UR_CHECK(urQueueRelease(sharedHandle));
+    }
+    return {calls.load(), seconds};
+}
+
+/// Thread counts to sample: powers of two up to, and including, maxThreads.
+static std::vector<size_t> threadCounts(size_t maxThreads) {
+    std::vector<size_t> counts;
+    for (size_t n = 1; n < maxThreads; n *= 2) {
+        counts.push_back(n);
+    }
+    counts.push_back(maxThreads);
+    return counts;
+}
+
+static scaling_options_t parseArgs(int argc, const char **argv) {
+    static const char *usage =
+        "usage: %s [-h] [options]\n"
+        "\n"
+        "Measures the throughput of a mix of Unified Runtime calls issued by "
+        "an\n"
+        "increasing number of threads. The results are printed as CSV with "
+        "one row per\n"
+        "queue mode and thread count.\n"
+        "\n"
+        "options:\n"
+        "  -h, --help            show this help message and exit\n"
+        "  --threads N           maximum number of threads (default: number "
+        "of cores)\n"
+        "  --iterations N        iterations of the call mix per thread "
+        "(default 10000)\n"
+        "  --mode MODE           shared, per-thread or both (default both)\n"
+        "  --lock-report         log per lock site contention statistics "
+        "(UR_LOCK_STATS)\n" URBENCH_DEVICE_OPTIONS_USAGE;
+    scaling_options_t opts;
+    parseOptions(argc, argv, usage,
+                 [&](std::string_view arg, const option_value_fn_t &value) {
+                     if (arg == "--threads") {
+                         opts.maxThreads = std::max(1ul, std::stoul(value()));
+                     } else if (arg == "--iterations") {
+                         opts.iterations = std::stoul(value());
+                     } else if (arg == "--mode") {
+                         auto mode = value();
+                         if (mode == "both") {
+                             opts.modes = {"shared", "per-thread"};
+                         } else if (mode == "shared" || mode == "per-thread") {
+                             opts.modes = {mode};
+                         } else {
+                             return false;
+                         }
+                     } else if (arg == "--lock-report") {
+                         opts.lockReport = true;
+                     } else {
+                         return parseDeviceOption(opts, arg, value);
+                     }
+                     return true;
+                 });
+    return opts;
+}
+
+} // namespace urbench
+
+int main(int argc, const char **argv) {
+    auto opts = urbench::parseArgs(argc, argv);
+    if (opts.lockReport) {
+        // Must be set before the adapters are loaded.
+#ifdef _WIN32
+        _putenv_s("UR_LOCK_STATS", "1");
+#else
+        setenv("UR_LOCK_STATS", "1", 1);
+#endif
+    }
+
+    urbench::device_env_t env;
+    env.init(opts);
+
+    std::printf("mode,threads,calls,seconds,throughput,unit\n");
+    for (const auto &mode : opts.modes) {
+        for (auto numThreads : urbench::threadCounts(opts.maxThreads)) {
+            auto sample = urbench::runThreads(env, opts, mode == "shared",
+                                              numThreads);
+            std::printf("%s,%zu,%zu,%f,%f,calls/s\n", mode.c_str(),
+                        numThreads, sample.calls, sample.seconds,
+                        static_cast<double>(sample.calls) / sample.seconds);
+            std::fflush(stdout);
+        }
+    }
+
+    env.teardown();
+    return 0;
+}
@@ -0,0 +1,382 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures cold-start latency of the Unified Runtime: every sample is taken in
+// a freshly spawned process, so the loader, adapters and layers are
+// initialized from scratch each time.
+
+#include "bench_utils.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <set>
+#include <sstream>
+
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#else
+#include <unistd.h>
+#endif
+
+namespace urbench {
+
+struct startup_options_t : device_options_t {
+    size_t processes = 10;
+    bool child = false;
+    bool adapterInitOnly = false;
+    std::vector<std::string> layers;
+};
+
+// Phases are reported in the order they are executed.
+constexpr const char *phases[] = {
+    "urLoaderInit",   "urAdapterGet",   "urPlatformGet",
+    "urDeviceGet",    "urContextCreate", "urQueueCreate",
+    "urProgramBuild", "firstEnqueue",   "urLoaderTearDown",
+};
+
+// Adapter selector names of the backends, as used by ONEAPI_DEVICE_SELECTOR.
+static const char *backendName(ur_adapter_backend_t backend) {
+    switch (backend) {
+    case UR_ADAPTER_BACKEND_LEVEL_ZERO:
+        return "level_zero";
+    case UR_ADAPTER_BACKEND_OPENCL:
+        return "opencl";
+    case UR_ADAPTER_BACKEND_CUDA:
+        return "cuda";
+    case UR_ADAPTER_BACKEND_HIP:
+        return "hip";
+    case UR_ADAPTER_BACKEND_NATIVE_CPU:
+        return "native_cpu";
+    default:
+        return nullptr;
+    }
+}
+
+/// Executes every startup phase once and prints "phase,microseconds" lines,
+/// followed by an "adapter,name" line per adapter. With adapterInitOnly the
+/// phases after urAdapterGet are skipped.
+static int runChild(const startup_options_t &opts) {
+    auto report = [](const char *phase, clock::time_point start) {
+        std::printf("%s,%f\n", phase, elapsedUs(start, clock::now()));
+    };
+
+    auto start = clock::now();
+    ur_loader_config_handle_t loaderConfig = nullptr;
+    UR_CHECK(urLoaderConfigCreate(&loaderConfig));
+    if (opts.mock) {
+        UR_CHECK(urLoaderConfigSetMockingEnabled(loaderConfig, true));
+    }
+    for (const auto &layer : opts.layers) {
+        UR_CHECK(urLoaderConfigEnableLayer(loaderConfig, layer.c_str()));
+    }
+    UR_CHECK(urLoaderInit(0, loaderConfig));
+    report("urLoaderInit", start);
+
+    start = clock::now();
+    uint32_t numAdapters = 0;
+    UR_CHECK(urAdapterGet(0, nullptr, &numAdapters));
+    std::vector<ur_adapter_handle_t> adapters(numAdapters);
+    UR_CHECK(urAdapterGet(numAdapters, adapters.data(), nullptr));
+    report("urAdapterGet", start);
+
+    for (auto adapter : adapters) {
+        ur_adapter_backend_t backend = UR_ADAPTER_BACKEND_UNKNOWN;
+        UR_CHECK(urAdapterGetInfo(adapter, UR_ADAPTER_INFO_BACKEND,
+                                  sizeof(backend), &backend, nullptr));
+        if (auto name = backendName(backend)) {
+            std::printf("adapter,%s\n", name);
+        }
+    }
+
+    if (opts.adapterInitOnly) {
+        for (auto adapter : adapters) {
+            UR_CHECK(urAdapterRelease(adapter));
+        }
+        UR_CHECK(urLoaderConfigRelease(loaderConfig));
+        UR_CHECK(urLoaderTearDown());
+        return 0;
+    }
+
+    start = clock::now();
+    uint32_t numPlatforms = 0;
+    UR_CHECK(urPlatformGet(adapters.data(), numAdapters, 0, nullptr,
+                           &numPlatforms));
+    std::vector<ur_platform_handle_t> platforms(numPlatforms);
+    UR_CHECK(urPlatformGet(adapters.data(), numAdapters, numPlatforms,
+                           platforms.data(), nullptr));
+    report("urPlatformGet", start);
+
+    start = clock::now();
+    auto type = parseDeviceType(opts.deviceType);
+    ur_device_handle_t device = nullptr;
+    for (auto platform : platforms) {
+        uint32_t numDevices = 0;
+        if (urDeviceGet(platform, type, 0, nullptr, &numDevices) ==
+                UR_RESULT_SUCCESS &&
+            numDevices > 0) {
+            UR_CHECK(urDeviceGet(platform, type, 1, &device, nullptr));
+            break;
+        }
+    }
+    report("urDeviceGet", start);
+    if (!device) {
+        std::cerr << "error: no " << opts.deviceType << " device found\n";
+        return 1;
+    }
+
+    start = clock::now();
+    ur_context_handle_t context = nullptr;
+    UR_CHECK(urContextCreate(1, &device, nullptr, &context));
+    report("urContextCreate", start);
+
+    start = clock::now();
+    ur_queue_handle_t queue = nullptr;
+    UR_CHECK(urQueueCreate(context, device, nullptr, &queue));
+    report("urQueueCreate", start);
+
+    // The program phase needs a kernel for the selected device, the mock
+    // adapter accepts any input.
+    ur_program_handle_t program = nullptr;
+    ur_kernel_handle_t kernel = nullptr;
+    bool haveProgram =
+        opts.mock || !opts.ilPath.empty() || !opts.binaryPath.empty();
+    if (haveProgram) {
+        std::vector<uint8_t> il{0x03, 0x02, 0x23, 0x07};
+        if (!opts.ilPath.empty()) {
+            il = readFile(opts.ilPath);
+        }
+        std::vector<uint8_t> binary;
+        if (!opts.binaryPath.empty()) {
+            binary = readFile(opts.binaryPath);
+        }
+
+        start = clock::now();
+        if (!binary.empty()) {
+            size_t length = binary.size();
+            const uint8_t *data = binary.data();
+            UR_CHECK(urProgramCreateWithBinary(context, 1, &device, &length,
+                                               &data, nullptr, &program));
+        } else {
+            UR_CHECK(urProgramCreateWithIL(context, il.data(), il.size(),
+                                           nullptr, &program));
+        }
+        UR_CHECK(urProgramBuild(context, program, nullptr));
+        auto kernelName = opts.kernelName.empty() ? std::string("empty")
+                                                  : opts.kernelName;
+        UR_CHECK(urKernelCreate(program, kernelName.c_str(), &kernel));
+        report("urProgramBuild", start);
+    }
+
+    // Without a kernel the first enqueue is a small USM fill, which every
+    // adapter supports and which still exercises the submission path. Some
+    // adapters require the fill to be larger than its pattern.
+    uint32_t pattern = 42;
+    size_t fillSize = 2 * sizeof(pattern);
+    void *ptr = nullptr;
+    if (!kernel) {
+        UR_CHECK(urUSMSharedAlloc(context, device, nullptr, nullptr, fillSize,
+                                  &ptr));
+    }
+    start = clock::now();
+    if (kernel) {
+        size_t globalOffset = 0;
+        size_t globalSize = 1;
+        UR_CHECK(urEnqueueKernelLaunch(queue, kernel, 1, &globalOffset,
+                                       &globalSize, nullptr, 0, nullptr,
+                                       nullptr));
+    } else {
+        UR_CHECK(urEnqueueUSMFill(queue, ptr, sizeof(pattern), &pattern,
+                                  fillSize, 0, nullptr, nullptr));
+    }
+    UR_CHECK(urQueueFinish(queue));
+    report("firstEnqueue", start);
+
+    if (ptr) {
+        UR_CHECK(urUSMFree(context, ptr));
+    }
+    if (kernel) {
+        UR_CHECK(urKernelRelease(kernel));
+    }
+    if (program) {
+        UR_CHECK(urProgramRelease(program));
+    }
+    UR_CHECK(urQueueRelease(queue));
+    UR_CHECK(urContextRelease(context));
+    for (auto adapter : adapters) {
+        UR_CHECK(urAdapterRelease(adapter));
+    }
+    UR_CHECK(urLoaderConfigRelease(loaderConfig));
+
+    start = clock::now();
+    UR_CHECK(urLoaderTearDown());
+    report("urLoaderTearDown", start);
+
+    return 0;
+}
+
+static std::string selfPath(const char *argv0) {
+#ifdef __linux__
+    std::vector<char> buffer(4096);
+    auto len = readlink("/proc/self/exe", buffer.data(), buffer.size() - 1);
+    if (len > 0) {
+        return std::string(buffer.data(), static_cast<size_t>(len));
+    }
+#endif
+    return argv0;
+}
+
+using samples_t = std::map<std::string, std::vector<double>>;
+
+/// Runs the command in the requested number of child processes, collecting
+/// the samples of every phase and the names of the adapters reported.
+static bool sampleChildren(const std::string &command, size_t processes,
+                           samples_t &samples,
+                           std::set<std::string> &adapters) {
+    for (size_t i = 0; i < processes; i++) {
+        FILE *pipe = popen(command.c_str(), "r");
+        if (!pipe) {
+            std::cerr << "error: failed to spawn " << command << "\n";
+            return false;
+        }
+        char line[256];
+        while (std::fgets(line, sizeof(line), pipe)) {
+            std::string_view entry(line);
+            auto comma = entry.find(',');
+            if (comma == std::string_view::npos) {
+                continue;
+            }
+            auto key = entry.substr(0, comma);
+            auto value = entry.substr(comma + 1);
+            if (key == "adapter") {
+                adapters.emplace(
+                    value.substr(0, value.find_first_of("\r\n")));
+                continue;
+            }
+            samples[std::string(key)].push_back(std::atof(line + comma + 1));
+        }
+        if (pclose(pipe) != 0) {
+            std::cerr << "error: child process " << i << " failed\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+static void printStats(const std::string &phase,
+                       const std::vector<double> &values) {
+    auto stats = computeStats(values);
+    std::printf("%s,%f,%f,%f,%f,%f,%zu,us\n", phase.c_str(), stats.mean,
+                stats.median, stats.stddev, stats.min, stats.max, stats.count);
+}
+
+/// Spawns the requested number of child processes and prints the aggregated
+/// statistics of every phase as CSV. The initialization of each adapter is
+/// then sampled on its own, with ONEAPI_DEVICE_SELECTOR restricting the
+/// loader to that adapter, and reported as "phase[adapter]" rows.
+static int runParent(const startup_options_t &opts, int argc,
+                     const char **argv) {
+    std::stringstream command;
+    command << "\"" << selfPath(argv[0]) << "\" --child";
+    for (int argi = 1; argi < argc; argi++) {
+        command << " \"" << argv[argi] << "\"";
+    }
+
+    samples_t samples;
+    std::set<std::string> adapters;
+    if (!sampleChildren(command.str(), opts.processes, samples, adapters)) {
+        return 1;
+    }
+
+    // The mock adapter replaces every other adapter, there is nothing to
+    // select.
+    std::map<std::string, samples_t> adapterSamples;
+    if (!opts.mock) {
+        auto adapterCommand = command.str() + " --adapter-init-only";
+        for (const auto &adapter : adapters) {
+            // Adapters are filtered on load by the selector, so every child
+            // spawned below only loads and initializes this one.
+            auto selector = adapter + ":*";
+#ifdef _WIN32
+            _putenv_s("ONEAPI_DEVICE_SELECTOR", selector.c_str());
+#else
+            setenv("ONEAPI_DEVICE_SELECTOR", selector.c_str(), 1);
+#endif
+            std::set<std::string> selected;
+            if (!sampleChildren(adapterCommand, opts.processes,
+                                adapterSamples[adapter], selected)) {
+                return 1;
+            }
+        }
+    }
+
+    std::printf("phase,mean,median,stddev,min,max,samples,unit\n");
+    for (auto phase : phases) {
+        auto it = samples.find(phase);
+        if (it != samples.end()) {
+            printStats(phase, it->second);
+        }
+    }
+    for (const auto &[adapter, phaseSamples] : adapterSamples) {
+        for (auto phase : {"urLoaderInit", "urAdapterGet"}) {
+            auto it = phaseSamples.find(phase);
+            if (it != phaseSamples.end()) {
+                printStats(std::string(phase) + "[" + adapter + "]",
+                           it->second);
+            }
+        }
+    }
+    return 0;
+}
+
+static startup_options_t parseArgs(int argc, const char **argv) {
+    static const char *usage =
+        "usage: %s [-h] [options]\n"
+        "\n"
+        "Measures the latency of each Unified Runtime startup phase, from "
+        "urLoaderInit\n"
+        "up to the first enqueue, in freshly spawned processes. The results "
+        "are printed\n"
+        "as CSV with one row per phase, in microseconds, followed by the "
+        "urLoaderInit\n"
+        "and urAdapterGet rows of each adapter initialized on its own, "
+        "e.g.\n"
+        "urAdapterGet[level_zero].\n"
+        "\n"
+        "options:\n"
+        "  -h, --help            show this help message and exit\n"
+        "  --processes N         number of fresh processes to sample "
+        "(default 10)\n"
+        "  --layer NAME          enable a layer through the loader config, "
+        "may be repeated\n" URBENCH_DEVICE_OPTIONS_USAGE;
+    startup_options_t opts;
+    parseOptions(argc, argv, usage,
+                 [&](std::string_view arg, const option_value_fn_t &value) {
+                     if (arg == "--child") {
+                         opts.child = true;
+                     } else if (arg == "--adapter-init-only") {
+                         opts.adapterInitOnly = true;
+                     } else if (arg == "--processes") {
+                         opts.processes = std::stoul(value());
+                     } else if (arg == "--layer") {
+                         opts.layers.push_back(value());
+                     } else {
+                         return parseDeviceOption(opts, arg, value);
+                     }
+                     return true;
+                 });
+    return opts;
+}
+
+} // namespace urbench
+
+int main(int argc, const char **argv) {
+    auto opts = urbench::parseArgs(argc, argv);
+    if (opts.child) {
+        return urbench::runChild(opts);
+    }
+    return urbench::runParent(opts, argc, argv);
+}
@@ -193,20 +193,23 @@ class TraceWriter {
     virtual ~TraceWriter() {}
     virtual void prologue() {}
     virtual void epilogue() {}
-    virtual void begin(uint64_t id, const char *fname, std::string args) = 0;
-    virtual void end(uint64_t id, const char *fname, std::string args,
+    virtual void begin(uint64_t id, const char *fname,
+                       std::string_view args) = 0;
+    virtual void end(uint64_t id, const char *fname, std::string_view args,
                      Timepoint tp, Timepoint start_tp,
                      const ur_result_t *resultp) = 0;
 };
 
 class HumanReadable : public TraceWriter {
-    void begin(uint64_t id, const char *fname, std::string args) override {
+    void begin(uint64_t id, const char *fname,
+               std::string_view args) override {
         if (cli_args.print_begin) {
             out.info("begin({}) - {}({});", id, fname, args);
         }
     }
-    void end(uint64_t id, const char *fname, std::string args, Timepoint tp,
-             Timepoint start_tp, const ur_result_t *resultp) override {
+    void end(uint64_t id, const char *fname, std::string_view args,
+             Timepoint tp, Timepoint start_tp,
+             const ur_result_t *resultp) override {
         std::ostringstream prefix_str;
         if (cli_args.print_begin) {
             prefix_str << "end(" << id << ") - ";
@@ -245,9 +248,9 @@ class JsonWriter : public TraceWriter {
             "\"tid\": \"\", \"ts\": \"\"}}");
         out.info("]\n}}");
     }
-    void begin(uint64_t, const char *, std::string) override {}
+    void begin(uint64_t, const char *, std::string_view) override {}
 
-    void end(uint64_t, const char *fname, std::string args, Timepoint tp,
+    void end(uint64_t, const char *fname, std::string_view args, Timepoint tp,
              Timepoint start_tp, const ur_result_t *) override {
         auto dur = tp - start_tp;
         auto ts_us = std::chrono::duration_cast<std::chrono::microseconds>(
@@ -327,19 +330,22 @@ XPTI_CALLBACK_API void trace_cb(uint16_t trace_type, xpti::trace_event_data_t *,
         }
     }
 
-    std::ostringstream args_str;
-    if (cli_args.no_args) {
-        args_str << "...";
-    } else {
-        ur::extras::printFunctionParams(
-            args_str, (enum ur_function_t)args->function_id, args->args_data);
+    // Arguments are formatted into a per-thread string that keeps its
+    // capacity, so once it has grown tracing a call does not allocate.
+    thread_local std::string args_storage;
+    std::string_view args_str = "...";
+    if (!cli_args.no_args) {
+        auto buf = ur::writer::stringBuffer(args_storage);
+        ur::writer::printFunctionParams(
+            buf, (enum ur_function_t)args->function_id, args->args_data);
+        args_str = std::string_view(buf.data(), buf.size());
     }
 
     if (trace_type == TRACE_FN_BEGIN) {
         auto ctx = push_instance_data(instance);
         ctx->start = std::optional(Clock::now());
 
-        writer()->begin(instance, args->function_name, args_str.str());
+        writer()->begin(instance, args->function_name, args_str);
     } else if (trace_type == TRACE_FN_END) {
         auto ctx = pop_instance_data(instance);
         if (!ctx) {
@@ -350,7 +356,7 @@ XPTI_CALLBACK_API void trace_cb(uint16_t trace_type, xpti::trace_event_data_t *,
         }
         auto resultp = static_cast<const ur_result_t *>(args->ret_data);
 
-        writer()->end(instance, args->function_name, args_str.str(),
+        writer()->end(instance, args->function_name, args_str,
                       time_for_end, *ctx->start, resultp);
     } else {
         out.warn("unsupported trace type");